@@ -1,40 +1,387 @@
+import os
 import re
+import shutil
+import sys
+import tempfile
+
+# A2L 基本数据类型长度（字节）
+A2L_DATATYPE_SIZE = {
+    'UBYTE': 1, 'SBYTE': 1,
+    'UWORD': 2, 'SWORD': 2,
+    'ULONG': 4, 'SLONG': 4,
+    'A_UINT64': 8, 'A_INT64': 8,
+    'FLOAT16_IEEE': 2, 'FLOAT32_IEEE': 4, 'FLOAT64_IEEE': 8,
+}
+
+# 关键字规范化配置：/begin 与 /end 后的关键字（不区分大小写） -> 输出形式
+#   INCA: 参数全部大写
+#   APE : 首字母大写，下划线替换为空格
+KEYWORD_PROFILES = {
+    'INCA': {'protocol_layer': 'PROTOCOL_LAYER', 'daq': 'DAQ'},
+    'APE': {'segment': 'Segment'},
+}
+
+# 同一命名空间内名称不允许重复（ASAM MCD-2 MC）
+NAMESPACES = {
+    'MEASUREMENT': 'OBJECT',
+    'CHARACTERISTIC': 'OBJECT',
+    'AXIS_PTS': 'OBJECT',
+    'COMPU_METHOD': 'COMPU_METHOD',
+    'COMPU_TAB': 'COMPU_TAB',
+    'COMPU_VTAB': 'COMPU_TAB',
+    'COMPU_VTAB_RANGE': 'COMPU_TAB',
+    'RECORD_LAYOUT': 'RECORD_LAYOUT',
+    'GROUP': 'GROUP',
+    'FUNCTION': 'FUNCTION',
+}
+
+# 需要收集字段做一致性检查的块
+COLLECT_BLOCKS = set(NAMESPACES.keys())
+
+# 与 DaqOptimizer 一致，注释整体作为一个记号；/\*.* 是延续到下一行的注释开头
+TOKEN_PATTERN = re.compile(r'"(?:[^"\\]|\\.)*"?|/\*.*?\*/|/\*.*|//.*|(?:[^\s"/]|/(?![*/]))+', re.S)
+NUMBER_PATTERN = re.compile(r'^(0x[0-9a-fA-F]+|\d+)$')
+
+RULE_KEYWORD = 'keyword-normalise'
+RULE_DUPLICATE = 'duplicate-name'
+RULE_OVERLAP = 'address-overlap'
+RULE_COMPU_METHOD = 'missing-compu-method'
+RULE_COMPU_TAB = 'missing-compu-tab'
+RULE_RECORD_LAYOUT = 'missing-record-layout'
+RULE_STRUCTURE = 'unbalanced-block'
+
+ALL_CHECKS = [RULE_DUPLICATE, RULE_OVERLAP, RULE_COMPU_METHOD, RULE_COMPU_TAB, RULE_RECORD_LAYOUT, RULE_STRUCTURE]
+
+
+def title_case(name):
+    """首字母大写，下划线替换为空格"""
+    return name.title().replace('_', ' ')
+
+
+def title_case_keep_underscore(name):
+    """首字母大写，保持下划线"""
+    return '_'.join(part.title() for part in name.split('_'))
+
+
+class A2lLinter:
+    """
+    单遍流式 A2L 规则引擎
+    逐行读取、只分词一次，同时完成关键字规范化和一致性检查，输出只写一次
+    """
+
+    def __init__(self, keyword_map=None, checks=None):
+        self.keyword_map = {k.lower(): v for k, v in (keyword_map or {}).items()}
+        self.checks = set(ALL_CHECKS if checks is None else checks)
+        self.diagnostics = {}
+        self.keyword_changes = 0
+
+        self._names = {}
+        self._compu_refs = []
+        self._tab_refs = []
+        self._layout_refs = []
+        self._addr_objs = []
+        self._compu_methods = set()
+        self._compu_tabs = set()
+        self._layouts = {}
+
+        self._stack = []
+        self._collect = None
+        self._pending = None
+        self._in_comment = False
+        self._line_no = 0
+
+    def report(self, rule, line_no, message):
+        self.diagnostics.setdefault(rule, []).append((line_no, message))
+
+    def _tokens(self, line):
+        """返回 [(start, end, token)]，跳过注释"""
+        result = []
+        pos = 0
+        if self._in_comment:
+            pos = line.find('*/')
+            if pos < 0:
+                return result
+            self._in_comment = False
+            pos += 2
+        for m in TOKEN_PATTERN.finditer(line, pos):
+            tok = m.group(0)
+            if tok.startswith('//'):
+                break
+            if tok.startswith('/*'):
+                if len(tok) < 4 or not tok.endswith('*/'):
+                    self._in_comment = True
+                    break
+                continue
+            result.append((m.start(), m.end(), tok))
+        return result
+
+    def process_line(self, line):
+        """处理一行，返回（可能被修改的）行"""
+        self._line_no += 1
+
+        # 快速路径：没有块关键字、字符串和注释的行直接切分
+        if not self._in_comment and self._pending is None and '/' not in line and '"' not in line:
+            if self._collect is not None:
+                self._collect['tokens'].extend(line.split())
+            return line
+
+        replaced = None
+        for start, end, tok in self._tokens(line):
+            if self._pending is not None:
+                kind = self._pending
+                self._pending = None
+                new_tok = self._keyword(kind, tok)
+                if new_tok != tok:
+                    if replaced is None:
+                        replaced = []
+                    replaced.append((start, end, new_tok))
+                continue
+
+            if tok == '/begin' or tok == '/end':
+                self._pending = tok
+                continue
+
+            if self._collect is not None:
+                self._collect['tokens'].append(tok)
+
+        if replaced is None:
+            return line
+
+        parts = []
+        last = 0
+        for start, end, new_tok in replaced:
+            parts.append(line[last:start])
+            parts.append(new_tok)
+            last = end
+        parts.append(line[last:])
+        return ''.join(parts)
+
+    def _keyword(self, kind, tok):
+        """处理 /begin 或 /end 后的关键字，返回规范化后的关键字"""
+        keyword = tok.upper()
+        if kind == '/begin':
+            self._begin(keyword)
+        else:
+            self._end(keyword)
+
+        new_tok = self.keyword_map.get(tok.lower(), tok)
+        if new_tok != tok:
+            self.keyword_changes += 1
+        return new_tok
+
+    def _begin(self, keyword):
+        self._stack.append((keyword, self._line_no))
+        if self._collect is not None:
+            # 嵌套块（如 IF_DATA）不收集字段
+            self._collect['depth'] += 1
+        elif keyword in COLLECT_BLOCKS:
+            self._collect = {'block': keyword, 'line': self._line_no, 'tokens': [], 'depth': 0}
+
+    def _end(self, keyword):
+        if not self._stack:
+            self.report(RULE_STRUCTURE, self._line_no, f"多余的 /end {keyword}")
+            return
+        top, line_no = self._stack.pop()
+        if top != keyword:
+            self.report(RULE_STRUCTURE, self._line_no, f"/end {keyword} 与第 {line_no} 行的 /begin {top} 不匹配")
+
+        if self._collect is not None:
+            if self._collect['depth'] > 0:
+                self._collect['depth'] -= 1
+            else:
+                self._finish_block(self._collect)
+                self._collect = None
+
+    def _finish_block(self, blk):
+        """一个对象块结束，登记名称、引用和地址"""
+        block = blk['block']
+        toks = blk['tokens']
+        line_no = blk['line']
+        if not toks:
+            return
+        name = toks[0]
+
+        space = NAMESPACES[block]
+        key = (space, name)
+        if key in self._names:
+            self.report(RULE_DUPLICATE, line_no, f"{block} {name} 与第 {self._names[key]} 行重名")
+        else:
+            self._names[key] = line_no
+
+        if block == 'COMPU_METHOD':
+            self._compu_methods.add(name)
+            for i, tok in enumerate(toks):
+                if tok.upper() in ('COMPU_TAB_REF', 'STATUS_STRING_REF') and i + 1 < len(toks):
+                    self._tab_refs.append((toks[i + 1], name, line_no))
+        elif block in ('COMPU_TAB', 'COMPU_VTAB', 'COMPU_VTAB_RANGE'):
+            self._compu_tabs.add(name)
+        elif block == 'RECORD_LAYOUT':
+            self._layouts[name] = self._layout_size(toks)
+        elif block == 'MEASUREMENT':
+            # name "long id" datatype conversion ...
+            if len(toks) > 3:
+                self._compu_refs.append((toks[3], name, line_no))
+        elif block == 'CHARACTERISTIC':
+            # name "long id" type address record_layout max_diff conversion lower upper
+            if len(toks) > 6:
+                self._layout_refs.append((toks[4], name, line_no))
+                self._compu_refs.append((toks[6], name, line_no))
+                self._addr_objs.append((self._int(toks[3]), name, toks[2].upper(), toks[4],
+                                        self._count(toks), line_no))
+        elif block == 'AXIS_PTS':
+            # name "long id" address input_quantity record_layout max_diff conversion max_axis_points ...
+            if len(toks) > 7:
+                self._layout_refs.append((toks[4], name, line_no))
+                self._compu_refs.append((toks[6], name, line_no))
+                self._addr_objs.append((self._int(toks[2]), name, 'AXIS_PTS', toks[4],
+                                        max(self._int(toks[7]) or 1, 1), line_no))
+
+    @staticmethod
+    def _int(text):
+        try:
+            return int(text, 0)
+        except ValueError:
+            return None
+
+    def _count(self, toks):
+        """CHARACTERISTIC 元素个数：NUMBER / MATRIX_DIM"""
+        count = 1
+        for i, tok in enumerate(toks):
+            key = tok.upper()
+            if key == 'NUMBER' and i + 1 < len(toks):
+                count = self._int(toks[i + 1]) or 1
+            elif key == 'MATRIX_DIM':
+                count = 1
+                j = i + 1
+                while j < len(toks) and NUMBER_PATTERN.match(toks[j]):
+                    count *= max(int(toks[j], 0), 1)
+                    j += 1
+        return count
+
+    @staticmethod
+    def _layout_size(toks):
+        """RECORD_LAYOUT 中 FNC_VALUES / AXIS_PTS_X 的元素长度"""
+        for i, tok in enumerate(toks):
+            if tok.upper() in ('FNC_VALUES', 'AXIS_PTS_X') and i + 2 < len(toks):
+                return A2L_DATATYPE_SIZE.get(toks[i + 2].upper(), 0)
+        return 0
+
+    def finish(self):
+        """文件结束，执行需要全局信息的检查"""
+        for keyword, line_no in self._stack:
+            self.report(RULE_STRUCTURE, line_no, f"/begin {keyword} 缺少 /end")
+
+        for ref, owner, line_no in self._compu_refs:
+            if ref != 'NO_COMPU_METHOD' and ref not in self._compu_methods:
+                self.report(RULE_COMPU_METHOD, line_no, f"{owner} 引用的 COMPU_METHOD {ref} 未定义")
+
+        for ref, owner, line_no in self._tab_refs:
+            if ref not in self._compu_tabs:
+                self.report(RULE_COMPU_TAB, line_no, f"COMPU_METHOD {owner} 引用的 {ref} 未定义")
+
+        for ref, owner, line_no in self._layout_refs:
+            if ref not in self._layouts:
+                self.report(RULE_RECORD_LAYOUT, line_no, f"{owner} 引用的 RECORD_LAYOUT {ref} 未定义")
+
+        # 标定对象地址区间排序后只需比较相邻区间
+        ranges = []
+        for addr, name, kind, layout, count, line_no in self._addr_objs:
+            elem = self._layouts.get(layout, 0)
+            # 地址 0 为未回填的占位地址（SYMBOL_LINK 待 a2ltool 更新）
+            if not addr or elem == 0:
+                continue
+            ranges.append((addr, addr + elem * count, name, line_no))
+        ranges.sort()
+        end_max = None
+        owner = None
+        for start, end, name, line_no in ranges:
+            if end_max is not None and start < end_max:
+                self.report(RULE_OVERLAP, line_no,
+                            f"{name} [0x{start:X}, 0x{end:X}) 与 {owner} 地址重叠")
+            if end_max is None or end > end_max:
+                end_max = end
+                owner = name
+
+        # 只保留启用的检查项
+        for rule in list(self.diagnostics.keys()):
+            if rule not in self.checks:
+                del self.diagnostics[rule]
+
+
+def lint_a2l(file_path, output_path=None, keyword_map=None, checks=None, encoding='utf-8'):
+    """
+    单遍处理 A2L：规范化关键字、检查一致性并写出结果
+    output_path 为 None 时原地修改（仅在内容有变化时替换原文件）
+    返回 A2lLinter，包含 diagnostics 与 keyword_changes
+    """
+    linter = A2lLinter(keyword_map, checks)
+    target = output_path or file_path
+    out_dir = os.path.dirname(os.path.abspath(target))
+
+    fd, tmp_path = tempfile.mkstemp(prefix='.a2lcheck_', dir=out_dir)
+    try:
+        # 先接管 fd，打开输入失败时也由 with 关闭
+        with os.fdopen(fd, 'w', encoding=encoding, errors='surrogateescape', newline='') as fout, \
+                open(file_path, 'r', encoding=encoding, errors='surrogateescape', newline='') as fin:
+            for line in fin:
+                fout.write(linter.process_line(line))
+        linter.finish()
+
+        if output_path is not None or linter.keyword_changes > 0:
+            # mkstemp 建立的文件权限为 0600，替换前沿用原文件的权限
+            shutil.copymode(file_path, tmp_path)
+            os.replace(tmp_path, target)
+        else:
+            os.remove(tmp_path)
+    except Exception:
+        if os.path.exists(tmp_path):
+            os.remove(tmp_path)
+        raise
+
+    return linter
+
+
+def print_diagnostics(linter, log_callback=None, limit=20):
+    """按规则输出诊断信息"""
+    out = log_callback if log_callback else print
+
+    out(f"关键字规范化: {linter.keyword_changes} 处")
+    if not linter.diagnostics:
+        out("一致性检查通过")
+        return
+
+    for rule, items in linter.diagnostics.items():
+        out(f"[{rule}] {len(items)} 项")
+        for line_no, message in items[:limit]:
+            out(f"    第 {line_no} 行: {message}")
+        if len(items) > limit:
+            out(f"    ... 省略 {len(items) - limit} 项")
+
+
+def lint_a2l_inplace(file_path, profile=None, checks=None, log_callback=None):
+    """按配置（INCA / APE）原地处理 A2L，返回是否有一致性问题"""
+    keyword_map = KEYWORD_PROFILES.get(profile, {}) if profile else {}
+    linter = lint_a2l(file_path, keyword_map=keyword_map, checks=checks)
+    print_diagnostics(linter, log_callback)
+    return len(linter.diagnostics) == 0
+
+
+def _convert_inplace(file_path, target_params, convert):
+    keyword_map = {p.lower(): convert(p) for p in target_params}
+    linter = lint_a2l(file_path, keyword_map=keyword_map, checks=[])
+    return linter.keyword_changes > 0
+
 
 def convert_custom_params_inplace(file_path, target_params=None):
     """
-    只修改指定的参数列表
+    只修改指定的参数列表（转为大写）
     """
     if target_params is None:
         target_params = ['Protocol_Layer', 'Daq']
-    
-    with open(file_path, 'r', encoding='utf-8') as f:
-        content = f.read()
-    
-    # 创建正则表达式模式，匹配指定的参数
-    params_pattern = '|'.join(re.escape(param) for param in target_params)
-    pattern = rf'(/begin\s+|\bend\s+)({params_pattern})'
-    
-    def to_upper(match):
-        prefix = match.group(1)
-        param_name = match.group(2)
-        
-        # 检查参数是否在目标列表中（不区分大小写）
-        if param_name.lower() in [p.lower() for p in target_params]:
-            return prefix + param_name.upper()
-        else:
-            return match.group(0)
-    
-    converted_content = re.sub(pattern, to_upper, content, flags=re.IGNORECASE)
-    
-    if converted_content != content:
-        with open(file_path, 'w', encoding='utf-8') as f:
-            f.write(converted_content)
-        print(f"文件已更新: {file_path}")
-        return True
-    else:
-        print(f"文件无需修改: {file_path}")
-        return False
-    
+
+    changed = _convert_inplace(file_path, target_params, str.upper)
+    print(f"文件已更新: {file_path}" if changed else f"文件无需修改: {file_path}")
+    return changed
 
 
 def convert_to_title_case_inplace(file_path, target_params=None):
@@ -43,36 +390,11 @@ def convert_to_title_case_inplace(file_path, target_params=None):
     """
     if target_params is None:
         target_params = ['SEGMENT']
-    
-    with open(file_path, 'r', encoding='utf-8') as f:
-        content = f.read()
-    
-    # 创建正则表达式模式，匹配指定的参数
-    params_pattern = '|'.join(re.escape(param) for param in target_params)
-    pattern = rf'(/begin\s+|\bend\s+)({params_pattern})'
-    
-    def to_title_case(match):
-        prefix = match.group(1)
-        param_name = match.group(2)
-        
-        # 检查参数是否在目标列表中（不区分大小写）
-        if param_name.lower() in [p.lower() for p in target_params]:
-            # 转换为首字母大写（每个单词的首字母大写）
-            title_case_name = param_name.title().replace('_', ' ')
-            return prefix + title_case_name
-        else:
-            return match.group(0)
-    
-    converted_content = re.sub(pattern, to_title_case, content, flags=re.IGNORECASE)
-    
-    if converted_content != content:
-        with open(file_path, 'w', encoding='utf-8') as f:
-            f.write(converted_content)
-        print(f"文件已更新（首字母大写）: {file_path}")
-        return True
-    else:
-        print(f"文件无需修改: {file_path}")
-        return False
+
+    changed = _convert_inplace(file_path, target_params, title_case)
+    print(f"文件已更新（首字母大写）: {file_path}" if changed else f"文件无需修改: {file_path}")
+    return changed
+
 
 # 保持下划线版本的首字母大写
 def convert_to_title_case_keep_underscore(file_path, target_params=None):
@@ -81,33 +403,21 @@ def convert_to_title_case_keep_underscore(file_path, target_params=None):
     """
     if target_params is None:
         target_params = ['ELEMENT', 'SEGMENT']
-    
-    with open(file_path, 'r', encoding='utf-8') as f:
-        content = f.read()
-    
-    params_pattern = '|'.join(re.escape(param) for param in target_params)
-    pattern = rf'(/begin\s+|\bend\s+)({params_pattern})'
-    
-    def to_title_case_underscore(match):
-        prefix = match.group(1)
-        param_name = match.group(2)
-        
-        if param_name.lower() in [p.lower() for p in target_params]:
-            # 保持下划线的首字母大写
-            parts = param_name.split('_')
-            title_parts = [part.title() for part in parts]
-            title_case_name = '_'.join(title_parts)
-            return prefix + title_case_name
-        else:
-            return match.group(0)
-    
-    converted_content = re.sub(pattern, to_title_case_underscore, content, flags=re.IGNORECASE)
-    
-    if converted_content != content:
-        with open(file_path, 'w', encoding='utf-8') as f:
-            f.write(converted_content)
-        print(f"文件已更新（首字母大写，保持下划线）: {file_path}")
-        return True
-    else:
-        print(f"文件无需修改: {file_path}")
-        return False
\ No newline at end of file
+
+    changed = _convert_inplace(file_path, target_params, title_case_keep_underscore)
+    print(f"文件已更新（首字母大写，保持下划线）: {file_path}" if changed else f"文件无需修改: {file_path}")
+    return changed
+
+
+if __name__ == '__main__':
+    if len(sys.argv) < 2:
+        print("用法: python A2lCheck.py input.a2l [INCA|APE] [output.a2l]")
+        sys.exit(1)
+
+    in_file = sys.argv[1]
+    in_profile = sys.argv[2] if len(sys.argv) > 2 else None
+    out_file = sys.argv[3] if len(sys.argv) > 3 else None
+
+    result = lint_a2l(in_file, out_file, KEYWORD_PROFILES.get(in_profile, {}))
+    print_diagnostics(result)
+    sys.exit(0 if not result.diagnostics else 2)
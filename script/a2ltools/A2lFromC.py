@@ -0,0 +1,375 @@
+"""
+从 C 源码生成 A2L 片段
+
+根据配置文件中列出的变量，解析驱动/Pfm 源码中的宏、枚举、结构体和变量定义，生成：
+    1. MEASUREMENT：运行时状态（static/全局变量），数组使用 MATRIX_DIM，结构体按元素展开
+    2. CHARACTERISTIC：const 配置表（VALUE / VAL_BLK）
+    3. BIT_MASK 子测量：SYS_DIAG / DSOV 等寄存器按位域解码
+    4. COMPU_VTAB：枚举类型（如 PFM_DefectDetectState_e）和 boolean
+地址使用 SYMBOL_LINK 占位，由 a2ltool --update 从 ELF 中回填。
+位域子测量与原始寄存器共用地址，DaqOptimizer 合并后不会增加 DAQ 负载。
+
+示例：
+    python A2lFromC.py A2lFromC.json drivers.a2l
+    python A2lFromC.py A2lFromC.json drivers.a2l --base input.a2l --elf app.elf --output output.a2l
+"""
+import argparse
+import json
+import os
+import re
+import sys
+
+from run_a2l import run_a2l_merge, run_a2l_update
+
+# C 基本类型 -> (A2L 数据类型, 长度, 最小值, 最大值)
+BASE_TYPES = {
+    'uint8': ('UBYTE', 1, 0, 0xFF),
+    'sint8': ('SBYTE', 1, -0x80, 0x7F),
+    'boolean': ('UBYTE', 1, 0, 1),
+    'uint16': ('UWORD', 2, 0, 0xFFFF),
+    'sint16': ('SWORD', 2, -0x8000, 0x7FFF),
+    'uint32': ('ULONG', 4, 0, 0xFFFFFFFF),
+    'sint32': ('SLONG', 4, -0x80000000, 0x7FFFFFFF),
+    'float32': ('FLOAT32_IEEE', 4, -3.4e38, 3.4e38),
+    'float64': ('FLOAT64_IEEE', 8, -1.7e308, 1.7e308),
+}
+
+ENUM_DATATYPE = {1: 'UBYTE', 2: 'UWORD', 4: 'ULONG'}
+
+COMMENT_PATTERN = re.compile(r'/\*.*?\*/|//[^\n]*', re.S)
+DEFINE_PATTERN = re.compile(r'^\s*#\s*define\s+(\w+)\s+([^\n]+)$', re.M)
+ENUM_PATTERN = re.compile(r'(typedef\s+)?enum\s*\w*\s*\{([^}]*)\}\s*(\w*)\s*;', re.S)
+STRUCT_PATTERN = re.compile(r'typedef\s+struct\s*\w*\s*\{([^}]*)\}\s*(\w+)\s*;', re.S)
+MEMBER_PATTERN = re.compile(r'^\s*(?:const\s+)?(\w+)\s*(\*?)\s*(\w+)\s*((?:\[[^\]]+\]\s*)*);', re.M)
+VARIABLE_PATTERN = re.compile(
+    r'^(static\s+)?(const\s+)?(\w+)\s+(\w+)\s*((?:\[[^\]]+\]\s*)*)(=|;)', re.M)
+SUFFIX_PATTERN = re.compile(r'\b(0x[0-9a-fA-F]+|\d+)[uUlL]+\b')
+# C 强制类型转换，如 (uint16)DTC_MAX，求值前去掉
+CAST_PATTERN = re.compile(r'\(\s*(?:const\s+)?(?:[us]int(?:8|16|32|64)|boolean|float(?:32|64))\s*\)')
+IDENT_PATTERN = re.compile(r'\b[A-Za-z_]\w*\b')
+
+
+class CModel:
+    """源码中的宏、枚举、结构体和文件作用域变量"""
+
+    def __init__(self):
+        self.macros = {}
+        self.values = {}
+        self.enums = {}
+        self.structs = {}
+        self.variables = {}
+
+    def load(self, paths):
+        sources = []
+        for path in paths:
+            for root, _, files in os.walk(path):
+                for name in sorted(files):
+                    if name.endswith(('.h', '.c')):
+                        sources.append(os.path.join(root, name))
+
+        texts = []
+        for file_path in sources:
+            with open(file_path, 'r', encoding='utf-8', errors='ignore') as f:
+                texts.append((file_path, COMMENT_PATTERN.sub('', f.read())))
+
+        # 只记录维度和枚举值的表达式文本，导出变量时才求值，
+        # 未导出的符号即使含有无法解析的表达式也不影响生成
+        for _, text in texts:
+            for m in DEFINE_PATTERN.finditer(text):
+                self.macros[m.group(1)] = m.group(2).strip()
+            for m in ENUM_PATTERN.finditer(text):
+                self._parse_enum(m.group(2), m.group(3))
+        for _, text in texts:
+            for m in STRUCT_PATTERN.finditer(text):
+                self.structs[m.group(2)] = [
+                    (mm.group(1), mm.group(3), mm.group(4))
+                    for mm in MEMBER_PATTERN.finditer(m.group(1)) if not mm.group(2)
+                ]
+        for file_path, text in texts:
+            for m in VARIABLE_PATTERN.finditer(text):
+                if m.group(3) in ('return', 'typedef', 'extern'):
+                    continue
+                name = m.group(4)
+                # extern 声明以 extern 开头，不会被匹配，这里只记录定义
+                self.variables[name] = {
+                    'type': m.group(3),
+                    'const': m.group(2) is not None,
+                    'dims': m.group(5),
+                    'file': file_path,
+                }
+
+    def _parse_enum(self, body, name):
+        base, offset = '-1', 0
+        members = []
+        for item in body.split(','):
+            item = item.strip()
+            if not item:
+                continue
+            if '=' in item:
+                key, base = item.split('=', 1)
+                key, offset = key.strip(), 0
+            else:
+                key = item
+                offset += 1
+            self.values[key] = f"({base}) + {offset}" if offset else base
+            members.append(key)
+        if name:
+            self.enums[name] = members
+
+    def enum_members(self, name):
+        return [(key, self.value(key)) for key in self.enums[name]]
+
+    def value(self, key, depth=0):
+        """枚举成员的值，首次使用时求值并缓存"""
+        value = self.values[key]
+        if isinstance(value, str):
+            value = self.eval(value, depth + 1)
+            self.values[key] = value
+        return value
+
+    def eval(self, expr, depth=0):
+        """计算宏/枚举表达式"""
+        if depth > 16:
+            raise ValueError(f"宏展开层数过深: {expr}")
+        expr = SUFFIX_PATTERN.sub(r'\1', CAST_PATTERN.sub('', expr.strip()))
+
+        def resolve(m):
+            ident = m.group(0)
+            if ident in self.values:
+                return str(self.value(ident, depth))
+            if ident in self.macros:
+                return str(self.eval(self.macros[ident], depth + 1))
+            raise ValueError(f"无法解析标识符: {ident}")
+
+        expr = IDENT_PATTERN.sub(resolve, expr)
+        # C 的整数除法
+        return int(eval(expr.replace('/', '//'), {'__builtins__': {}}, {}))
+
+    def dims(self, text):
+        return [self.eval(d) for d in re.findall(r'\[([^\]]+)\]', text)]
+
+
+class A2lWriter:
+    """按 A2L 对象类别收集文本，最后一次性输出"""
+
+    def __init__(self, model, config):
+        self.model = model
+        self.enum_size = config.get('enum_size', 4)
+        self.bitfields = config.get('bitfields', {})
+        self.compu_methods = {}
+        self.compu_tabs = {}
+        self.record_layouts = {}
+        self.measurements = []
+        self.characteristics = []
+        self.groups = {}
+
+    def type_info(self, c_type):
+        """返回 (A2L 数据类型, 转换方法, 下限, 上限)，不支持的类型返回 None"""
+        if c_type in self.model.enums:
+            members = self.model.enum_members(c_type)
+            return (ENUM_DATATYPE[self.enum_size], self.vtab(c_type, members),
+                    min(v for _, v in members), max(v for _, v in members))
+        if c_type == 'boolean':
+            return ('UBYTE', self.vtab('boolean', [('FALSE', 0), ('TRUE', 1)]), 0, 1)
+        if c_type in BASE_TYPES:
+            dtype, _, lower, upper = BASE_TYPES[c_type]
+            return (dtype, 'NO_COMPU_METHOD', lower, upper)
+        return None
+
+    def vtab(self, name, members):
+        method = f"CM_{name}"
+        if method not in self.compu_methods:
+            tab = f"VTAB_{name}"
+            # 不输出 xxx_SIZE / xxx_MAX 等计数哨兵
+            members = [(k, v) for k, v in members if not k.endswith(('_SIZE', '_MAX'))]
+            rows = ''.join(f'\n      {v} "{k}"' for k, v in members)
+            self.compu_tabs[tab] = (
+                f'    /begin COMPU_VTAB {tab} "" TAB_VERB {len(members)}{rows}\n'
+                f'    /end COMPU_VTAB\n')
+            self.compu_methods[method] = (
+                f'    /begin COMPU_METHOD {method} "" TAB_VERB "%.0" ""\n'
+                f'      COMPU_TAB_REF {tab}\n'
+                f'    /end COMPU_METHOD\n')
+        return method
+
+    def record_layout(self, dtype):
+        name = f"RL_{dtype}"
+        self.record_layouts[name] = (
+            f'    /begin RECORD_LAYOUT {name}\n'
+            f'      FNC_VALUES 1 {dtype} ROW_DIR DIRECT\n'
+            f'    /end RECORD_LAYOUT\n')
+        return name
+
+    def bits_for(self, struct, member, explicit):
+        """位域定义：显式引用的集合优先，其次按 "结构体.成员" 查找"""
+        spec = self.bitfields.get(explicit) if explicit else None
+        if spec is None and struct is not None:
+            spec = self.bitfields.get(f"{struct}.{member}")
+        if spec is None:
+            return []
+        if isinstance(spec, dict):
+            width = spec.get('width', 1)
+            first = spec.get('first', 0)
+            field_mask = (1 << width) - 1
+            return [(spec['name'].format(n=first + i), field_mask << (i * width))
+                    for i in range(spec['count'])]
+        return [(b['name'], int(str(b['mask']), 0)) for b in spec]
+
+    def add(self, symbol, c_type, dims, const, group, bits=None):
+        """添加一个变量，结构体按元素展开"""
+        self._add(symbol, symbol, c_type, dims, const, group, None, None, bits)
+
+    def _add(self, name, link, c_type, dims, const, group, struct, member, bits):
+        if c_type in self.model.structs:
+            for index in self._indices(dims):
+                suffix = ''.join(f'[{i}]' for i in index)
+                for m_type, m_name, m_dims in self.model.structs[c_type]:
+                    self._add(f"{name}{suffix}.{m_name}", f"{link}{suffix}.{m_name}",
+                              m_type, self.model.dims(m_dims), const, group, c_type, m_name, bits)
+            return
+
+        info = self.type_info(c_type)
+        if info is None:
+            print(f"⚠️ 跳过不支持的类型: {c_type} {name}")
+            return
+
+        self._emit(name, link, info, dims, const, group)
+
+        fields = self.bits_for(struct, member, bits)
+        if fields and dims and not const:
+            # 数组按元素展开位域，保持每个子测量只引用一个地址
+            for index in self._indices(dims):
+                suffix = ''.join(f'[{i}]' for i in index)
+                for field, mask in fields:
+                    self._emit_bit(f"{name}{suffix}.{field}", f"{link}{suffix}", info[0], mask, group)
+        elif fields and not const:
+            for field, mask in fields:
+                self._emit_bit(f"{name}.{field}", link, info[0], mask, group)
+
+    @staticmethod
+    def _indices(dims):
+        indices = [()]
+        for d in dims:
+            indices = [i + (k,) for i in indices for k in range(d)]
+        return indices
+
+    @staticmethod
+    def _matrix_dim(dims):
+        if not dims or (len(dims) == 1 and dims[0] == 1):
+            return ''
+        return f"      MATRIX_DIM {' '.join(str(d) for d in dims)}\n"
+
+    def _emit(self, name, link, info, dims, const, group):
+        dtype, conv, lower, upper = info
+        if const:
+            kind = 'VAL_BLK' if self._matrix_dim(dims) else 'VALUE'
+            self.characteristics.append(
+                f'    /begin CHARACTERISTIC {name} "" {kind} 0x0 {self.record_layout(dtype)} 0 {conv} {lower} {upper}\n'
+                f'{self._matrix_dim(dims)}'
+                f'      SYMBOL_LINK "{link}" 0\n'
+                f'    /end CHARACTERISTIC\n')
+            self.groups.setdefault(group, ([], []))[1].append(name)
+        else:
+            self.measurements.append(
+                f'    /begin MEASUREMENT {name} "" {dtype} {conv} 0 0 {lower} {upper}\n'
+                f'      ECU_ADDRESS 0x0\n'
+                f'{self._matrix_dim(dims)}'
+                f'      SYMBOL_LINK "{link}" 0\n'
+                f'    /end MEASUREMENT\n')
+            self.groups.setdefault(group, ([], []))[0].append(name)
+
+    def _emit_bit(self, name, link, dtype, mask, group):
+        upper = mask
+        while upper and not upper & 1:
+            upper >>= 1
+        self.measurements.append(
+            f'    /begin MEASUREMENT {name} "" {dtype} NO_COMPU_METHOD 0 0 0 {upper}\n'
+            f'      ECU_ADDRESS 0x0\n'
+            f'      BIT_MASK 0x{mask:X}\n'
+            f'      SYMBOL_LINK "{link}" 0\n'
+            f'    /end MEASUREMENT\n')
+        self.groups.setdefault(group, ([], []))[0].append(name)
+
+    def write(self, output, project, module):
+        parts = ['ASAP2_VERSION 1 71\n',
+                 f'/begin PROJECT {project} ""\n',
+                 f'  /begin MODULE {module} ""\n']
+        parts += self.compu_methods.values()
+        parts += self.compu_tabs.values()
+        parts += self.record_layouts.values()
+        parts += self.measurements
+        parts += self.characteristics
+        for group, (meas, chars) in self.groups.items():
+            parts.append(f'    /begin GROUP {group} "" ROOT\n')
+            if meas:
+                parts.append('      /begin REF_MEASUREMENT\n')
+                parts += [f'        {n}\n' for n in meas]
+                parts.append('      /end REF_MEASUREMENT\n')
+            if chars:
+                parts.append('      /begin REF_CHARACTERISTIC\n')
+                parts += [f'        {n}\n' for n in chars]
+                parts.append('      /end REF_CHARACTERISTIC\n')
+            parts.append('    /end GROUP\n')
+        parts += ['  /end MODULE\n', '/end PROJECT\n']
+
+        with open(output, 'w', encoding='utf-8') as f:
+            f.write(''.join(parts))
+
+
+def generate(config_file, output, log_callback=None):
+    """根据配置生成 A2L 片段，返回 (MEASUREMENT 数, CHARACTERISTIC 数)"""
+    out = log_callback if log_callback else print
+
+    with open(config_file, 'r', encoding='utf-8') as f:
+        config = json.load(f)
+    base_dir = os.path.dirname(os.path.abspath(config_file))
+
+    model = CModel()
+    model.load([os.path.join(base_dir, p) for p in config['sources']])
+
+    writer = A2lWriter(model, config)
+    for obj in config['objects']:
+        symbol = obj['symbol']
+        var = model.variables.get(symbol)
+        if var is None:
+            out(f"❌ 源码中未找到变量: {symbol}")
+            continue
+        writer.add(symbol, var['type'], model.dims(var['dims']), var['const'],
+                   obj.get('group', 'A2lFromC'), obj.get('bits'))
+
+    writer.write(output, config.get('project', 'A2lFromC'), config.get('module', 'A2lFromC'))
+    out(f"✅ 生成完成: {output} (MEASUREMENT {len(writer.measurements)}, "
+        f"CHARACTERISTIC {len(writer.characteristics)})")
+    return len(writer.measurements), len(writer.characteristics)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="从 C 源码生成 A2L 片段")
+    parser.add_argument('config', help="配置文件（JSON）")
+    parser.add_argument('fragment', help="生成的 A2L 片段")
+    parser.add_argument('--base', help="合并到该 A2L 文件")
+    parser.add_argument('--elf', help="ELF 文件，用于回填地址")
+    parser.add_argument('--output', help="合并/更新后的输出文件")
+    parser.add_argument('--update-mode', default="PRESERVE", help="a2ltool 更新模式")
+    args = parser.parse_args()
+
+    generate(args.config, args.fragment)
+
+    if args.base:
+        output = args.output or args.base
+        if args.elf:
+            merge_file = output + ".merge.a2l"
+            run_a2l_merge([args.base, args.fragment], merge_file)
+            run_a2l_update(merge_file, args.elf, output, args.update_mode)
+            if os.path.exists(merge_file):
+                os.remove(merge_file)
+        else:
+            run_a2l_merge([args.base, args.fragment], output)
+    elif args.elf:
+        run_a2l_update(args.fragment, args.elf, args.output or args.fragment, args.update_mode)
+
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,392 @@
+"""
+XCP DAQ 列表优化工具
+
+根据测量变量列表、采样速率和 A2L 文件，生成紧凑的 ODT 布局：
+    1. 从 A2L 中解析 MEASUREMENT 的地址、数据类型和数组维度
+    2. 同一事件通道内，把地址相邻/重叠的变量合并为连续的 ODT 条目
+    3. 按事件通道对 ODT 条目进行装箱（First Fit Decreasing），使 ODT 数最少
+    4. 输出每个采样栅格的 ODT 数量、有效载荷和总线带宽
+
+示例：
+    python DaqOptimizer.py input.a2l meas.csv --transport CANFD --max-dto 64 --budget 500000
+meas.csv 格式（表头必须存在）：
+    name,event
+    sTle941xy_atRegData,10ms
+    Pfm_FaultState,100ms
+"""
+
+import argparse
+import csv
+import json
+import os
+import re
+import sys
+
+# A2L 基本数据类型长度（字节）
+A2L_DATATYPE_SIZE = {
+    'UBYTE': 1, 'SBYTE': 1,
+    'UWORD': 2, 'SWORD': 2,
+    'ULONG': 4, 'SLONG': 4,
+    'A_UINT64': 8, 'A_INT64': 8,
+    'FLOAT16_IEEE': 2, 'FLOAT32_IEEE': 4, 'FLOAT64_IEEE': 8,
+}
+
+# EVENT 的 TIME_UNIT 编码（ASAM XCP）转换为秒
+XCP_TIME_UNIT_SEC = {
+    0: 1e-9, 1: 1e-8, 2: 1e-7, 3: 1e-6, 4: 1e-5,
+    5: 1e-4, 6: 1e-3, 7: 1e-2, 8: 1e-1, 9: 1.0,
+}
+
+# CAN-FD 允许的 DLC 数据长度，帧长度向上取整
+CANFD_DLC_LEN = [0, 1, 2, 3, 4, 5, 6, 7, 8, 12, 16, 20, 24, 32, 48, 64]
+
+# 每种传输层每个 DTO 的额外开销（字节）
+#   CAN/CANFD: 仲裁+控制+CRC 等约 8 字节（估算值，用于带宽对比）
+#   ETH: XCP on Ethernet 头 4 字节 + UDP/IP/MAC 约 46 字节
+TRANSPORT_OVERHEAD = {
+    'CAN': 8,
+    'CANFD': 8,
+    'ETH': 50,
+}
+
+TOKEN_PATTERN = re.compile(r'"(?:[^"\\]|\\.)*"|/\*.*?\*/|//[^\n]*|\S+', re.S)
+
+
+class Measurement:
+    def __init__(self, name, datatype, address, ext=0, count=1):
+        self.name = name
+        self.datatype = datatype
+        self.address = address
+        self.ext = ext
+        self.count = count
+
+    @property
+    def size(self):
+        return A2L_DATATYPE_SIZE.get(self.datatype, 0) * self.count
+
+
+class OdtEntry:
+    def __init__(self, ext, address, size, names):
+        self.ext = ext
+        self.address = address
+        self.size = size
+        self.names = names
+
+
+class Odt:
+    def __init__(self, capacity, reserve=0):
+        self.capacity = capacity
+        self.reserve = reserve
+        self.entries = []
+        self.used = 0
+
+    @property
+    def free(self):
+        return self.capacity - self.used
+
+    def add(self, entry):
+        self.entries.append(entry)
+        self.used += entry.size
+
+
+def parse_int(text):
+    """解析 A2L 中十进制/十六进制整数"""
+    return int(text, 0)
+
+
+def parse_a2l(a2l_file):
+    """
+    解析 A2L 文件，返回 (measurements, events)
+    measurements: {name: Measurement}
+    events: {name: period_s}，由 IF_DATA XCP 中的 EVENT 得到
+    """
+    with open(a2l_file, 'r', encoding='utf-8', errors='ignore') as f:
+        content = f.read()
+
+    tokens = [t for t in TOKEN_PATTERN.findall(content) if not t.startswith('/*') and not t.startswith('//')]
+
+    measurements = {}
+    events = {}
+    i = 0
+    n = len(tokens)
+    while i < n:
+        tok = tokens[i]
+        if tok == '/begin' and i + 1 < n:
+            block = tokens[i + 1].upper()
+            if block == 'MEASUREMENT':
+                i = _parse_measurement(tokens, i + 2, measurements)
+                continue
+            if block == 'EVENT':
+                i = _parse_event(tokens, i + 2, events)
+                continue
+        i += 1
+
+    return measurements, events
+
+
+def _parse_measurement(tokens, i, measurements):
+    # MEASUREMENT name "long id" datatype conversion resolution accuracy lower upper ...
+    name = tokens[i]
+    datatype = tokens[i + 2].upper()
+    address = 0
+    ext = 0
+    count = 1
+    depth = 0
+    j = i + 8
+    while j < len(tokens):
+        tok = tokens[j]
+        if tok == '/begin':
+            depth += 1
+        elif tok == '/end':
+            if depth == 0:
+                j += 2
+                break
+            depth -= 1
+        elif depth == 0:
+            key = tok.upper()
+            if key == 'ECU_ADDRESS':
+                address = parse_int(tokens[j + 1])
+            elif key == 'ECU_ADDRESS_EXTENSION':
+                ext = parse_int(tokens[j + 1])
+            elif key == 'ARRAY_SIZE':
+                count = parse_int(tokens[j + 1])
+            elif key == 'MATRIX_DIM':
+                count = 1
+                k = j + 1
+                while k < len(tokens) and re.match(r'^(0x[0-9a-fA-F]+|\d+)$', tokens[k]):
+                    count *= parse_int(tokens[k])
+                    k += 1
+        j += 1
+
+    measurements[name] = Measurement(name, datatype, address, ext, count)
+    return j
+
+
+def _parse_event(tokens, i, events):
+    # EVENT "name" "short name" channel_no DAQ max_daq_list time_cycle time_unit priority
+    try:
+        name = tokens[i].strip('"')
+        time_cycle = parse_int(tokens[i + 5])
+        time_unit = parse_int(tokens[i + 6])
+        period = time_cycle * XCP_TIME_UNIT_SEC.get(time_unit, 1e-3)
+        if period > 0:
+            events[name] = period
+    except (IndexError, ValueError):
+        pass
+
+    j = i
+    while j < len(tokens) and not (tokens[j] == '/end' and j + 1 < len(tokens) and tokens[j + 1].upper() == 'EVENT'):
+        j += 1
+    return j + 2
+
+
+def parse_rate(text, events):
+    """
+    解析采样速率：优先匹配 A2L 中的事件名，其次支持 10ms / 1s / 100Hz 写法
+    返回 (event_name, period_s)
+    """
+    if text in events:
+        return text, events[text]
+
+    m = re.match(r'^\s*([\d.]+)\s*(us|ms|s|hz)\s*$', text, re.I)
+    if not m:
+        raise ValueError(f"无法识别的采样速率: {text}")
+
+    value = float(m.group(1))
+    unit = m.group(2).lower()
+    if unit == 'hz':
+        period = 1.0 / value
+    else:
+        period = value * {'us': 1e-6, 'ms': 1e-3, 's': 1.0}[unit]
+    return text, period
+
+
+def read_measure_list(list_file):
+    """读取测量列表 CSV，返回 [(name, rate_text)]"""
+    items = []
+    with open(list_file, 'r', encoding='utf-8') as f:
+        for row in csv.DictReader(f):
+            name = (row.get('name') or '').strip()
+            rate = (row.get('event') or row.get('rate') or '').strip()
+            if name and rate:
+                items.append((name, rate))
+    return items
+
+
+def merge_entries(meas_list, max_gap=0):
+    """
+    把同一事件通道的变量按地址排序，合并重叠或相邻（间隙 <= max_gap）的区域为连续条目
+    """
+    entries = []
+    for meas in sorted(meas_list, key=lambda m: (m.ext, m.address)):
+        if meas.size == 0:
+            continue
+        if entries:
+            last = entries[-1]
+            last_end = last.address + last.size
+            if meas.ext == last.ext and meas.address <= last_end + max_gap:
+                new_end = max(last_end, meas.address + meas.size)
+                last.size = new_end - last.address
+                last.names.append(meas.name)
+                continue
+        entries.append(OdtEntry(meas.ext, meas.address, meas.size, [meas.name]))
+    return entries
+
+
+def split_entries(entries, max_entry_size):
+    """ODT 条目长度受 MAX_ODT_ENTRY_SIZE_DAQ 限制，超长区域拆分为多个条目"""
+    result = []
+    for entry in entries:
+        offset = 0
+        while offset < entry.size:
+            size = min(max_entry_size, entry.size - offset)
+            result.append(OdtEntry(entry.ext, entry.address + offset, size, entry.names))
+            offset += size
+    return result
+
+
+def pack_odts(entries, odt_payload, max_entries_per_odt, first_odt_reserve=0):
+    """
+    First Fit Decreasing 装箱：条目按长度降序，放入第一个能容纳的 ODT
+    first_odt_reserve: 第一个 ODT 预留的字节（时间戳）
+    """
+    odts = []
+    for entry in sorted(entries, key=lambda e: e.size, reverse=True):
+        target = None
+        for odt in odts:
+            if odt.free >= entry.size and len(odt.entries) < max_entries_per_odt:
+                target = odt
+                break
+        if target is None:
+            reserve = first_odt_reserve if not odts else 0
+            target = Odt(odt_payload - reserve, reserve)
+            odts.append(target)
+        target.add(entry)
+    return odts
+
+
+def dto_wire_bytes(odt, pid_size, transport):
+    """单个 DTO 在总线上的字节数（含 PID、CAN-FD DLC 填充和传输层开销）"""
+    payload = pid_size + odt.reserve + odt.used
+    if transport == 'CANFD':
+        payload = next((l for l in CANFD_DLC_LEN if l >= payload), CANFD_DLC_LEN[-1])
+    elif transport == 'CAN':
+        payload = 8
+    return payload + TRANSPORT_OVERHEAD.get(transport, 0)
+
+
+def optimize(a2l_file, list_file, max_dto=8, max_entry_size=None, max_entries_per_odt=255,
+             pid_size=1, timestamp_size=0, transport='CAN', max_gap=0):
+    """
+    执行优化，返回按栅格组织的结果字典
+    """
+    measurements, events = parse_a2l(a2l_file)
+    items = read_measure_list(list_file)
+
+    odt_payload = max_dto - pid_size
+    if max_entry_size is None:
+        max_entry_size = odt_payload
+
+    # 拆分后的条目必须能放进带时间戳的首个 ODT
+    max_entry_size = min(max_entry_size, odt_payload - timestamp_size)
+    if max_entry_size <= 0:
+        raise ValueError("MAX_DTO 过小，无法容纳任何 ODT 条目")
+
+    rasters = {}
+    missing = []
+    for name, rate_text in items:
+        meas = measurements.get(name)
+        if meas is None:
+            missing.append(name)
+            continue
+        event, period = parse_rate(rate_text, events)
+        raster = rasters.setdefault(event, {'period': period, 'meas': []})
+        raster['meas'].append(meas)
+
+    result = {'missing': missing, 'rasters': {}}
+    for event, raster in sorted(rasters.items(), key=lambda kv: kv[1]['period']):
+        merged = merge_entries(raster['meas'], max_gap)
+        entries = split_entries(merged, max_entry_size)
+        odts = pack_odts(entries, odt_payload, max_entries_per_odt, timestamp_size)
+
+        wire_bytes = sum(dto_wire_bytes(odt, pid_size, transport) for odt in odts)
+        payload_bytes = sum(odt.used for odt in odts)
+        naive_odts = len(raster['meas'])
+
+        result['rasters'][event] = {
+            'period_ms': raster['period'] * 1000.0,
+            'signals': len(raster['meas']),
+            'entries': len(entries),
+            'odts': len(odts),
+            'naive_odts': naive_odts,
+            'payload_bytes': payload_bytes,
+            'fill_ratio': payload_bytes / float(sum(odt.capacity for odt in odts)) if odts else 0.0,
+            'bandwidth_bps': wire_bytes * 8.0 / raster['period'],
+            'layout': [
+                [{'ext': e.ext, 'address': hex(e.address), 'size': e.size, 'names': e.names} for e in odt.entries]
+                for odt in odts
+            ],
+        }
+
+    result['total_bandwidth_bps'] = sum(r['bandwidth_bps'] for r in result['rasters'].values())
+    return result
+
+
+def print_report(result, budget=None, log_callback=None):
+    """打印每个栅格的 ODT 数量与带宽"""
+    out = log_callback if log_callback else (lambda s: print(s, end=''))
+
+    for name in result['missing']:
+        out(f"⚠️ A2L 中未找到测量变量: {name}\n")
+
+    out(f"{'栅格':<16}{'周期(ms)':>10}{'信号':>6}{'条目':>6}{'ODT':>6}{'未优化ODT':>10}{'载荷(B)':>9}{'填充率':>8}{'带宽(kbit/s)':>14}\n")
+    for event, r in result['rasters'].items():
+        out(f"{event:<16}{r['period_ms']:>10.2f}{r['signals']:>6}{r['entries']:>6}{r['odts']:>6}"
+            f"{r['naive_odts']:>10}{r['payload_bytes']:>9}{r['fill_ratio'] * 100:>7.1f}%"
+            f"{r['bandwidth_bps'] / 1000.0:>14.1f}\n")
+
+    total = result['total_bandwidth_bps']
+    out(f"\n总带宽: {total / 1000.0:.1f} kbit/s\n")
+    if budget:
+        load = total / float(budget) * 100.0
+        flag = "✅" if load <= 100.0 else "❌"
+        out(f"{flag} 带宽占用: {load:.1f}% (预算 {budget / 1000.0:.1f} kbit/s)\n")
+
+
+def main():
+    parser = argparse.ArgumentParser(description="XCP DAQ ODT 打包优化")
+    parser.add_argument('a2l', help="A2L 文件")
+    parser.add_argument('measure_list', help="测量列表 CSV (name,event)")
+    parser.add_argument('--transport', choices=['CAN', 'CANFD', 'ETH'], default='CAN')
+    parser.add_argument('--max-dto', type=int, default=None, help="MAX_DTO，默认 CAN=8 CANFD=64 ETH=1400")
+    parser.add_argument('--max-entry-size', type=int, default=None, help="MAX_ODT_ENTRY_SIZE_DAQ")
+    parser.add_argument('--max-odt-entries', type=int, default=255, help="每个 ODT 最大条目数")
+    parser.add_argument('--pid-size', type=int, default=1, help="DTO 标识字段长度")
+    parser.add_argument('--timestamp-size', type=int, default=0, help="首个 ODT 的时间戳长度")
+    parser.add_argument('--gap', type=int, default=0, help="允许合并的最大地址间隙（字节）")
+    parser.add_argument('--budget', type=float, default=None, help="带宽预算 bit/s")
+    parser.add_argument('--json', default=None, help="输出 JSON 布局文件")
+    args = parser.parse_args()
+
+    max_dto = args.max_dto
+    if max_dto is None:
+        max_dto = {'CAN': 8, 'CANFD': 64, 'ETH': 1400}[args.transport]
+
+    if not os.path.exists(args.a2l):
+        print(f"❌ A2L 文件不存在: {args.a2l}")
+        return 1
+
+    result = optimize(args.a2l, args.measure_list, max_dto, args.max_entry_size, args.max_odt_entries,
+                      args.pid_size, args.timestamp_size, args.transport, args.gap)
+    print_report(result, args.budget)
+
+    if args.json:
+        with open(args.json, 'w', encoding='utf-8') as f:
+            json.dump(result, f, indent=2, ensure_ascii=False)
+        print(f"✅ ODT 布局已输出: {args.json}")
+
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -4,7 +4,7 @@ import os
 from datetime import datetime
 from run_a2l import run_a2l_merge,run_a2l_update
 import threading
-from A2lCheck import convert_custom_params_inplace,convert_to_title_case_inplace
+from A2lCheck import lint_a2l_inplace
 from time import sleep as timesleep
 
 class A2LToolApp:
@@ -542,10 +542,9 @@ class A2LToolApp:
                     self.log("删除文件失败: " + str(e))
 
             message = f"A2L文件生成成功！\n源文件: {a2l_file}\n输出文件: {output_file}"
-            if Type=="APE":
-                convert_to_title_case_inplace(output_file)
-            elif Type=="INCA":
-                convert_custom_params_inplace(output_file)
+            # 单遍完成关键字规范化和一致性检查
+            if not lint_a2l_inplace(output_file, Type, log_callback=self.log):
+                self.log("A2L一致性检查存在问题，请查看上方诊断信息", "WARNING")
             self.log(message, "SUCCESS")
             
         except Exception as e:
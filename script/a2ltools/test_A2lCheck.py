@@ -0,0 +1,45 @@
+"""
+A2lCheck 回归测试
+
+    1. 紧贴注释结尾的记号（如 /* comment*/）能正确结束注释，跨行注释同样处理
+    2. 输出文件沿用输入文件的权限
+
+示例：
+    python -m unittest test_A2lCheck
+"""
+import os
+import stat
+import tempfile
+import unittest
+
+from A2lCheck import RULE_COMPU_METHOD, RULE_STRUCTURE, lint_a2l
+
+A2L = '''/begin PROJECT P "" /* comment*/
+  /begin MODULE M ""
+    /* multi
+       line */ /begin MEASUREMENT m1 "" UBYTE CM_missing 0 0 0 255 /**/
+      ECU_ADDRESS 0x100
+    /end MEASUREMENT
+  /end MODULE
+/end PROJECT
+'''
+
+
+class A2lCheckTest(unittest.TestCase):
+
+    def test_comment_and_mode(self):
+        with tempfile.TemporaryDirectory() as tmp:
+            src = os.path.join(tmp, 'in.a2l')
+            dst = os.path.join(tmp, 'out.a2l')
+            with open(src, 'w', encoding='utf-8') as f:
+                f.write(A2L)
+            os.chmod(src, 0o644)
+            linter = lint_a2l(src, dst)
+            mode = stat.S_IMODE(os.stat(dst).st_mode)
+        self.assertNotIn(RULE_STRUCTURE, linter.diagnostics)
+        self.assertEqual(len(linter.diagnostics.get(RULE_COMPU_METHOD, [])), 1)
+        self.assertEqual(mode, 0o644)
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -0,0 +1,52 @@
+"""
+A2lFromC 回归测试
+
+    1. 用仓库里的 A2lFromC.json 对真实源码生成一次，配置的变量必须全部找到
+    2. 宏中的 C 强制类型转换（如 (uint16)DTC_MAX）可以求值
+    3. 未导出变量的数组维度无法解析时不影响生成
+
+示例：
+    python -m unittest test_A2lFromC
+"""
+import os
+import tempfile
+import unittest
+
+from A2lFromC import CModel, generate
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+
+
+class A2lFromCTest(unittest.TestCase):
+
+    def test_real_tree(self):
+        logs = []
+        with tempfile.TemporaryDirectory() as tmp:
+            output = os.path.join(tmp, 'drivers.a2l')
+            meas, chars = generate(os.path.join(HERE, 'A2lFromC.json'), output, logs.append)
+            with open(output, encoding='utf-8') as f:
+                text = f.read()
+        self.assertFalse([line for line in logs if line.startswith('❌')], logs)
+        self.assertGreater(meas, 0)
+        self.assertGreater(chars, 0)
+        self.assertIn('MEASUREMENT Pfm_FaultState ', text)
+
+    def test_cast_and_lazy_dims(self):
+        source = ('#define DTC_MAX 40u\n'
+                  '#define PFM_DTC_WORD_SIZE (((uint16)DTC_MAX + 31u) / 32u)\n'
+                  'typedef enum { A_0 = (uint8)3u, A_1, A_SIZE } A_e;\n'
+                  'static uint32 Pfm_DtcWord[PFM_DTC_WORD_SIZE];\n'
+                  'static uint8 Unused[NOT_DEFINED_ANYWHERE];\n')
+        with tempfile.TemporaryDirectory() as tmp:
+            with open(os.path.join(tmp, 'Pfm.c'), 'w', encoding='utf-8') as f:
+                f.write(source)
+            model = CModel()
+            model.load([tmp])
+        self.assertEqual(model.dims(model.variables['Pfm_DtcWord']['dims']), [2])
+        self.assertEqual(model.enum_members('A_e'), [('A_0', 3), ('A_1', 4), ('A_SIZE', 5)])
+        with self.assertRaises(ValueError):
+            model.dims(model.variables['Unused']['dims'])
+
+
+if __name__ == '__main__':
+    unittest.main()
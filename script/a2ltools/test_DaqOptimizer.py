@@ -0,0 +1,99 @@
+"""
+DaqOptimizer 回归测试
+
+    1. 同一栅格内相邻/重叠的变量合并为一个条目，超长数组按 ODT 载荷拆分
+    2. First Fit Decreasing 装箱结果与手算的 ODT 布局一致
+    3. 首个 ODT 预留时间戳，CAN-FD 按 DLC 长度计算带宽
+
+示例：
+    python -m unittest test_DaqOptimizer
+"""
+import os
+import tempfile
+import unittest
+
+from DaqOptimizer import optimize
+
+A2L = '''/begin PROJECT P ""
+  /begin MODULE M ""
+    /begin MEASUREMENT a "" UBYTE NO_COMPU_METHOD 0 0 0 255
+      ECU_ADDRESS 0x1000
+    /end MEASUREMENT
+    /begin MEASUREMENT b "" UWORD NO_COMPU_METHOD 0 0 0 65535
+      ECU_ADDRESS 0x1001
+    /end MEASUREMENT
+    /begin MEASUREMENT c "" ULONG NO_COMPU_METHOD 0 0 0 4294967295
+      ECU_ADDRESS 0x2000
+    /end MEASUREMENT
+    /begin MEASUREMENT e "" SWORD NO_COMPU_METHOD 0 0 -32768 32767
+      ECU_ADDRESS 0x3000
+    /end MEASUREMENT
+    /begin MEASUREMENT g "" UBYTE NO_COMPU_METHOD 0 0 0 255
+      ECU_ADDRESS 0x4000
+      MATRIX_DIM 10
+    /end MEASUREMENT
+    /begin MEASUREMENT x "" UBYTE NO_COMPU_METHOD 0 0 0 255
+      ECU_ADDRESS 0x5000
+      ARRAY_SIZE 20
+    /end MEASUREMENT
+    /begin IF_DATA XCP
+      /begin DAQ
+        /begin EVENT "Evt10" "E10" 0 DAQ 255 10 6 0
+        /end EVENT
+      /end DAQ
+    /end IF_DATA
+  /end MODULE
+/end PROJECT
+'''
+
+
+def layout(raster):
+    return [[(int(e['address'], 16), e['size']) for e in odt] for odt in raster['layout']]
+
+
+class DaqOptimizerTest(unittest.TestCase):
+
+    def run_optimize(self, meas_csv, **kwargs):
+        with tempfile.TemporaryDirectory() as tmp:
+            a2l = os.path.join(tmp, 'in.a2l')
+            lst = os.path.join(tmp, 'meas.csv')
+            with open(a2l, 'w', encoding='utf-8') as f:
+                f.write(A2L)
+            with open(lst, 'w', encoding='utf-8') as f:
+                f.write(meas_csv)
+            return optimize(a2l, lst, **kwargs)
+
+    def test_can_merge_split_pack(self):
+        # CAN: 7 字节载荷。a+b 合并为 0x1000/3，g 拆为 0x4000/7 和 0x4007/3
+        # 降序 7,4,3,3,2：[g0] [c, a+b] [g1, e]
+        result = self.run_optimize('name,event\na,Evt10\nb,Evt10\nc,Evt10\ne,Evt10\ng,Evt10\nmissing,Evt10\n',
+                                   max_dto=8, transport='CAN')
+        raster = result['rasters']['Evt10']
+        self.assertEqual(result['missing'], ['missing'])
+        self.assertAlmostEqual(raster['period_ms'], 10.0)
+        self.assertEqual(raster['signals'], 5)
+        self.assertEqual(raster['entries'], 5)
+        self.assertEqual(layout(raster), [[(0x4000, 7)], [(0x2000, 4), (0x1000, 3)], [(0x4007, 3), (0x3000, 2)]])
+        self.assertEqual(raster['payload_bytes'], 19)
+        self.assertAlmostEqual(raster['fill_ratio'], 19.0 / 21.0)
+        # 每个 DTO 8 字节 + 8 字节开销，3 个 DTO 每 10ms
+        self.assertAlmostEqual(raster['bandwidth_bps'], 3 * 16 * 8 / 0.01)
+
+    def test_entry_limit(self):
+        # c, a+b, e 共 9 字节，15 字节载荷放得下，但每个 ODT 只允许 2 个条目，e 进入第二个 ODT
+        result = self.run_optimize('name,event\ne,10ms\nc,10ms\na,10ms\nb,10ms\n',
+                                   max_dto=16, max_entries_per_odt=2, transport='CAN')
+        self.assertEqual(layout(result['rasters']['10ms']), [[(0x2000, 4), (0x1000, 3)], [(0x3000, 2)]])
+
+    def test_canfd_timestamp(self):
+        # CAN-FD 16 字节：载荷 15，首个 ODT 预留 4 字节时间戳只剩 11，条目最长 11
+        # x(20) 拆为 11 + 9：DTO 1+4+11=16 -> DLC 16，1+9=10 -> DLC 12，各加 8 字节开销
+        result = self.run_optimize('name,event\nx,100ms\n', max_dto=16, timestamp_size=4, transport='CANFD')
+        raster = result['rasters']['100ms']
+        self.assertEqual(layout(raster), [[(0x5000, 11)], [(0x500B, 9)]])
+        self.assertAlmostEqual(raster['fill_ratio'], 20.0 / 26.0)
+        self.assertAlmostEqual(raster['bandwidth_bps'], (24 + 20) * 8 / 0.1)
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -0,0 +1,352 @@
+"""
+IO 通道注册表生成工具
+
+以一份 CSV 作为通道配置的唯一来源，生成：
+    1. src/conf/IoChnReg/IoChnReg_Cfg.h / IoChnReg_Cfg.c：逻辑通道枚举、通道表、
+       驱动通道 -> 逻辑通道 / PID 的反查表、PID -> 逻辑通道表
+    2. src/conf/IoChnReg/IoChnReg_Pid.h：PFM_PhysicalId_e 枚举
+    3. src/bsw/Pfm/Pfm_Cfg.c：按 PID 排列的滤波时间、拦截掩码、使能条件和 DTC 表
+    4. 每个硬件变体一条配置记录 cIoChnReg_atVariant[]：各驱动的有效通道数 / 组数 / 芯片数
+       和有效 PID 列表，附带 CRC16（CRC-16/CCITT-FALSE），IoChnReg_Init 按变体编码选择并校验
+所有表都以数组下标直接查找（O(1)），反查表中未使用的位置为 0（DUMMY）。
+驱动只循环当前变体的有效通道，所以每个变体的 VN7X/BJT 通道号、TLE 组号和芯片号必须从 0 连续排列。
+
+CSV 列：
+    Name          逻辑通道名，生成 IOCHNREG_CHN_<Name> 和 PFM_PID_<Name>
+    Driver        VN7X / BJT / TLE941XY / TLE9210X
+    Group, Chip   驱动内的组号和芯片号（VN7X/BJT 填 0）
+    Channel       驱动内的通道号（从 0 开始）
+    Diag          Y：分配 PID 并接入 Pfm；N：只注册通道
+    Variants      装配该通道的变体，用 | 分隔，如 HIGH|LOW；空表示所有变体
+    FilterSet, FilterClr, InterceptMask, EncMask, DtcVcc, DtcGnd, DtcOl  Pfm 配置，空则取默认值
+
+示例：
+    python csv2chnreg.py
+    python csv2chnreg.py ../../src/conf/IoChnReg/IoChnReg.csv --root ../..
+"""
+import argparse
+import csv
+import os
+import sys
+
+# 驱动 -> (C 前缀, 使能宏, HwCfg 头文件, 反查表维度)
+DRIVERS = {
+    'VN7X': ('Vn7x', 'IOCHNREG_VN7X_EN', 'Vn7x_HwCfg.h', ['VN7X_ID_MAX']),
+    'BJT': ('Bjt', 'IOCHNREG_BJT_EN', 'Bjt_HwCfg.h', ['BJT_ID_MAX']),
+    'TLE941XY': ('Tle941xy', 'IOCHNREG_TLE941XY_EN', 'Tle941xy_HwCfg.h',
+                 ['TLE941XY_GROUP_MAX', 'TLE941XY_CHIP_MAX', 'TLE941XY_CHANNEL_MAX']),
+    'TLE9210X': ('Tle9210x', 'IOCHNREG_TLE9210X_EN', 'Tle9210x_HwCfg.h',
+                 ['TLE9210X_GROUP_MAX', 'TLE9210X_CHIP_MAX', 'TLE9210X_HB_CHN_MAX']),
+}
+
+# 生成文件头中的版本日期，固定以免每次生成都产生差异
+TODAY = '2026.01.09'
+
+DEFAULTS = {
+    'FilterSet': '0',
+    'FilterClr': '0',
+    'InterceptMask': '0',
+    'EncMask': 'PFM_ENC_ALL',
+    'DtcVcc': 'DTC_MAX',
+    'DtcGnd': 'DTC_MAX',
+    'DtcOl': 'DTC_MAX',
+}
+
+BANNER = """/*****************************************************************************************************************
+******************************************************************************************************************
+*  Copyright (C) .
+*  All rights reserved.
+******************************************************************************************************************
+*  FileName: {name}
+*  Content:  {content}
+*  Category: generated by script/chnreggen/csv2chnreg.py from {source}, do not edit
+******************************************************************************************************************
+*  Revision Management
+*  yyyy.mm.dd    name              version      description
+*  ----------    --------          -------      -----------------------------------
+*  {date}    clipping            v0001        Frist edit
+******************************************************************************************************************
+******************************************************************************************************************/
+"""
+
+
+class Channel:
+    def __init__(self, row, line):
+        self.line = line
+        self.name = row['Name'].strip().upper()
+        self.driver = row['Driver'].strip().upper()
+        if self.driver not in DRIVERS:
+            raise ValueError(f"第 {line} 行：未知驱动 {self.driver}")
+        self.group = int(row['Group'] or 0)
+        self.chip = int(row['Chip'] or 0)
+        self.channel = int(row['Channel'])
+        self.diag = (row.get('Diag') or 'Y').strip().upper() == 'Y'
+        self.variants = [v.strip().upper() for v in (row.get('Variants') or '').split('|') if v.strip()]
+        for key, value in DEFAULTS.items():
+            setattr(self, key, (row.get(key) or '').strip() or value)
+
+    @property
+    def chn_id(self):
+        return f"IOCHNREG_CHN_{self.name}"
+
+    @property
+    def pid(self):
+        return f"PFM_PID_{self.name}" if self.diag else "PFM_PID_DUMMTY"
+
+    def index(self):
+        if len(DRIVERS[self.driver][3]) == 1:
+            return f"[{self.channel}u]"
+        return f"[{self.group}u][{self.chip}u][{self.channel}u]"
+
+
+def load_channels(csv_file):
+    """读取 CSV，检查名称和驱动通道是否重复"""
+    channels = []
+    names = set()
+    slots = set()
+    with open(csv_file, newline='', encoding='utf-8-sig') as f:
+        for line, row in enumerate(csv.DictReader(f), start=2):
+            if not (row.get('Name') or '').strip():
+                continue
+            chn = Channel(row, line)
+            if chn.name in names:
+                raise ValueError(f"第 {line} 行：通道名 {chn.name} 重复")
+            slot = (chn.driver, chn.group, chn.chip, chn.channel)
+            if slot in slots:
+                raise ValueError(f"第 {line} 行：驱动通道 {slot} 已被占用")
+            names.add(chn.name)
+            slots.add(slot)
+            channels.append(chn)
+    return channels
+
+
+def crc16(data):
+    """CRC-16/CCITT-FALSE，与 bswlib/Crc 的 Crc_CalculateCRC16 一致"""
+    crc = 0xFFFF
+    for byte in data:
+        crc ^= byte << 8
+        for _ in range(8):
+            crc = ((crc << 1) ^ 0x1021) if crc & 0x8000 else (crc << 1)
+        crc &= 0xFFFF
+    return crc
+
+
+def _prefix_count(values, what):
+    """有效数量：编号必须从 0 连续，驱动按数量循环"""
+    values = sorted(set(values))
+    if values != list(range(len(values))):
+        raise ValueError(f"{what} 的编号 {values} 不是从 0 连续排列")
+    return len(values)
+
+
+def build_variants(channels):
+    """按变体统计各驱动的有效通道 / 组 / 芯片数和有效 PID，并计算 CRC"""
+    names = []
+    for chn in channels:
+        for name in chn.variants:
+            if name not in names:
+                names.append(name)
+    if not names:
+        names = ['DEFAULT']
+    pids = [chn.pid for chn in channels if chn.diag]
+    pid_size = len(pids) + 1
+    group_max = max([chn.group + 1 for chn in channels if len(DRIVERS[chn.driver][3]) > 1] + [1])
+
+    variants = []
+    for vid, name in enumerate(names):
+        rows = [chn for chn in channels if not chn.variants or name in chn.variants]
+        chn_num = [0] * (len(DRIVERS) + 1)
+        group_num = [0] * (len(DRIVERS) + 1)
+        chip_num = [[0] * group_max for _ in range(len(DRIVERS) + 1)]
+        for drv_idx, drv in enumerate(DRIVERS, start=1):
+            drv_rows = [chn for chn in rows if chn.driver == drv]
+            if len(DRIVERS[drv][3]) == 1:
+                chn_num[drv_idx] = _prefix_count([chn.channel for chn in drv_rows], f"变体 {name} 的 {drv} 通道")
+            else:
+                group_num[drv_idx] = _prefix_count([chn.group for chn in drv_rows], f"变体 {name} 的 {drv} 组")
+                for grp in range(group_num[drv_idx]):
+                    chip_num[drv_idx][grp] = _prefix_count([chn.chip for chn in drv_rows if chn.group == grp],
+                                                           f"变体 {name} 的 {drv} 组 {grp} 芯片")
+        active = [chn.pid for chn in rows if chn.diag]
+        pid_val = [pids.index(pid) + 1 for pid in active]
+        data = [vid, len(active)] + pid_val + [0] * (pid_size - len(active))
+        data += chn_num + group_num + [num for row in chip_num for num in row]
+        variants.append({'name': name, 'pids': active, 'chn_num': chn_num, 'group_num': group_num, 'chip_num': chip_num,
+                         'crc': crc16(data)})
+    return variants, group_max
+
+
+def gen_pid_h(channels, source):
+    out = [BANNER.format(name="IoChnReg_Pid", content="Pfm physical id list", source=source, date=TODAY)]
+    out.append("/* Include Headerfiles  */\n\n#ifndef _IOCHNREG_PID_H\n#define _IOCHNREG_PID_H\n\n")
+    out.append("/*chip of group list order: from left to right, from top to dowm */\n")
+    out.append("typedef enum\n{\n    PFM_PID_DUMMTY,\n\n")
+    for chn in channels:
+        if chn.diag:
+            out.append(f"    {chn.pid},\n")
+    out.append("\n    PFM_PID_SIZE\n} PFM_PhysicalId_e;\n\n#endif // _IOCHNREG_PID_H\n")
+    return ''.join(out)
+
+
+def gen_cfg_h(channels, source):
+    used = {chn.driver for chn in channels}
+    out = [BANNER.format(name="IoChnReg_Cfg", content="IO channel registry configuration header file.", source=source, date=TODAY)]
+    out.append("/* Include Headerfiles  */\n#ifndef _IOCHNREG_CFG_H_\n#define _IOCHNREG_CFG_H_\n\n")
+    out.append('#include "IoChnReg_Types.h"\n#include "IoChnReg_Pid.h"\n\n')
+    for drv, (prefix, en, header, dims) in DRIVERS.items():
+        out.append(f"#define {en:<28}{'STD_ON' if drv in used else 'STD_OFF'}\n")
+    out.append("\n")
+    for drv, (prefix, en, header, dims) in DRIVERS.items():
+        out.append(f'#if({en} == STD_ON)\n#include "{header}"\n#endif\n')
+    out.append("\n/* logical channel ids, 0 is reserved for unused slots of the lookup tables */\ntypedef enum\n{\n")
+    out.append("    IOCHNREG_CHN_DUMMY,\n\n")
+    for chn in channels:
+        out.append(f"    {chn.chn_id},\n")
+    out.append("\n    IOCHNREG_CHN_MAX\n} IoChnReg_ChnIdType;\n\n")
+    variants, group_max = build_variants(channels)
+    out.append("/* TLE groups covered by the variant records */\n")
+    out.append(f"#define IOCHNREG_GROUP_MAX          {group_max}u\n\n")
+    out.append("/* hardware variants, the variant coding selects one of them at init */\ntypedef enum\n{\n")
+    for var in variants:
+        out.append(f"    IOCHNREG_VARIANT_{var['name']},\n")
+    out.append("\n    IOCHNREG_VARIANT_MAX\n} IoChnReg_VariantIdType;\n\n")
+    out.append("extern const IoChnReg_ChnCfgType cIoChnReg_atChnCfg[IOCHNREG_CHN_MAX];\n")
+    out.append("extern const uint8 cIoChnReg_au8PidToChn[PFM_PID_SIZE];\n")
+    for drv, (prefix, en, header, dims) in DRIVERS.items():
+        dim = ''.join(f"[{d}]" for d in dims)
+        out.append(f"#if({en} == STD_ON)\n")
+        out.append(f"extern const uint8 cIoChnReg_au8{prefix}Chn{dim};\n")
+        out.append(f"extern const uint8 cIoChnReg_au8{prefix}Pid{dim};\n")
+        out.append("#endif\n")
+    out.append("\n#endif\n")
+    return ''.join(out)
+
+
+def gen_cfg_c(channels, source):
+    out = [BANNER.format(name="IoChnReg_Cfg", content="IO channel registry configuration source file.", source=source, date=TODAY)]
+    out.append('/* Include Headerfiles  */\n#include "IoChnReg.h"\n\n')
+    variants, group_max = build_variants(channels)
+    out.append("/* Channel, group and chip numbers: VN7X/BJT active channels, TLE active groups and chips per group.\n"
+               "   The CRC covers all fields from u8VariantId on. */\n")
+    out.append("const IoChnReg_VariantType cIoChnReg_atVariant[IOCHNREG_VARIANT_MAX] =\n{\n")
+    for var in variants:
+        pid_list = ', '.join(f"(uint8){pid}" for pid in var['pids']) or '0u'
+        chn_list = ', '.join(f"{num}u" for num in var['chn_num'])
+        group_list = ', '.join(f"{num}u" for num in var['group_num'])
+        chip_list = ', '.join('{' + ', '.join(f"{num}u" for num in row) + '}' for row in var['chip_num'])
+        out.append(f"    {{   /* IOCHNREG_VARIANT_{var['name']} */\n")
+        out.append(f"        .u16Crc = 0x{var['crc']:04X}u,\n")
+        out.append(f"        .u8VariantId = (uint8)IOCHNREG_VARIANT_{var['name']},\n")
+        out.append(f"        .u8PidNum = {len(var['pids'])}u,\n")
+        out.append(f"        .au8Pid = {{{pid_list}}},\n")
+        out.append(f"        .au8ChnNum = {{{chn_list}}},\n")
+        out.append(f"        .au8GroupNum = {{{group_list}}},\n")
+        out.append(f"        .au8ChipNum = {{{chip_list}}},\n")
+        out.append("    },\n")
+    out.append("};\n\n")
+    out.append("/* driver, group, chip, channel, pid */\n")
+    out.append("const IoChnReg_ChnCfgType cIoChnReg_atChnCfg[IOCHNREG_CHN_MAX] =\n{\n")
+    out.append("    {IOCHNREG_DRV_NONE, 0u, 0u, 0u, (uint8)PFM_PID_DUMMTY},    /* IOCHNREG_CHN_DUMMY */\n")
+    for chn in channels:
+        out.append(f"    {{IOCHNREG_DRV_{chn.driver}, {chn.group}u, {chn.chip}u, {chn.channel}u, (uint8){chn.pid}}},"
+                   f"    /* {chn.chn_id} */\n")
+    out.append("};\n\n")
+    out.append("const uint8 cIoChnReg_au8PidToChn[PFM_PID_SIZE] =\n{\n")
+    out.append("    [PFM_PID_DUMMTY] = IOCHNREG_CHN_DUMMY,\n")
+    for chn in channels:
+        if chn.diag:
+            out.append(f"    [{chn.pid}] = {chn.chn_id},\n")
+    out.append("};\n")
+    for drv, (prefix, en, header, dims) in DRIVERS.items():
+        rows = [chn for chn in channels if chn.driver == drv]
+        if not rows:
+            continue
+        dim = ''.join(f"[{d}]" for d in dims)
+        out.append(f"\n#if({en} == STD_ON)\n")
+        out.append(f"const uint8 cIoChnReg_au8{prefix}Chn{dim} =\n{{\n")
+        for chn in rows:
+            out.append(f"    {chn.index()} = {chn.chn_id},\n")
+        out.append("};\n\n")
+        out.append(f"const uint8 cIoChnReg_au8{prefix}Pid{dim} =\n{{\n")
+        for chn in rows:
+            if chn.diag:
+                out.append(f"    {chn.index()} = (uint8){chn.pid},\n")
+        out.append("};\n#endif\n")
+    return ''.join(out)
+
+
+def gen_pfm_cfg_c(channels, source):
+    diag = [chn for chn in channels if chn.diag]
+    out = [BANNER.format(name="Pfm", content="Power device fault management module source file.", source=source, date=TODAY)]
+    out.append('\n/* Include Headerfiles  */\n#include "Pfm.h"\n#include "Pfm_Cfg.h"\n\n')
+    out.append("""/* Module: Pfm Configuration
+   Abbreviations used:
+   PID: Physical ID - identifies the physical fault detection device
+   DDT: Defect Detect Type - type of defect (VCC, GND, OL)
+   DFC: Defect Filter Count - counter for fault filtering
+*/
+
+""")
+
+    def table(decl, dummy, fmt, comment=None):
+        out.append(f"{decl} = \n{{\n")
+        if comment:
+            out.append(f"    {comment}\n")
+        out.append(f"    {dummy},    /* PFM_PID_DUMMTY */\n")
+        for chn in diag:
+            out.append(f"    {fmt(chn)},    /* {chn.pid} */\n")
+        out.append("};\n\n\n")
+
+    table("const uint8 Pfm_DefectFilterTime[PFM_PID_SIZE][PFM_DDT_SIZE][PFM_DFC_SIZE]",
+          "{{0,0},{0,0},{0,0}}",
+          lambda c: "{" + ",".join([f"{{{c.FilterSet},{c.FilterClr}}}"] * 3) + "}")
+    out.append("/* bit0: short to VCC, bit 1: short to GND, bit 2: Open load */\n")
+    table("const uint8 Pfm_InterceptEnableMask[PFM_PID_SIZE]", "0", lambda c: c.InterceptMask)
+    table("const boolean Pfm_InterceptState[PFM_PID_SIZE]", "FALSE", lambda c: "FALSE")
+    out.append("/* configuatre the DTC-ID, need mapping to DEM module and DTC description */\n")
+    table("const uint16 Pfm_DefectDtcId[PFM_PID_SIZE][PFM_DDT_SIZE]",
+          "{DTC_MAX,                 DTC_MAX,                  DTC_MAX}",
+          lambda c: f"{{{c.DtcVcc + ',':<25}{c.DtcGnd + ',':<26}{c.DtcOl}}}",
+          "/* short to battery */    /* short to ground */     /* open load */")
+    out.append("/* enable conditions a PID needs before its defects are filtered, see PFM_EnableCondition_e */\n")
+    table("const uint8 Pfm_EnableConditionMask[PFM_PID_SIZE]", "PFM_ENC_ALL", lambda c: c.EncMask)
+    return ''.join(out)
+
+
+def write(path, text, log_callback=print):
+    """按仓库约定写 CRLF 文件"""
+    os.makedirs(os.path.dirname(path), exist_ok=True)
+    with open(path, 'w', newline='\r\n', encoding='utf-8') as f:
+        f.write(text)
+    log_callback(f"✅ 已生成 {path}")
+
+
+def generate(csv_file, root, log_callback=print):
+    channels = load_channels(csv_file)
+    source = os.path.basename(csv_file)
+    conf_dir = os.path.join(root, 'src', 'conf', 'IoChnReg')
+    write(os.path.join(conf_dir, 'IoChnReg_Pid.h'), gen_pid_h(channels, source), log_callback)
+    write(os.path.join(conf_dir, 'IoChnReg_Cfg.h'), gen_cfg_h(channels, source), log_callback)
+    write(os.path.join(conf_dir, 'IoChnReg_Cfg.c'), gen_cfg_c(channels, source), log_callback)
+    write(os.path.join(root, 'src', 'bsw', 'Pfm', 'Pfm_Cfg.c'), gen_pfm_cfg_c(channels, source), log_callback)
+    log_callback(f"📋 {len(channels)} 个通道，{sum(chn.diag for chn in channels)} 个 PID")
+
+
+def main():
+    here = os.path.dirname(os.path.abspath(__file__))
+    root = os.path.normpath(os.path.join(here, '..', '..'))
+    parser = argparse.ArgumentParser(description="从 CSV 生成 IO 通道注册表")
+    parser.add_argument('csv', nargs='?', default=os.path.join(root, 'src', 'conf', 'IoChnReg', 'IoChnReg.csv'),
+                        help="通道配置 CSV")
+    parser.add_argument('--root', default=root, help="仓库根目录")
+    args = parser.parse_args()
+    try:
+        generate(args.csv, args.root)
+    except ValueError as e:
+        print(f"❌ {e}")
+        return 1
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -15,6 +15,59 @@
 ******************************************************************************************************************/
 /* Include Headerfiles  */
 /* ===================                                                  */
-#include "Platform_Types.h"
+#include "IoWrp_Actor.h"
+#if(IOCHNREG_VN7X_EN == STD_ON)
+#include "Vn7x.h"
+#endif
+#if(IOCHNREG_BJT_EN == STD_ON)
+#include "Bjt.h"
+#endif
+#if(IOCHNREG_TLE941XY_EN == STD_ON)
+#include "Tle941xy.h"
+#endif
+#if(IOCHNREG_TLE9210X_EN == STD_ON)
+#include "Tle9210x.h"
+#endif
+
+Std_ReturnType Actor_Write(IoChnReg_ChnIdType Chn, uint16 Value)
+{
+  const IoChnReg_ChnCfgType *ChnCfgPrt;
+  Std_ReturnType Ret = E_OK;
+
+  if ((Chn == IOCHNREG_CHN_DUMMY) || (Chn >= IOCHNREG_CHN_MAX))
+  {
+    return E_NOT_OK;
+  }
+
+  ChnCfgPrt = IoChnReg_GetCfg(Chn);
+  switch (ChnCfgPrt->u8Drv)
+  {
+#if(IOCHNREG_VN7X_EN == STD_ON)
+    case IOCHNREG_DRV_VN7X:
+      Vn7x_WriteDoChn(ChnCfgPrt->u8Chn, Value);
+      break;
+#endif
+#if(IOCHNREG_BJT_EN == STD_ON)
+    case IOCHNREG_DRV_BJT:
+      Bjt_WriteDoChn(ChnCfgPrt->u8Chn, Value);
+      break;
+#endif
+#if(IOCHNREG_TLE941XY_EN == STD_ON)
+    case IOCHNREG_DRV_TLE941XY:
+      Tle941xy_WriteHbChn(ChnCfgPrt->u8Group, ChnCfgPrt->u8Chip, ChnCfgPrt->u8Chn, (uint8)Value);
+      break;
+#endif
+#if(IOCHNREG_TLE9210X_EN == STD_ON)
+    case IOCHNREG_DRV_TLE9210X:
+      Tle9210x_WriteHbChn(ChnCfgPrt->u8Group, ChnCfgPrt->u8Chip, ChnCfgPrt->u8Chn, (uint8)Value);
+      break;
+#endif
+    default:
+      Ret = E_NOT_OK;
+      break;
+  }
+
+  return Ret;
+}
 
 
@@ -0,0 +1,27 @@
+/*****************************************************************************************************************
+******************************************************************************************************************
+*  Copyright (C) .                                                                            
+*  All rights reserved.                                                                                           
+******************************************************************************************************************
+*  FileName: IoWrp_Actor                                                                                             
+*  Content:  Io wrapper actor module header file.
+*  Category: 
+******************************************************************************************************************
+*  Revision Management                                                                                            
+*  yyyy.mm.dd    name              version      description                                                       
+*  ----------    --------          -------      -----------------------------------                               
+*  2026.01.09    clipping            v0001        Frist edit                                                        
+******************************************************************************************************************
+******************************************************************************************************************/
+/* Include Headerfiles  */
+/* ===================                                                  */
+#ifndef _IOWRP_ACTOR_H_
+#define _IOWRP_ACTOR_H_
+
+#include "Std_Types.h"
+#include "IoChnReg.h"
+
+/* Write a logical output channel, the owning driver is taken from the IO channel registry */
+extern Std_ReturnType Actor_Write(IoChnReg_ChnIdType Chn, uint16 Value);
+
+#endif
@@ -15,50 +15,14 @@
 ******************************************************************************************************************/
 /* Include Headerfiles  */
 /* ===================                                                  */
-#include "Std_Types.h"
+#include "IoWrp_Sensor.h"
+#include "IoWrp_SensorImage.h"
 
-typedef Std_ReturnType (*WriterFunction_b)(boolean value);
-typedef Std_ReturnType (*WriteValue_u8)(uint8 value);
-typedef Std_ReturnType (*WriteValue_u16)(uint16 value);
-typedef Std_ReturnType (*WriterFunction_32)(uint32 value);
-typedef Std_ReturnType (*WriteValue_Prt)(void *value);
-
-typedef Std_ReturnType (*ReadValue)(void *value);
-
-typedef enum
-{
-  BOOLEAN = 0,
-  U8,
-  U16,
-  U32,
-  PRT
-} Sensor_Type;
-
-typedef struct
-{
-  Sensor_Type SensorType;
-  ReadValue ReadAdcValue;
-  uint8 RangeLenth;
-  struct
-  {
-    uint16 AdcValue;
-    uint8 Range;
-  } AdcRange *AdcRanges;
-  union
-  {
-    WriterFunction_b WriteBooleanValue;
-    WriteValue_u8 Write8BitValue;
-    WriteValue_u16 Write16BitValue;
-    WriterFunction_32 Write32BitValue;
-    WriteValue_Prt WritePointerValue;
-  } SensorUnion;
-} SensorAdc;
-
-SensorAdc SensorAdcInstance[] = {
-  { .SensorType = U8, .ReadAdcValue = NULL, .SensorUnion.Write8BitValue = WriterAary[0] },
-  { .SensorType = U16, .ReadAdcValue = NULL, .SensorUnion.Write8BitValue = WriterAary[1] },
-  { .SensorType = PRT, .ReadAdcValue = NULL, .SensorUnion.WritePointerValue = WriterAary[2] },
-  { .SensorType = U8, .ReadAdcValue = NULL, .SensorUnion.Write8BitValue = WriterAary[0] }
+SensorAdc SensorAdcInstance[SENSOR_ADC_NUM] = {
+  { .SensorType = U8, .ReadAdcValue = NULL, .SensorUnion.Write8BitValue = NULL },
+  { .SensorType = U16, .ReadAdcValue = NULL, .SensorUnion.Write16BitValue = NULL },
+  { .SensorType = PRT, .ReadAdcValue = NULL, .SensorUnion.WritePointerValue = NULL },
+  { .SensorType = U8, .ReadAdcValue = NULL, .SensorUnion.Write8BitValue = NULL }
 };
 
 Std_ReturnType Sensor_AdcWriteValue(const SensorAdc *sensorAdcPrt, void *Value)
@@ -89,33 +53,49 @@ Std_ReturnType Sensor_AdcWriteValue(const SensorAdc *sensorAdcPrt, void *Value)
   return Ret;
 }
 
-void Sensor_AdcTransfor(const SensorAdc *sensorAdcPrt)
+/* Index of the first range above the sample, RangeLenth when there is none */
+static uint8 Sensor_AdcClassify(const SensorAdc *sensorAdcPrt)
 {
   uint16 SensorAdc;
-  Std_ReturnType Ret = sensorAdcPrt->ReadAdcValue((uint16 *) &SensorAdc);
-  // Initialization code for sensors can be added here
-  uint8 condition = sensorAdcPrt->RangeLenth;
   uint8 index = 0;
-  while (index < condition)
+
+  (void)sensorAdcPrt->ReadAdcValue((uint16 *) &SensorAdc);
+  while ((index < sensorAdcPrt->RangeLenth) && (SensorAdc >= sensorAdcPrt->AdcRanges[index].AdcValue))
   {
-    if (SensorAdc < sensorAdcPrt->AdcRanges[index].AdcValue)
-    {
-      // Some operation based on the range
-      Ret |= Sensor_AdcWriteValue(sensorAdcPrt, &sensorAdcPrt->AdcRanges[index].Range);
-      break;
-    }
     index++;
   }
+
+  return index;
 }
 
-typedef struct
+void Sensor_AdcTransfor(const SensorAdc *sensorAdcPrt)
 {
-  Sensor_Type SensorType;
-  ReadValue ReadDiValue;
-  WriterFunction_b WriteBooleanValue;
-} SensorDi;
+  uint8 index = Sensor_AdcClassify(sensorAdcPrt);
 
-SensorDi SensorDiInstance[] = {
+  if (index < sensorAdcPrt->RangeLenth)
+  {
+    (void)Sensor_AdcWriteValue(sensorAdcPrt, &sensorAdcPrt->AdcRanges[index].Range);
+  }
+}
+
+/* Cyclic update of one ADC sensor: push through the writer and/or publish to the image slot */
+static void Sensor_AdcUpdate(const SensorAdc *sensorAdcPrt, uint8 Slot)
+{
+  uint8 index = Sensor_AdcClassify(sensorAdcPrt);
+
+  if (index < sensorAdcPrt->RangeLenth)
+  {
+#if (SENSOR_PUSH_EN == STD_ON)
+    (void)Sensor_AdcWriteValue(sensorAdcPrt, &sensorAdcPrt->AdcRanges[index].Range);
+#endif
+#if (SENSOR_IMAGE_EN == STD_ON)
+    Sensor_ImageWrite(Slot, (uint32)sensorAdcPrt->AdcRanges[index].Range);
+#endif
+  }
+  (void)Slot;
+}
+
+SensorDi SensorDiInstance[SENSOR_DI_NUM] = {
   { .SensorType = BOOLEAN, .ReadDiValue = NULL, .WriteBooleanValue = NULL },
   { .SensorType = BOOLEAN, .ReadDiValue = NULL, .WriteBooleanValue = NULL }
 };
@@ -126,21 +106,38 @@ void Sensor_DiTransfor(const SensorDi *SensorDiPrt)
   Std_ReturnType Ret = SensorDiPrt->ReadDiValue(&SensorDi);
 
   Ret |= SensorDiPrt->WriteBooleanValue(SensorDi);
-  break;
+}
+
+static void Sensor_DiUpdate(const SensorDi *SensorDiPrt, uint8 Slot)
+{
+  boolean SensorDi = FALSE;
+
+  (void)SensorDiPrt->ReadDiValue(&SensorDi);
+#if (SENSOR_PUSH_EN == STD_ON)
+  (void)SensorDiPrt->WriteBooleanValue(SensorDi);
+#endif
+#if (SENSOR_IMAGE_EN == STD_ON)
+  Sensor_ImageWrite(Slot, (uint32)SensorDi);
+#endif
+  (void)Slot;
 }
 
 void Sensor_Mainfunction(void)
 {
-  // Initialization code for sensors can be added here
-  SensorAdc *sensorAdcPrt = SensorAdcInstance;
-  for (uint8 SensorId = 0; SensorId < sizeof(SensorAdcInstance) / sizeof(SensorAdc); SensorId++)
+#if (SENSOR_IMAGE_EN == STD_ON)
+  Sensor_ImageOpen();
+#endif
+  for (uint8 SensorId = 0; SensorId < SENSOR_ADC_NUM; SensorId++)
   {
-    Sensor_AdcTransfor(&SensorAdcInstance[SensorId]);
+    Sensor_AdcUpdate(&SensorAdcInstance[SensorId], SENSOR_IMAGE_ADC_SLOT(SensorId));
   }
 
-  SensorDi *SensorDiPrt = SensorDiInstance;
-  for (uint8 SensorId = 0; SensorId < sizeof(SensorDiInstance) / sizeof(SensorDi); SensorId++)
+  for (uint8 SensorId = 0; SensorId < SENSOR_DI_NUM; SensorId++)
   {
-    Sensor_DiTransfor(&SensorDiInstance[SensorId]);
+    Sensor_DiUpdate(&SensorDiInstance[SensorId], SENSOR_IMAGE_DI_SLOT(SensorId));
   }
+#if (SENSOR_IMAGE_EN == STD_ON)
+  /* all sensors of this cycle are in, consumers see them at once */
+  Sensor_ImagePublish();
+#endif
 }
\ No newline at end of file
@@ -0,0 +1,79 @@
+/*****************************************************************************************************************
+******************************************************************************************************************
+*  Copyright (C) .
+*  All rights reserved.
+******************************************************************************************************************
+*  FileName: IoWrp_Sensor
+*  Content:  Io wrapper sensor module header file.
+*  Category:
+******************************************************************************************************************
+*  Revision Management
+*  yyyy.mm.dd    name              version      description
+*  ----------    --------          -------      -----------------------------------
+*  2025.12.31    clipping            v0001        Frist edit
+******************************************************************************************************************
+******************************************************************************************************************/
+/* Include Headerfiles  */
+/* ===================                                                  */
+#ifndef _IOWRP_SENSOR_H_
+#define _IOWRP_SENSOR_H_
+
+#include <stddef.h>
+#include "Std_Types.h"
+
+/* Number of entries in SensorAdcInstance and SensorDiInstance */
+#define SENSOR_ADC_NUM              4u
+#define SENSOR_DI_NUM               2u
+
+typedef Std_ReturnType (*WriterFunction_b)(boolean value);
+typedef Std_ReturnType (*WriteValue_u8)(uint8 value);
+typedef Std_ReturnType (*WriteValue_u16)(uint16 value);
+typedef Std_ReturnType (*WriterFunction_32)(uint32 value);
+typedef Std_ReturnType (*WriteValue_Prt)(void *value);
+
+typedef Std_ReturnType (*ReadValue)(void *value);
+
+typedef enum
+{
+  BOOLEAN = 0,
+  U8,
+  U16,
+  U32,
+  PRT
+} Sensor_Type;
+
+typedef struct
+{
+  uint16 AdcValue;
+  uint8 Range;
+} AdcRange;
+
+typedef struct
+{
+  Sensor_Type SensorType;
+  ReadValue ReadAdcValue;
+  uint8 RangeLenth;
+  AdcRange *AdcRanges;
+  union
+  {
+    WriterFunction_b WriteBooleanValue;
+    WriteValue_u8 Write8BitValue;
+    WriteValue_u16 Write16BitValue;
+    WriterFunction_32 Write32BitValue;
+    WriteValue_Prt WritePointerValue;
+  } SensorUnion;
+} SensorAdc;
+
+typedef struct
+{
+  Sensor_Type SensorType;
+  ReadValue ReadDiValue;
+  WriterFunction_b WriteBooleanValue;
+} SensorDi;
+
+extern Std_ReturnType Sensor_AdcWriteValue(const SensorAdc *sensorAdcPrt, void *Value);
+extern void Sensor_AdcTransfor(const SensorAdc *sensorAdcPrt);
+extern void Sensor_DiTransfor(const SensorDi *SensorDiPrt);
+extern void Sensor_Mainfunction(void);
+
+#endif
@@ -0,0 +1,50 @@
+/*****************************************************************************************************************
+******************************************************************************************************************
+*  Copyright (C) .
+*  All rights reserved.
+******************************************************************************************************************
+*  FileName: IoWrp_SensorImage
+*  Content:  Io wrapper shared sensor image source file.
+*  Category:
+******************************************************************************************************************
+*  Revision Management
+*  yyyy.mm.dd    name              version      description
+*  ----------    --------          -------      -----------------------------------
+*  2026.01.14    clipping            v0001        Frist edit
+******************************************************************************************************************
+******************************************************************************************************************/
+/* Include Headerfiles  */
+/* ===================                                                  */
+#include "IoWrp_SensorImage.h"
+
+SensorImage SensorImageInstance;
+
+/* Start a cycle: the back buffer takes over the front values, so sensors
+   without a new value in this cycle keep their last one. */
+void Sensor_ImageOpen(void)
+{
+  const SensorImageBuf *Front = &SensorImageInstance.Buf[SensorImageInstance.Cycle & 1u];
+  SensorImageBuf *Back = &SensorImageInstance.Buf[(SensorImageInstance.Cycle + 1u) & 1u];
+  uint8 Slot;
+
+  for (Slot = 0u; Slot < SENSOR_IMAGE_SLOT_MAX; Slot++)
+  {
+    Back->Value[Slot] = Front->Value[Slot];
+  }
+}
+
+void Sensor_ImageWrite(uint8 Slot, uint32 Value)
+{
+  if (Slot < SENSOR_IMAGE_SLOT_MAX)
+  {
+    SensorImageInstance.Buf[(SensorImageInstance.Cycle + 1u) & 1u].Value[Slot] = Value;
+  }
+}
+
+/* Swap: the filled back buffer becomes the front buffer */
+void Sensor_ImagePublish(void)
+{
+  /* the back buffer is complete before the cycle publishes it */
+  COMPILER_MEMORY_BARRIER();
+  SensorImageInstance.Cycle++;
+}
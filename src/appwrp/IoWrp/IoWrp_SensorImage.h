@@ -0,0 +1,129 @@
+/*****************************************************************************************************************
+******************************************************************************************************************
+*  Copyright (C) .
+*  All rights reserved.
+******************************************************************************************************************
+*  FileName: IoWrp_SensorImage
+*  Content:  Io wrapper shared sensor image header file.
+*  Category:
+******************************************************************************************************************
+*  Revision Management
+*  yyyy.mm.dd    name              version      description
+*  ----------    --------          -------      -----------------------------------
+*  2026.01.14    clipping            v0001        Frist edit
+******************************************************************************************************************
+******************************************************************************************************************/
+/* Include Headerfiles  */
+/* ===================                                                  */
+#ifndef _IOWRP_SENSORIMAGE_H_
+#define _IOWRP_SENSORIMAGE_H_
+
+#include "IoWrp_Sensor.h"
+
+/* STD_ON: Sensor_Mainfunction publishes every value into SensorImageInstance (pull model) */
+#define SENSOR_IMAGE_EN             STD_ON
+/* STD_ON: values are also pushed through the SensorUnion writers.
+   STD_OFF: no writer is called, consumers read the image only. */
+#define SENSOR_PUSH_EN              STD_ON
+
+/* One 32 bit word per sensor. ADC sensors use the slot of their index in
+   SensorAdcInstance, DI sensors start at SENSOR_IMAGE_DI_BASE. */
+#define SENSOR_IMAGE_SLOT_MAX       32u
+#define SENSOR_IMAGE_DI_BASE        16u
+#define SENSOR_IMAGE_ADC_SLOT(id)   ((uint8)(id))
+#define SENSOR_IMAGE_DI_SLOT(id)    ((uint8)(SENSOR_IMAGE_DI_BASE + (id)))
+
+#if (SENSOR_ADC_NUM > SENSOR_IMAGE_DI_BASE)
+#error SENSOR_ADC_NUM overlaps the DI slots, raise SENSOR_IMAGE_DI_BASE
+#endif
+#if ((SENSOR_IMAGE_DI_BASE + SENSOR_DI_NUM) > SENSOR_IMAGE_SLOT_MAX)
+#error SENSOR_DI_NUM does not fit behind SENSOR_IMAGE_DI_BASE, raise SENSOR_IMAGE_SLOT_MAX
+#endif
+
+/* Data cache line of the target, each buffer starts on its own line.
+   IOWRP_ALIGN comes from Compiler_Cfg.h. */
+#define SENSOR_IMAGE_LINE_SIZE      32
+#ifndef IOWRP_ALIGN
+#error IOWRP_ALIGN is missing, define it in Compiler_Cfg.h (e.g. __attribute__((aligned(size))))
+#endif
+#define SENSOR_IMAGE_ALIGN          IOWRP_ALIGN(SENSOR_IMAGE_LINE_SIZE)
+
+typedef struct
+{
+  volatile uint32 Value[SENSOR_IMAGE_SLOT_MAX];
+} SENSOR_IMAGE_ALIGN SensorImageBuf;
+
+/* Buf[Cycle & 1] is the front buffer. The writer fills the back buffer and
+   publishes it by incrementing Cycle, so a reader only has to retry when a
+   publish happened during its read. */
+typedef struct
+{
+  SensorImageBuf Buf[2];
+  volatile uint32 Cycle;
+} SensorImage;
+
+extern SensorImage SensorImageInstance;
+
+/* Consistent read of several sensors:
+     Cycle = Sensor_ImageCycle();
+     Front = Sensor_ImageFront(Cycle);
+     ... Sensor_ImageGetU8(Front, Slot) ...
+   repeat while Sensor_ImageStable(Cycle) is FALSE. */
+LOCAL_INLINE uint32 Sensor_ImageCycle(void)
+{
+  return SensorImageInstance.Cycle;
+}
+
+LOCAL_INLINE const SensorImageBuf *Sensor_ImageFront(uint32 Cycle)
+{
+  return &SensorImageInstance.Buf[Cycle & 1u];
+}
+
+LOCAL_INLINE boolean Sensor_ImageStable(uint32 Cycle)
+{
+  /* the values are read before the cycle is checked again */
+  COMPILER_MEMORY_BARRIER();
+  return (boolean)(SensorImageInstance.Cycle == Cycle);
+}
+
+LOCAL_INLINE boolean Sensor_ImageGetBool(const SensorImageBuf *Front, uint8 Slot)
+{
+  return (boolean)(Front->Value[Slot] != 0u);
+}
+
+LOCAL_INLINE uint8 Sensor_ImageGetU8(const SensorImageBuf *Front, uint8 Slot)
+{
+  return (uint8)Front->Value[Slot];
+}
+
+LOCAL_INLINE uint16 Sensor_ImageGetU16(const SensorImageBuf *Front, uint8 Slot)
+{
+  return (uint16)Front->Value[Slot];
+}
+
+LOCAL_INLINE uint32 Sensor_ImageGetU32(const SensorImageBuf *Front, uint8 Slot)
+{
+  return Front->Value[Slot];
+}
+
+/* Single sensor read, retried when a publish happened in between */
+LOCAL_INLINE uint32 Sensor_ImageRead(uint8 Slot)
+{
+  uint32 Cycle;
+  uint32 Value;
+
+  do
+  {
+    Cycle = SensorImageInstance.Cycle;
+    Value = SensorImageInstance.Buf[Cycle & 1u].Value[Slot];
+    COMPILER_MEMORY_BARRIER();
+  } while (Cycle != SensorImageInstance.Cycle);
+
+  return Value;
+}
+
+extern void Sensor_ImageOpen(void);
+extern void Sensor_ImageWrite(uint8 Slot, uint32 Value);
+extern void Sensor_ImagePublish(void);
+
+#endif
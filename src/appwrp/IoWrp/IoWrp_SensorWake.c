@@ -0,0 +1,204 @@
+/*****************************************************************************************************************
+******************************************************************************************************************
+*  Copyright (C) .
+*  All rights reserved.
+******************************************************************************************************************
+*  FileName: IoWrp_SensorWake
+*  Content:  Io wrapper low-power cyclic wake sensing source file.
+*  Category:
+******************************************************************************************************************
+*  Revision Management
+*  yyyy.mm.dd    name              version      description
+*  ----------    --------          -------      -----------------------------------
+*  2026.01.05    clipping            v0001        Frist edit
+******************************************************************************************************************
+******************************************************************************************************************/
+/* Include Headerfiles  */
+/* ===================                                                  */
+#include "IoWrp_SensorWake.h"
+
+/* Sensor supplies switched on only inside the sampling window */
+SensorWakeSupply SensorWakeSupplyInstance[] = {
+  { .SupplyCtrl = NULL }
+};
+
+/* Wake subset of the sensor table, only these channels are sampled in sleep */
+SensorWake SensorWakeInstance[] = {
+  { .SensorType = BOOLEAN, .ReadWakeValue = NULL, .Low = FALSE, .High = FALSE, .SupplyId = 0u },
+  { .SensorType = U16, .ReadWakeValue = NULL, .Low = 0u, .High = 0u, .SupplyId = 0u }
+};
+
+#define SENSOR_WAKE_SUPPLY_NUM (sizeof(SensorWakeSupplyInstance) / sizeof(SensorWakeSupply))
+#define SENSOR_WAKE_NUM        (sizeof(SensorWakeInstance) / sizeof(SensorWake))
+
+static SensorWake_State SensorWakeState = SENSOR_WAKE_OFF;
+static uint8 SensorWakeTick;
+static boolean SensorWakeRefValid;
+static uint32 SensorWakeSupplyMask;
+static uint32 SensorWakeRef;
+static uint32 SensorWakePending;
+static uint32 SensorWakeSource;
+static uint8 SensorWakeQualifyCnt[SENSOR_WAKE_CHN_MAX];
+
+static void Sensor_WakeSupply(boolean on)
+{
+  uint8 SupplyId;
+
+  for (SupplyId = 0u; SupplyId < SENSOR_WAKE_SUPPLY_NUM; SupplyId++)
+  {
+    if (((SensorWakeSupplyMask >> SupplyId) & 1u) != 0u && SensorWakeSupplyInstance[SupplyId].SupplyCtrl != NULL)
+    {
+      SensorWakeSupplyInstance[SupplyId].SupplyCtrl(on);
+    }
+  }
+}
+
+/* Digital: active when the level differs from the idle level in Low.
+   Analog: active inside [Low, High], one unsigned compare per channel. */
+static uint32 Sensor_WakeSample(void)
+{
+  uint32 Active = 0u;
+  uint8 SensorId;
+
+  for (SensorId = 0u; SensorId < SENSOR_WAKE_NUM; SensorId++)
+  {
+    const SensorWake *SensorWakePrt = &SensorWakeInstance[SensorId];
+    uint32 Hit;
+
+    if (SensorWakePrt->ReadWakeValue == NULL)
+    {
+      continue;
+    }
+
+    if (SensorWakePrt->SensorType == BOOLEAN)
+    {
+      boolean Level = FALSE;
+      (void)SensorWakePrt->ReadWakeValue(&Level);
+      Hit = (uint32)(Level != (boolean)SensorWakePrt->Low);
+    }
+    else
+    {
+      uint16 Value = 0u;
+      (void)SensorWakePrt->ReadWakeValue(&Value);
+      Hit = (uint32)((uint16)(Value - SensorWakePrt->Low) <= (uint16)(SensorWakePrt->High - SensorWakePrt->Low));
+    }
+    Active |= Hit << SensorId;
+  }
+
+  return Active;
+}
+
+/* A channel raises a wake event only after SENSOR_WAKE_QUALIFY_CNT consecutive
+   polls differing from the reference taken at sleep entry. */
+static void Sensor_WakeEvaluate(uint32 Active)
+{
+  uint32 Changed;
+  uint32 Remain;
+  uint32 Qualified = 0u;
+  uint8 SensorId;
+
+  if (SensorWakeRefValid == FALSE)
+  {
+    SensorWakeRef = Active;
+    SensorWakeRefValid = TRUE;
+    return;
+  }
+
+  Changed = Active ^ SensorWakeRef;
+  Remain = Changed;
+  for (SensorId = 0u; Remain != 0u; SensorId++, Remain >>= 1u)
+  {
+    if ((Remain & 1u) == 0u)
+    {
+      continue;
+    }
+
+    if (((SensorWakePending >> SensorId) & 1u) == 0u)
+    {
+      SensorWakeQualifyCnt[SensorId] = 1u;
+    }
+    else if (SensorWakeQualifyCnt[SensorId] < SENSOR_WAKE_QUALIFY_CNT)
+    {
+      SensorWakeQualifyCnt[SensorId]++;
+    }
+
+    if (SensorWakeQualifyCnt[SensorId] >= SENSOR_WAKE_QUALIFY_CNT)
+    {
+      Qualified |= (uint32)1u << SensorId;
+    }
+  }
+  SensorWakePending = Changed;
+
+  if ((Qualified & ~SensorWakeSource) != 0u)
+  {
+    SensorWakeSource |= Qualified;
+    SENSOR_WAKE_EVENT(SensorWakeSource);
+  }
+}
+
+void Sensor_WakeEnter(void)
+{
+  uint8 SensorId;
+
+  SensorWakeSupplyMask = 0u;
+  for (SensorId = 0u; SensorId < SENSOR_WAKE_NUM; SensorId++)
+  {
+    SensorWakeSupplyMask |= (uint32)1u << SensorWakeInstance[SensorId].SupplyId;
+  }
+
+  SensorWakeRefValid = FALSE;
+  SensorWakePending = 0u;
+  SensorWakeSource = 0u;
+  Sensor_WakeSupply(FALSE);
+
+  /* First window starts on the next tick and takes the reference sample */
+  SensorWakeTick = 1u;
+  SensorWakeState = SENSOR_WAKE_IDLE;
+}
+
+void Sensor_WakeExit(void)
+{
+  SensorWakeState = SENSOR_WAKE_OFF;
+  Sensor_WakeSupply(TRUE);
+}
+
+void Sensor_WakeMainFunction(void)
+{
+  switch (SensorWakeState)
+  {
+    case SENSOR_WAKE_IDLE:
+      if (SensorWakeTick > 1u)
+      {
+        SensorWakeTick--;
+      }
+      else
+      {
+        Sensor_WakeSupply(TRUE);
+        SensorWakeTick = SENSOR_WAKE_SETTLE_TICKS;
+        SensorWakeState = SENSOR_WAKE_SETTLE;
+      }
+      break;
+    case SENSOR_WAKE_SETTLE:
+      if (SensorWakeTick > 1u)
+      {
+        SensorWakeTick--;
+      }
+      else
+      {
+        uint32 Active = Sensor_WakeSample();
+
+        Sensor_WakeSupply(FALSE);
+        Sensor_WakeEvaluate(Active);
+        SensorWakeTick = SENSOR_WAKE_POLL_TICKS;
+        SensorWakeState = SENSOR_WAKE_IDLE;
+      }
+      break;
+    default:
+      break;
+  }
+}
+
+uint32 Sensor_WakeGetSource(void)
+{
+  return SensorWakeSource;
+}
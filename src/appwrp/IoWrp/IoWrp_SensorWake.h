@@ -0,0 +1,65 @@
+/*****************************************************************************************************************
+******************************************************************************************************************
+*  Copyright (C) .
+*  All rights reserved.
+******************************************************************************************************************
+*  FileName: IoWrp_SensorWake
+*  Content:  Io wrapper low-power cyclic wake sensing header file.
+*  Category:
+******************************************************************************************************************
+*  Revision Management
+*  yyyy.mm.dd    name              version      description
+*  ----------    --------          -------      -----------------------------------
+*  2026.01.05    clipping            v0001        Frist edit
+******************************************************************************************************************
+******************************************************************************************************************/
+/* Include Headerfiles  */
+/* ===================                                                  */
+#ifndef _IOWRP_SENSORWAKE_H_
+#define _IOWRP_SENSORWAKE_H_
+
+#include "IoWrp_Sensor.h"
+
+/* Ticks of Sensor_WakeMainFunction between two sampling windows */
+#define SENSOR_WAKE_POLL_TICKS      10u
+/* Ticks the sensor supplies need to settle before sampling */
+#define SENSOR_WAKE_SETTLE_TICKS    1u
+/* Consecutive polls a change must be seen before a wake event is raised */
+#define SENSOR_WAKE_QUALIFY_CNT     2u
+
+/* Wake event callout, e.g. EcuM_SetWakeupEvent */
+#define SENSOR_WAKE_EVENT(mask)     ((void)(mask))
+
+#define SENSOR_WAKE_CHN_MAX         32u
+
+typedef void (*SensorWake_SupplyCtrl)(boolean on);
+
+typedef struct
+{
+  SensorWake_SupplyCtrl SupplyCtrl;
+} SensorWakeSupply;
+
+/* Digital channel: Low holds the idle level, active when the level differs.
+   Analog channel: active when Low <= value <= High. */
+typedef struct
+{
+  Sensor_Type SensorType;
+  ReadValue ReadWakeValue;
+  uint16 Low;
+  uint16 High;
+  uint8 SupplyId;
+} SensorWake;
+
+typedef enum
+{
+  SENSOR_WAKE_OFF = 0,
+  SENSOR_WAKE_IDLE,
+  SENSOR_WAKE_SETTLE
+} SensorWake_State;
+
+extern void Sensor_WakeEnter(void);
+extern void Sensor_WakeExit(void);
+extern void Sensor_WakeMainFunction(void);
+extern uint32 Sensor_WakeGetSource(void);
+
+#endif
@@ -18,8 +18,9 @@
 #include "Bjt_Types.h"
 #include "Bjt_HwCfg.h"
 
-#include "AdcIf.h"
 #include "Pfm.h"
+#include "IoChnReg.h"
+#include "AdcCls.h"
 #include <string.h>
 #include "LiBool.h"
 /* PRQA S 0314 EOF*/
@@ -31,6 +32,9 @@
 /* the fault status of all channels*/
 static PFM_DefectReportState_t sBjt_atDiagResult[BJT_ID_MAX];
 
+/* channels present in the selected variant, the loops only run over these */
+static uint8 sBjt_u8ChnNum;
+
 /*******************************************************************************
 **  Global  variable definitions
 *******************************************************************************/
@@ -39,7 +43,19 @@ static boolean sBjt_abDoValue[BJT_ID_MAX];
 /* the record of ON/OFF status of all channels */
 static uint32 sBjt_u32ChnSts;
 /* ADC value of feedback diagnostic signals of all channels */
-static uint16 gBjt_au16DiagAdcV[BJT_ID_MAX];
+static Adc_ValueGroupType gBjt_au16DiagAdcV[BJT_ID_MAX];
+/* result buffer the ADC driver writes the group conversion to */
+static Adc_ValueGroupType sBjt_au16AdcResult[BJT_ID_MAX];
+/* open load / short thresholds of all channels as arrays for the batch classification */
+static uint16 sBjt_au16OlThr[BJT_ID_MAX];
+static uint16 sBjt_au16ShortThr[BJT_ID_MAX];
+/* power state requested by ObdPwr */
+static ObdPwr_StateType sBjt_ePwrState = OBDPWR_STATE_RUN;
+#if(BJT_EVENT_OUTPUT_EN == STD_ON)
+/* channels changed since the last output write, and the summary flag over them */
+static boolean sBjt_abOutPending[BJT_ID_MAX];
+static boolean sBjt_bOutPending;
+#endif
 
 #define BJT_GETCHANSTATE(port)    GETBIT_U32(sBjt_u32ChnSts, port)
 /*******************************************************************************
@@ -49,6 +65,10 @@ static void Bjt_GetDiagAdVal(void);
 static void Bjt_DiagHandle(void);
 static boolean Bjt_JudgePwmDuty(uint16 u16NominalValue);
 static void Bjt_WriteOutput(void);
+static void Bjt_WriteChnOutput(uint8 u8Chn);
+#if(BJT_EVENT_OUTPUT_EN == STD_ON)
+static boolean Bjt_IsChnChanged(uint8 u8Chn, uint16 u16Val);
+#endif
 /*******************************************************************************
 **  Global  Function definitions
 *******************************************************************************/
@@ -65,12 +85,17 @@ static void Bjt_DiagHandle(void)
     boolean l_bChanState;
     uint8   l_u8Port;
     PFM_PhysicalId_e l_eFid; 
+    uint32  l_au32OlMask[ADCCLS_MASK_WORDS(BJT_ID_MAX)];
+    uint32  l_au32ShortMask[ADCCLS_MASK_WORDS(BJT_ID_MAX)];
     
+    /* Classify all channels against their thresholds in one pass */
+    AdcCls_Classify(gBjt_au16DiagAdcV, sBjt_au16OlThr, sBjt_au16ShortThr, sBjt_u8ChnNum, l_au32OlMask, l_au32ShortMask);
     /* Go through all channels and perform diagnostic operation.
        Report diagnosing result to Pfm. */
-    for( l_u8Port = 0u; l_u8Port < (uint8)BJT_ID_MAX; l_u8Port ++ )
+    for( l_u8Port = 0u; l_u8Port < sBjt_u8ChnNum; l_u8Port ++ )
     {
         /* Get the index of current channel in Pfm module*/
+        l_eFid = IoChnReg_BjtPid(l_u8Port);
         l_bChanState = (boolean)(BJT_GETCHANSTATE(l_u8Port) ? TRUE : FALSE);
         /* if diagnosing channel selection equals this channel (channel 0 or channel 1),
            which means the ADC sample value belongs to this channel, diagnosing can be 
@@ -78,28 +103,17 @@ static void Bjt_DiagHandle(void)
         if( (GETBIT_U32(sBjt_u32ChnSts,l_u8Port)
             || (l_bChanState == (boolean)FALSE)))
         {
-            if(gBjt_au16DiagAdcV[l_u8Port] <= cBjt_atChannelInputCfg[l_u8Port].u16OLDiagAdcVal)
-            {
-                sBjt_atDiagResult[l_u8Port].eOpenLoad  = PFM_DDS_POS;
-            }
-            else if(gBjt_au16DiagAdcV[l_u8Port] >= cBjt_atChannelInputCfg[l_u8Port].u16ShortDiagAdcVal)
-            {
-                sBjt_atDiagResult[l_u8Port].eShort2Gnd  = PFM_DDS_POS;
-            }
-            else
-            {
-                sBjt_atDiagResult[l_u8Port].eOpenLoad  = PFM_DDS_ING;
-                sBjt_atDiagResult[l_u8Port].eShort2Vcc = PFM_DDS_ING;
-            }
-            sBjt_atDiagResult[l_u8Port].eShort2Gnd = PFM_DDS_ING;
+            sBjt_atDiagResult[l_u8Port].OpenLoad  = GETBIT_U32(l_au32OlMask[l_u8Port / ADCCLS_MASK_BITS], l_u8Port % ADCCLS_MASK_BITS) ? PFM_DDS_POS : PFM_DDS_NEG;
+            sBjt_atDiagResult[l_u8Port].Short2Gnd = GETBIT_U32(l_au32ShortMask[l_u8Port / ADCCLS_MASK_BITS], l_u8Port % ADCCLS_MASK_BITS) ? PFM_DDS_POS : PFM_DDS_NEG;
+            sBjt_atDiagResult[l_u8Port].Short2Vcc = PFM_DDS_ING;
         }
         else   /* If this channel is not selected as feedback source, wait for next cycle */
         {
-            sBjt_atDiagResult[l_u8Port].eOpenLoad  = PFM_DDS_ING;
-            sBjt_atDiagResult[l_u8Port].eShort2Vcc = PFM_DDS_ING;
-            sBjt_atDiagResult[l_u8Port].eShort2Gnd = PFM_DDS_ING;
+            sBjt_atDiagResult[l_u8Port].OpenLoad  = PFM_DDS_ING;
+            sBjt_atDiagResult[l_u8Port].Short2Vcc = PFM_DDS_ING;
+            sBjt_atDiagResult[l_u8Port].Short2Gnd = PFM_DDS_ING;
         }
-        Pfm_DefectReport(l_eFid, sBjt_atDiagResult[l_u8Port].eOpenLoad, sBjt_atDiagResult[l_u8Port].eShort2Vcc, sBjt_atDiagResult[l_u8Port].eShort2Gnd);
+        Pfm_DefectReport(l_eFid, sBjt_atDiagResult[l_u8Port].OpenLoad, sBjt_atDiagResult[l_u8Port].Short2Vcc, sBjt_atDiagResult[l_u8Port].Short2Gnd);
     }
 }
 
@@ -115,14 +129,10 @@ static void Bjt_DiagHandle(void)
  ****************************************************************/
 static void Bjt_GetDiagAdVal(void)
 {
-    uint8 l_u8Port;
-    uint8 l_u8DiagChan;
-
-    for (l_u8Port = 0u; l_u8Port < (uint8)BJT_ID_MAX; l_u8Port ++)
+    /* Get the AD values of all diagnostic feedbacks from the last group conversion in one copy */
+    if (Adc_ReadGroup(BJT_ADC_GROUP, gBjt_au16DiagAdcV) != E_OK)
     {
-        /* Get the AD value of diagnostic feedback */
-        gBjt_au16DiagAdcV[l_u8Port] = AdcIf_GetAdcValue(cBjt_au8AdcEidMap[l_u8Port]);
-
+        /* no new conversion, keep the last values */
     }
 }
 
@@ -134,7 +144,7 @@ static void Bjt_GetDiagAdVal(void)
 void Bjt_TurnOffAll(void)
 {
     uint8 l_u8Port;
-    for(l_u8Port = 0u; l_u8Port < (uint8)BJT_ID_MAX; l_u8Port++)
+    for(l_u8Port = 0u; l_u8Port < sBjt_u8ChnNum; l_u8Port++)
     {
         Bjt_WriteDoChn(l_u8Port, 0u);
     }
@@ -143,26 +153,85 @@ void Bjt_TurnOffAll(void)
     Bjt_WriteOutput();
 }
 
+static void Bjt_WriteChnOutput(uint8 u8Chn)
+{
+    if(BJT_PWM == cBjt_atChannelInputCfg[u8Chn].eBjt_Type)
+    {
+        Pwm_SetDutyCycle(cBjt_atChannelInputCfg[u8Chn].u8BjtPwmCntrl, sBjt_au16PwmOutDuty[u8Chn]);
+    }
+    else if( BJT_DIO == cBjt_atChannelInputCfg[u8Chn].eBjt_Type)
+    {
+        Dio_WriteChannel(cBjt_atChannelInputCfg[u8Chn].u8BjtDioCntrl, sBjt_abDoValue[u8Chn]);
+    }
+    else
+    {
+        /*do nothing*/
+    }
+}
+
 static void Bjt_WriteOutput(void)
 {
     uint8 i;
-    for(i = 0;i < (uint8)BJT_ID_MAX;i++)
+    for(i = 0;i < sBjt_u8ChnNum;i++)
     {
-        if(BJT_PWM == cBjt_atChannelInputCfg[i].eBjt_Type)
-        {
-            Pwm_SetDutyCycle(cBjt_atChannelInputCfg[i].u8BjtPwmCntrl, sBjt_au16PwmOutDuty[i]);
-        }
-        else if( BJT_DIO== cBjt_atChannelInputCfg[i].eBjt_Type)
-        {
-            Dio_WriteChannel(cBjt_atChannelInputCfg[i].u8BjtDioCntrl, sBjt_abDoValue[i]);
-        }
-        else
+        Bjt_WriteChnOutput(i);
+    }
+}
+
+#if(BJT_EVENT_OUTPUT_EN == STD_ON)
+/****************************************************************
+ process: Bjt_OutputMainFunction
+ purpose: Write the channels changed since the last call. Called
+          by the output task activated through BJT_OUTPUT_TRIGGER
+          and by Bjt_MainFunction as fallback, nothing is written
+          while no command changes.
+ ****************************************************************/
+void Bjt_OutputMainFunction(void)
+{
+    uint8 i;
+
+    if((sBjt_bOutPending == TRUE) && (sBjt_ePwrState != OBDPWR_STATE_SLEEP))
+    {
+        /* cleared before the scan, a change during the scan is taken by the next call */
+        sBjt_bOutPending = FALSE;
+        for(i = 0u;i < sBjt_u8ChnNum;i++)
         {
-            /*do nothing*/
+            if(sBjt_abOutPending[i] == TRUE)
+            {
+                sBjt_abOutPending[i] = FALSE;
+                Bjt_WriteChnOutput(i);
+            }
+            else
+            {
+                /* nothing to do */
+            }
         }
     }
+    else
+    {
+        /* nothing changed or sleep */
+    }
+}
+
+static boolean Bjt_IsChnChanged(uint8 u8Chn, uint16 u16Val)
+{
+    boolean l_bChanged = FALSE;
 
+    if(BJT_PWM == cBjt_atChannelInputCfg[u8Chn].eBjt_Type)
+    {
+        l_bChanged = (boolean)(sBjt_au16PwmOutDuty[u8Chn] != u16Val);
+    }
+    else if(BJT_DIO == cBjt_atChannelInputCfg[u8Chn].eBjt_Type)
+    {
+        l_bChanged = (boolean)(sBjt_abDoValue[u8Chn] != (boolean)u16Val);
+    }
+    else
+    {
+        /*do nothing*/
+    }
+    return l_bChanged;
 }
+#endif
 
 /****************************************************************
  process: Bjt_v10ms
@@ -170,9 +239,60 @@ static void Bjt_WriteOutput(void)
  ****************************************************************/
 void Bjt_MainFunction(void)
 {
-    Bjt_GetDiagAdVal();
-    Bjt_DiagHandle();
-    Bjt_WriteOutput();
+    if(sBjt_ePwrState == OBDPWR_STATE_RUN)
+    {
+        Bjt_GetDiagAdVal();
+        Bjt_DiagHandle();
+#if(BJT_EVENT_OUTPUT_EN == STD_ON)
+        Bjt_OutputMainFunction();
+#else
+        Bjt_WriteOutput();
+#endif
+    }
+    else if(sBjt_ePwrState == OBDPWR_STATE_LOWPOWER)
+    {
+        /* outputs follow the application, diagnostics are suspended */
+#if(BJT_EVENT_OUTPUT_EN == STD_ON)
+        Bjt_OutputMainFunction();
+#else
+        Bjt_WriteOutput();
+#endif
+    }
+    else
+    {
+        /* sleep: outputs are off, nothing to do */
+    }
+}
+
+/****************************************************************
+ process: Bjt_SetPowerState
+ purpose: LOWPOWER keeps the outputs but stops the diagnosis,
+          SLEEP turns all outputs off as well. The diagnostic
+          results are unknown outside RUN.
+ ****************************************************************/
+void Bjt_SetPowerState(ObdPwr_StateType eState)
+{
+    if(eState != sBjt_ePwrState)
+    {
+        if(eState == OBDPWR_STATE_SLEEP)
+        {
+            Bjt_TurnOffAll();
+        }
+        else
+        {
+            /* outputs are restored by the application */
+        }
+
+        if(eState == OBDPWR_STATE_RUN)
+        {
+            (void)memset((void *)gBjt_au16DiagAdcV, 0, sizeof(gBjt_au16DiagAdcV));
+        }
+        else
+        {
+            (void)memset((void *)sBjt_atDiagResult, 0, sizeof(PFM_DefectReportState_t) * (uint8)BJT_ID_MAX); /* all diagnostic result = PFM_DDS_ING(0) */
+        }
+        sBjt_ePwrState = eState;
+    }
 }
 
 /****************************************************************
@@ -181,8 +301,25 @@ void Bjt_MainFunction(void)
  ****************************************************************/
 void Bjt_Init(void)
 {
+    uint8 l_u8Port;
+
+    sBjt_u8ChnNum = IoChnReg_GetChnNum(IOCHNREG_DRV_BJT);
+    if(sBjt_u8ChnNum > (uint8)BJT_ID_MAX)
+    {
+        sBjt_u8ChnNum = (uint8)BJT_ID_MAX;
+    }
+    else
+    {
+        /* nothing to do */
+    }
     /* initialize the global diagnostic variables */
-    (void)memset((void *)gBjt_au16DiagAdcV, 0, sizeof(uint16) * (uint8)BJT_ID_MAX);                /* initialize AD values of all diagnostic channels */
+    (void)memset((void *)gBjt_au16DiagAdcV, 0, sizeof(gBjt_au16DiagAdcV));                /* initialize AD values of all diagnostic channels */
+    (void)Adc_SetupResultBuffer(BJT_ADC_GROUP, sBjt_au16AdcResult);
+    for(l_u8Port = 0u;l_u8Port < sBjt_u8ChnNum;l_u8Port++)
+    {
+        sBjt_au16OlThr[l_u8Port] = cBjt_atChannelInputCfg[l_u8Port].u16OLDiagAdcVal;
+        sBjt_au16ShortThr[l_u8Port] = cBjt_atChannelInputCfg[l_u8Port].u16ShortDiagAdcVal;
+    }
     (void)memset((void *)sBjt_atDiagResult,0,sizeof(PFM_DefectReportState_t) * (uint8)BJT_ID_MAX); /* all diagnostic result = PFM_DDS_ING(0) */
 
     /* turn off all outputs and initialize state record to all-off */
@@ -200,7 +337,7 @@ void Bjt_DeInit(void)
     /* turn off all outputs and initialize state record to all-off */
     Bjt_TurnOffAll();
     /* initialize the global diagnostic variables */
-    (void)memset((void *)gBjt_au16DiagAdcV, 0, sizeof(uint16) * (uint8)BJT_ID_MAX);                  /* zero all diagnostic signal AD value */    (void)memset((void *)sBjt_atDiagResult, 0, sizeof(PFM_DefectReportState_t)*  (uint8)BJT_ID_MAX); /* all diagnostic result = PFM_DDS_ING(0) */
+    (void)memset((void *)gBjt_au16DiagAdcV, 0, sizeof(gBjt_au16DiagAdcV));                  /* zero all diagnostic signal AD value */    (void)memset((void *)sBjt_atDiagResult, 0, sizeof(PFM_DefectReportState_t)*  (uint8)BJT_ID_MAX); /* all diagnostic result = PFM_DDS_ING(0) */
 
 }
 
@@ -210,25 +347,51 @@ void Bjt_DeInit(void)
  ****************************************************************/
 void Bjt_WriteDoChn(uint8 u8Chn, uint16 u16Val)
 {
-    if(BJT_PWM == cBjt_atChannelInputCfg[u8Chn].eBjt_Type)
+#if(BJT_EVENT_OUTPUT_EN == STD_ON)
+    boolean l_bChanged;
+#endif
+    if(u8Chn < sBjt_u8ChnNum)
     {
-        sBjt_au16PwmOutDuty[u8Chn] = u16Val;
-    }
-    else if( BJT_DIO== cBjt_atChannelInputCfg[u8Chn].eBjt_Type)
-    {
-        sBjt_abDoValue[u8Chn] = (boolean)u16Val;
-    }
-    else
-    {
-        /*do nothing*/
-    }
+#if(BJT_EVENT_OUTPUT_EN == STD_ON)
+        l_bChanged = Bjt_IsChnChanged(u8Chn, u16Val);
+#endif
+        if(BJT_PWM == cBjt_atChannelInputCfg[u8Chn].eBjt_Type)
+        {
+            sBjt_au16PwmOutDuty[u8Chn] = u16Val;
+        }
+        else if( BJT_DIO== cBjt_atChannelInputCfg[u8Chn].eBjt_Type)
+        {
+            sBjt_abDoValue[u8Chn] = (boolean)u16Val;
+        }
+        else
+        {
+            /*do nothing*/
+        }
 
-    if (u16Val > 0u)
-    {
-        sBjt_u32ChnSts |= (uint32)1u << u8Chn;
+        if (u16Val > 0u)
+        {
+            sBjt_u32ChnSts |= (uint32)1u << u8Chn;
+        }
+        else
+        {
+            sBjt_u32ChnSts &= 0xFFFFFFFFul - ((uint32)1u << u8Chn);
+        }
+#if(BJT_EVENT_OUTPUT_EN == STD_ON)
+        if(l_bChanged == TRUE)
+        {
+            /* value first, then the flags, then the trigger: the output task may preempt here */
+            sBjt_abOutPending[u8Chn] = TRUE;
+            sBjt_bOutPending = TRUE;
+            BJT_OUTPUT_TRIGGER();
+        }
+        else
+        {
+            /* nothing to do */
+        }
+#endif
     }
     else
     {
-        sBjt_u32ChnSts &= 0xFFFFFFFFul - ((uint32)1u << u8Chn);
+        /* channel not present in this variant */
     }
 }
@@ -19,12 +19,18 @@
 
 #include "Bjt_Types.h"
 #include "Bjt_HwCfg.h"
+#include "ObdPwr_Types.h"
 
 
 extern void Bjt_Init(void);
 extern void Bjt_DeInit(void);
 extern void Bjt_MainFunction(void);
 extern void Bjt_WriteDoChn(uint8 u8Chn, uint16 u16Val);
+extern void Bjt_TurnOffAll(void);
+extern void Bjt_SetPowerState(ObdPwr_StateType eState);
+#if(BJT_EVENT_OUTPUT_EN == STD_ON)
+extern void Bjt_OutputMainFunction(void);
+#endif
 
 
 #endif
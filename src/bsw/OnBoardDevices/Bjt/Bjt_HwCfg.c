@@ -15,7 +15,6 @@
 ******************************************************************************************************************/
 /* Include Headerfiles  */
 #include "Bjt_HwCfg.h"
-#include "AdcIf.h"
 const Bjt_ChnCfgType cBjt_atChannelInputCfg[BJT_ID_MAX] = 
 {
     {BJT_ID_0,BJT_DIO,DioConf_DioChannel_DioChannel_P31_11,BJT_DIO_PWM_INVALIDVAL,0xFFF,0xFFF},
@@ -23,8 +22,4 @@ const Bjt_ChnCfgType cBjt_atChannelInputCfg[BJT_ID_MAX] =
 
 };
 
-const uint8 cBjt_au8AdcEidMap[BJT_ID_MAX] =
-{
-    1,2
-};
 
@@ -20,6 +20,7 @@
 #include "Bjt_Types.h"
 #include "Pwm.h"
 #include "Dio.h"
+#include "Adc.h"
 
 
 typedef enum
@@ -43,7 +44,17 @@ typedef struct
 #define BJT_ENABLE_PWM_TRIGGER_ADC
 #define BJT_DISABLE_PEM_TRIGGER_ADC
 
+/* diagnostic feedback of all channels is converted as one ADC group,
+   group channel n is the feedback of BJT_ID n */
+/* STD_ON: outputs are written only for channels whose command changed, by
+   Bjt_OutputMainFunction. Bjt_MainFunction keeps the diagnosis on its raster. */
+#define BJT_EVENT_OUTPUT_EN STD_ON
+/* callout of Bjt_WriteDoChn on a change, e.g. activation of the output task or
+   software interrupt that calls Bjt_OutputMainFunction */
+#define BJT_OUTPUT_TRIGGER() ((void)0)
+
+#define BJT_ADC_GROUP AdcConf_AdcGroup_AdcGroup_BjtDiag
+
 
 extern const Bjt_ChnCfgType cBjt_atChannelInputCfg[BJT_ID_MAX];
-extern const uint8 cBjt_au8AdcEidMap[BJT_ID_MAX];
 #endif
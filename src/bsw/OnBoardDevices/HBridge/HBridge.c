@@ -0,0 +1,432 @@
+/*****************************************************************************************************************
+******************************************************************************************************************
+*  Copyright (C) .
+*  All rights reserved.
+******************************************************************************************************************
+*  FileName: HBridge
+*  Content:  H-bridge abstraction over two half-bridges
+*  Category: Tle941xy Tle9210x
+******************************************************************************************************************
+*  Revision Management
+*  yyyy.mm.dd    name              version      description
+*  ----------    --------          -------      -----------------------------------
+*  2026.01.26    clipping            v0001        Frist edit
+******************************************************************************************************************
+******************************************************************************************************************/
+/* Include Headerfiles  */
+#include "HBridge.h"
+#if(HBRIDGE_TLE941XY_EN == STD_ON)
+#include "Tle941xy.h"
+#endif
+#if(HBRIDGE_TLE9210X_EN == STD_ON)
+#include "Tle9210x.h"
+#if(TLE9210X_RIPPLE_EN == STD_ON)
+#include "Tle9210x_Ripple.h"
+#endif
+#endif
+
+static HBridge_StateType sHBridge_atState[HBRIDGE_ID_MAX];
+
+static void HBridge_WriteHb(const HBridge_CfgType* ptCfg, uint8 u8Hb, HBridge_CmdType eCmd, boolean bHs);
+static void HBridge_WriteDuty(uint8 u8Id, uint8 u8Duty);
+static boolean HBridge_IsFwCapable(const HBridge_CfgType* ptCfg, uint8 u8Hb);
+static void HBridge_ResolvePwm(uint8 u8Id);
+static void HBridge_WriteFw(uint8 u8Id);
+static void HBridge_Apply(uint8 u8Id, HBridge_CmdType eCmd, uint8 u8Duty);
+
+/****************************************************************
+ process: HBridge_WriteHb
+ purpose: Drive one half-bridge of the pair: off for coast, the
+          high side when bHs is set in forward/reverse, else the
+          low side.
+ ****************************************************************/
+static void HBridge_WriteHb(const HBridge_CfgType* ptCfg, uint8 u8Hb, HBridge_CmdType eCmd, boolean bHs)
+{
+    uint8 l_u8Val;
+
+    if(eCmd == HBRIDGE_CMD_COAST)
+    {
+        l_u8Val = 0u;
+    }
+    else
+    {
+        l_u8Val = (bHs == TRUE) ? 2u : 1u;
+    }
+
+    switch(ptCfg->u8Dev)
+    {
+#if(HBRIDGE_TLE941XY_EN == STD_ON)
+        case HBRIDGE_DEV_TLE941XY:
+            l_u8Val = (l_u8Val == 0u) ? TLE941XY_OUT_STATUS_OFF : ((l_u8Val == 2u) ? TLE941XY_OUT_STATUS_HS : TLE941XY_OUT_STATUS_LS);
+            Tle941xy_WriteHbChn(ptCfg->u8Group, ptCfg->u8Chip, u8Hb, l_u8Val);
+            break;
+#endif
+#if(HBRIDGE_TLE9210X_EN == STD_ON)
+        case HBRIDGE_DEV_TLE9210X:
+            l_u8Val = (l_u8Val == 0u) ? TLE9210X_OUT_STATUS_OFF : ((l_u8Val == 2u) ? TLE9210X_OUT_STATUS_HS : TLE9210X_OUT_STATUS_LS);
+            Tle9210x_WriteHbChn(ptCfg->u8Group, ptCfg->u8Chip, u8Hb, l_u8Val);
+            break;
+#endif
+        default:
+            /* device not enabled */
+            break;
+    }
+}
+
+/****************************************************************
+ process: HBridge_WriteDuty
+ purpose: Duty of the bridge PWM channel, 0..HBRIDGE_DUTY_FULL in
+          the register scale of the device. Skipped when the channel
+          does not switch a half-bridge of the pair, it belongs to
+          another load then.
+ ****************************************************************/
+static void HBridge_WriteDuty(uint8 u8Id, uint8 u8Duty)
+{
+    const HBridge_CfgType* l_ptCfg = &cHBridge_atCfg[u8Id];
+
+    if(sHBridge_atState[u8Id].u8PwmHb != HBRIDGE_NO_PWM)
+    {
+        switch(l_ptCfg->u8Dev)
+        {
+#if(HBRIDGE_TLE941XY_EN == STD_ON)
+            case HBRIDGE_DEV_TLE941XY:
+                Tle941xy_WritePwmChn(l_ptCfg->u8Group, l_ptCfg->u8Chip, l_ptCfg->u8PwmChn, u8Duty);
+                break;
+#endif
+#if(HBRIDGE_TLE9210X_EN == STD_ON)
+            case HBRIDGE_DEV_TLE9210X:
+                Tle9210x_WritePwmChn(l_ptCfg->u8Group, l_ptCfg->u8Chip, l_ptCfg->u8PwmChn, u8Duty);
+                break;
+#endif
+            default:
+                /* device not enabled */
+                break;
+        }
+    }
+    else
+    {
+        /* no PWM: forward/reverse full on */
+    }
+}
+
+/****************************************************************
+ process: HBridge_IsFwCapable
+ purpose: Whether a half-bridge can freewheel actively, i.e. switch
+          its complementary MOSFET on in the PWM off phase:
+          Tle941xy when the board configuration allows active
+          freewheeling for the output, Tle9210x always, the gate driver drives
+          both MOSFETs of every half-bridge.
+ ****************************************************************/
+static boolean HBridge_IsFwCapable(const HBridge_CfgType* ptCfg, uint8 u8Hb)
+{
+    boolean l_bCapable = FALSE;
+
+    switch(ptCfg->u8Dev)
+    {
+#if(HBRIDGE_TLE941XY_EN == STD_ON)
+        case HBRIDGE_DEV_TLE941XY:
+            l_bCapable = (cTle941xy_abChipFreeWheelingCfg[ptCfg->u8Group][ptCfg->u8Chip][u8Hb] == TLE941XY_CHN_FW_ON) ? TRUE : FALSE;
+            break;
+#endif
+#if(HBRIDGE_TLE9210X_EN == STD_ON)
+        case HBRIDGE_DEV_TLE9210X:
+            l_bCapable = TRUE;
+            break;
+#endif
+        default:
+            /* device not enabled */
+            break;
+    }
+    return l_bCapable;
+}
+
+/****************************************************************
+ process: HBridge_ResolvePwm
+ purpose: Find the half-bridge of the pair switched by the PWM
+          channel from the device configuration and select the
+          freewheeling: active (FW MOSFET on the PWM side switched
+          on in the PWM off phase) when both half-bridges of the
+          pair support it, else passive through the body diode.
+ ****************************************************************/
+static void HBridge_ResolvePwm(uint8 u8Id)
+{
+    const HBridge_CfgType* l_ptCfg = &cHBridge_atCfg[u8Id];
+    HBridge_StateType* l_ptSt = &sHBridge_atState[u8Id];
+
+    l_ptSt->u8PwmHb = HBRIDGE_NO_PWM;
+    l_ptSt->bActiveFw = FALSE;
+    if(l_ptCfg->u8PwmChn == HBRIDGE_NO_PWM)
+    {
+        /* nothing to do */
+    }
+#if(HBRIDGE_TLE941XY_EN == STD_ON)
+    else if(l_ptCfg->u8Dev == HBRIDGE_DEV_TLE941XY)
+    {
+        if(cTle941xy_au8ChnModeCfg[l_ptCfg->u8Group][l_ptCfg->u8Chip][l_ptCfg->u8HbA] == (uint8)(TLE941XY_CHN_CTRL_PWM1 + l_ptCfg->u8PwmChn))
+        {
+            l_ptSt->u8PwmHb = l_ptCfg->u8HbA;
+        }
+        else if(cTle941xy_au8ChnModeCfg[l_ptCfg->u8Group][l_ptCfg->u8Chip][l_ptCfg->u8HbB] == (uint8)(TLE941XY_CHN_CTRL_PWM1 + l_ptCfg->u8PwmChn))
+        {
+            l_ptSt->u8PwmHb = l_ptCfg->u8HbB;
+        }
+        else
+        {
+            /* PWM channel not mapped to the pair */
+        }
+    }
+#endif
+#if(HBRIDGE_TLE9210X_EN == STD_ON)
+    else if(l_ptCfg->u8Dev == HBRIDGE_DEV_TLE9210X)
+    {
+        if(cTle9210x_atPwmChnCfg[l_ptCfg->u8Group][l_ptCfg->u8Chip][l_ptCfg->u8PwmChn].bPwmEn == TLE9210X_PWM_ENABLE)
+        {
+            l_ptSt->u8PwmHb = cTle9210x_atPwmChnCfg[l_ptCfg->u8Group][l_ptCfg->u8Chip][l_ptCfg->u8PwmChn].u8PwmMapChn;
+            if((l_ptSt->u8PwmHb != l_ptCfg->u8HbA) && (l_ptSt->u8PwmHb != l_ptCfg->u8HbB))
+            {
+                /* PWM channel not mapped to the pair */
+                l_ptSt->u8PwmHb = HBRIDGE_NO_PWM;
+            }
+            else
+            {
+                /* nothing to do */
+            }
+        }
+    }
+#endif
+    else
+    {
+        /* nothing to do */
+    }
+
+    if((l_ptSt->u8PwmHb != HBRIDGE_NO_PWM)
+    && (HBridge_IsFwCapable(l_ptCfg, l_ptCfg->u8HbA) == TRUE)
+    && (HBridge_IsFwCapable(l_ptCfg, l_ptCfg->u8HbB) == TRUE))
+    {
+        l_ptSt->bActiveFw = TRUE;
+    }
+    else
+    {
+        /* passive freewheeling */
+    }
+}
+
+/****************************************************************
+ process: HBridge_WriteFw
+ purpose: Program the freewheeling selected by HBridge_ResolvePwm
+          into the device: the FW bit of the PWM half-bridge on
+          Tle941xy, the AFW bit of the PWM channel on Tle9210x.
+          Bridges without PWM leave the device configuration.
+ ****************************************************************/
+static void HBridge_WriteFw(uint8 u8Id)
+{
+    const HBridge_CfgType* l_ptCfg = &cHBridge_atCfg[u8Id];
+    const HBridge_StateType* l_ptSt = &sHBridge_atState[u8Id];
+
+    if(l_ptSt->u8PwmHb != HBRIDGE_NO_PWM)
+    {
+        switch(l_ptCfg->u8Dev)
+        {
+#if(HBRIDGE_TLE941XY_EN == STD_ON)
+            case HBRIDGE_DEV_TLE941XY:
+                Tle941xy_WriteFwChn(l_ptCfg->u8Group, l_ptCfg->u8Chip, l_ptSt->u8PwmHb, l_ptSt->bActiveFw);
+                break;
+#endif
+#if(HBRIDGE_TLE9210X_EN == STD_ON)
+            case HBRIDGE_DEV_TLE9210X:
+                Tle9210x_WriteFwChn(l_ptCfg->u8Group, l_ptCfg->u8Chip, l_ptCfg->u8PwmChn, l_ptSt->bActiveFw);
+                break;
+#endif
+            default:
+                /* device not enabled */
+                break;
+        }
+    }
+    else
+    {
+        /* no PWM: no freewheeling phase */
+    }
+}
+
+/****************************************************************
+ process: HBridge_Apply
+ purpose: Write the command to the half-bridge images. The duty is
+          set before the half-bridges, the driver sends both in the
+          same output job. Brake is both low sides on at full duty,
+          so the braking current never passes a body diode.
+ ****************************************************************/
+static void HBridge_Apply(uint8 u8Id, HBridge_CmdType eCmd, uint8 u8Duty)
+{
+    const HBridge_CfgType* l_ptCfg = &cHBridge_atCfg[u8Id];
+
+    switch(eCmd)
+    {
+        case HBRIDGE_CMD_FORWARD:
+            HBridge_WriteDuty(u8Id, u8Duty);
+            HBridge_WriteHb(l_ptCfg, l_ptCfg->u8HbA, eCmd, TRUE);
+            HBridge_WriteHb(l_ptCfg, l_ptCfg->u8HbB, eCmd, FALSE);
+            break;
+        case HBRIDGE_CMD_REVERSE:
+            HBridge_WriteDuty(u8Id, u8Duty);
+            HBridge_WriteHb(l_ptCfg, l_ptCfg->u8HbA, eCmd, FALSE);
+            HBridge_WriteHb(l_ptCfg, l_ptCfg->u8HbB, eCmd, TRUE);
+            break;
+        case HBRIDGE_CMD_BRAKE:
+            HBridge_WriteDuty(u8Id, HBRIDGE_DUTY_FULL);
+            HBridge_WriteHb(l_ptCfg, l_ptCfg->u8HbA, eCmd, FALSE);
+            HBridge_WriteHb(l_ptCfg, l_ptCfg->u8HbB, eCmd, FALSE);
+            break;
+        default:
+            HBridge_WriteHb(l_ptCfg, l_ptCfg->u8HbA, HBRIDGE_CMD_COAST, FALSE);
+            HBridge_WriteHb(l_ptCfg, l_ptCfg->u8HbB, HBRIDGE_CMD_COAST, FALSE);
+            HBridge_WriteDuty(u8Id, 0u);
+            eCmd = HBRIDGE_CMD_COAST;
+            break;
+    }
+    sHBridge_atState[u8Id].eCmd = eCmd;
+
+#if((HBRIDGE_TLE9210X_EN == STD_ON) && (TLE9210X_RIPPLE_EN == STD_ON))
+    /* brake and coast keep the direction, the motor still turns down */
+    if((l_ptCfg->u8RippleMotor != HBRIDGE_NO_RIPPLE) && ((eCmd == HBRIDGE_CMD_FORWARD) || (eCmd == HBRIDGE_CMD_REVERSE)))
+    {
+        Tle9210x_RippleSetDir(l_ptCfg->u8RippleMotor, (eCmd == HBRIDGE_CMD_FORWARD) ? 1 : -1);
+    }
+#endif
+}
+
+/****************************************************************
+ process: HBridge_Init
+ purpose: All bridges coast, the freewheeling of the PWM bridges is
+          programmed. Called after the half-bridge drivers are
+          initialised, the drivers keep it over sleep.
+ ****************************************************************/
+void HBridge_Init(void)
+{
+    uint8 i;
+
+    for(i = 0u;i < (uint8)HBRIDGE_ID_MAX;i++)
+    {
+        HBridge_ResolvePwm(i);
+        HBridge_WriteFw(i);
+        sHBridge_atState[i].eReqCmd = HBRIDGE_CMD_COAST;
+        sHBridge_atState[i].u8ReqDuty = 0u;
+        sHBridge_atState[i].u8DeadCnt = 0u;
+        HBridge_Apply(i, HBRIDGE_CMD_COAST, 0u);
+    }
+}
+
+/****************************************************************
+ process: HBridge_Set
+ purpose: Request a bridge command. Forward <-> reverse goes through
+          coast for HBRIDGE_DEADTIME_CYCLES so the load current has
+          decayed and no frame ever carries both diagonals; the
+          other transitions are applied at once, the device handles
+          the cross conduction inside a half-bridge.
+ ****************************************************************/
+Std_ReturnType HBridge_Set(uint8 u8Id, HBridge_CmdType eCmd, uint8 u8Duty)
+{
+    Std_ReturnType l_u8RetVal = E_NOT_OK;
+    HBridge_StateType* l_ptSt;
+
+    if((u8Id < (uint8)HBRIDGE_ID_MAX) && (eCmd <= HBRIDGE_CMD_BRAKE))
+    {
+        l_ptSt = &sHBridge_atState[u8Id];
+        l_ptSt->eReqCmd = eCmd;
+        l_ptSt->u8ReqDuty = u8Duty;
+        if(l_ptSt->u8DeadCnt > 0u)
+        {
+            /* reversal in progress, applied by HBridge_MainFunction */
+        }
+        else if(((l_ptSt->eCmd == HBRIDGE_CMD_FORWARD) && (eCmd == HBRIDGE_CMD_REVERSE))
+              ||((l_ptSt->eCmd == HBRIDGE_CMD_REVERSE) && (eCmd == HBRIDGE_CMD_FORWARD)))
+        {
+            HBridge_Apply(u8Id, HBRIDGE_CMD_COAST, 0u);
+            l_ptSt->u8DeadCnt = HBRIDGE_DEADTIME_CYCLES;
+        }
+        else
+        {
+            HBridge_Apply(u8Id, eCmd, u8Duty);
+        }
+        l_u8RetVal = E_OK;
+    }
+    return l_u8RetVal;
+}
+
+/****************************************************************
+ process: HBridge_MainFunction
+ purpose: Driver cycle, called before the half-bridge drivers.
+          Ends the coast phase of a reversal.
+ ****************************************************************/
+void HBridge_MainFunction(void)
+{
+    uint8 i;
+    HBridge_StateType* l_ptSt;
+
+    for(i = 0u;i < (uint8)HBRIDGE_ID_MAX;i++)
+    {
+        l_ptSt = &sHBridge_atState[i];
+        if(l_ptSt->u8DeadCnt > 0u)
+        {
+            l_ptSt->u8DeadCnt--;
+            if(l_ptSt->u8DeadCnt == 0u)
+            {
+                HBridge_Apply(i, l_ptSt->eReqCmd, l_ptSt->u8ReqDuty);
+            }
+        }
+        else
+        {
+            /* nothing to do */
+        }
+    }
+}
+
+HBridge_CmdType HBridge_GetCmd(uint8 u8Id)
+{
+    HBridge_CmdType l_eCmd = HBRIDGE_CMD_COAST;
+
+    if(u8Id < (uint8)HBRIDGE_ID_MAX)
+    {
+        l_eCmd = sHBridge_atState[u8Id].eCmd;
+    }
+    return l_eCmd;
+}
+
+/****************************************************************
+ process: HBridge_IsActiveFw
+ purpose: Freewheeling selected for the bridge, TRUE: active, FALSE:
+          passive or no PWM.
+ ****************************************************************/
+boolean HBridge_IsActiveFw(uint8 u8Id)
+{
+    boolean l_bActiveFw = FALSE;
+
+    if(u8Id < (uint8)HBRIDGE_ID_MAX)
+    {
+        l_bActiveFw = sHBridge_atState[u8Id].bActiveFw;
+    }
+    return l_bActiveFw;
+}
+
+/****************************************************************
+ process: HBridge_SetPowerState
+ purpose: The drivers switch all half-bridges off in sleep, the
+          bridges follow so no command is resumed after wake up.
+ ****************************************************************/
+void HBridge_SetPowerState(ObdPwr_StateType eState)
+{
+    uint8 i;
+
+    if(eState == OBDPWR_STATE_SLEEP)
+    {
+        for(i = 0u;i < (uint8)HBRIDGE_ID_MAX;i++)
+        {
+            sHBridge_atState[i].eCmd = HBRIDGE_CMD_COAST;
+            sHBridge_atState[i].eReqCmd = HBRIDGE_CMD_COAST;
+            sHBridge_atState[i].u8DeadCnt = 0u;
+        }
+    }
+    else
+    {
+        /* nothing to do */
+    }
+}
@@ -0,0 +1,31 @@
+/*****************************************************************************************************************
+******************************************************************************************************************
+*  Copyright (C) .
+*  All rights reserved.
+******************************************************************************************************************
+*  FileName: HBridge
+*  Content:  H-bridge abstraction over two half-bridges
+*  Category: Tle941xy Tle9210x
+******************************************************************************************************************
+*  Revision Management
+*  yyyy.mm.dd    name              version      description
+*  ----------    --------          -------      -----------------------------------
+*  2026.01.26    clipping            v0001        Frist edit
+******************************************************************************************************************
+******************************************************************************************************************/
+/* Include Headerfiles  */
+#ifndef _HBRIDGE_H_
+#define _HBRIDGE_H_
+
+#include "HBridge_Types.h"
+#include "HBridge_HwCfg.h"
+#include "ObdPwr_Types.h"
+
+extern void HBridge_Init(void);
+extern void HBridge_MainFunction(void);
+extern Std_ReturnType HBridge_Set(uint8 u8Id, HBridge_CmdType eCmd, uint8 u8Duty);
+extern HBridge_CmdType HBridge_GetCmd(uint8 u8Id);
+extern boolean HBridge_IsActiveFw(uint8 u8Id);
+extern void HBridge_SetPowerState(ObdPwr_StateType eState);
+
+#endif
@@ -0,0 +1,43 @@
+/*****************************************************************************************************************
+******************************************************************************************************************
+*  Copyright (C) .
+*  All rights reserved.
+******************************************************************************************************************
+*  FileName: HBridge
+*  Content:  H-bridge abstraction over two half-bridges, configuration
+*  Category: Tle941xy Tle9210x
+******************************************************************************************************************
+*  Revision Management
+*  yyyy.mm.dd    name              version      description
+*  ----------    --------          -------      -----------------------------------
+*  2026.01.26    clipping            v0001        Frist edit
+******************************************************************************************************************
+******************************************************************************************************************/
+/* Include Headerfiles  */
+#include "HBridge_HwCfg.h"
+#include "Tle941xy.h"
+#include "Tle9210x.h"
+
+const HBridge_CfgType cHBridge_atCfg[HBRIDGE_ID_MAX] =
+{
+    /* HBRIDGE_ID_WINDOW_LIFT */
+    {
+        HBRIDGE_DEV_TLE9210X,
+        TLE9210X_GROUP_0,
+        TLE9210X_CHIP_0,
+        TLE9210X_HB1,
+        TLE9210X_HB2,
+        0u,
+        TLE9210X_RIPPLE_MOTOR_0
+    },
+    /* HBRIDGE_ID_SEAT */
+    {
+        HBRIDGE_DEV_TLE941XY,
+        TLE941XY_GROUP_0,
+        TLE941XY_CHIP_0,
+        0u,
+        1u,
+        HBRIDGE_NO_PWM,
+        HBRIDGE_NO_RIPPLE
+    },
+};
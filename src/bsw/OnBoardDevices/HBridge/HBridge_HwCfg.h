@@ -0,0 +1,38 @@
+/*****************************************************************************************************************
+******************************************************************************************************************
+*  Copyright (C) .
+*  All rights reserved.
+******************************************************************************************************************
+*  FileName: HBridge
+*  Content:  H-bridge abstraction over two half-bridges, configuration
+*  Category: Tle941xy Tle9210x
+******************************************************************************************************************
+*  Revision Management
+*  yyyy.mm.dd    name              version      description
+*  ----------    --------          -------      -----------------------------------
+*  2026.01.26    clipping            v0001        Frist edit
+******************************************************************************************************************
+******************************************************************************************************************/
+/* Include Headerfiles  */
+#ifndef _HBRIDGE_HWCFG_H_
+#define _HBRIDGE_HWCFG_H_
+
+#include "HBridge_Types.h"
+
+#define HBRIDGE_TLE941XY_EN STD_ON
+#define HBRIDGE_TLE9210X_EN STD_ON
+
+typedef enum
+{
+    HBRIDGE_ID_WINDOW_LIFT = 0u,
+    HBRIDGE_ID_SEAT,
+    HBRIDGE_ID_MAX
+}HBridge_IdType;
+
+/* HBridge_MainFunction cycles both half-bridges stay off on a direction reversal,
+   at least one output frame of the driver has to be sent in between */
+#define HBRIDGE_DEADTIME_CYCLES 2u
+
+extern const HBridge_CfgType cHBridge_atCfg[HBRIDGE_ID_MAX];
+
+#endif
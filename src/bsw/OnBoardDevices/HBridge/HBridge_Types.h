@@ -0,0 +1,62 @@
+/*****************************************************************************************************************
+******************************************************************************************************************
+*  Copyright (C) .
+*  All rights reserved.
+******************************************************************************************************************
+*  FileName: HBridge
+*  Content:  H-bridge abstraction over two half-bridges, types
+*  Category: Tle941xy Tle9210x
+******************************************************************************************************************
+*  Revision Management
+*  yyyy.mm.dd    name              version      description
+*  ----------    --------          -------      -----------------------------------
+*  2026.01.26    clipping            v0001        Frist edit
+******************************************************************************************************************
+******************************************************************************************************************/
+/* Include Headerfiles  */
+#ifndef _HBRIDGE_TYPES_H_
+#define _HBRIDGE_TYPES_H_
+
+#include "Std_Types.h"
+
+typedef enum
+{
+    HBRIDGE_CMD_COAST = 0u,
+    HBRIDGE_CMD_FORWARD,
+    HBRIDGE_CMD_REVERSE,
+    HBRIDGE_CMD_BRAKE
+}HBridge_CmdType;
+
+#define HBRIDGE_DEV_TLE941XY 0u
+#define HBRIDGE_DEV_TLE9210X 1u
+
+/* bridge without PWM channel, forward/reverse are full on */
+#define HBRIDGE_NO_PWM    0xFFu
+/* bridge without ripple counting position */
+#define HBRIDGE_NO_RIPPLE 0xFFu
+
+#define HBRIDGE_DUTY_FULL 0xFFu
+
+/* forward: current from HB A to HB B (A high side, B low side) */
+typedef struct
+{
+    uint8 u8Dev;
+    uint8 u8Group;
+    uint8 u8Chip;
+    uint8 u8HbA;
+    uint8 u8HbB;
+    uint8 u8PwmChn;
+    uint8 u8RippleMotor;
+}HBridge_CfgType;
+
+typedef struct
+{
+    HBridge_CmdType eCmd;
+    HBridge_CmdType eReqCmd;
+    uint8 u8ReqDuty;
+    uint8 u8DeadCnt;
+    uint8 u8PwmHb;
+    boolean bActiveFw;
+}HBridge_StateType;
+
+#endif
@@ -0,0 +1,119 @@
+/*****************************************************************************************************************
+******************************************************************************************************************
+*  Copyright (C) .
+*  All rights reserved.
+******************************************************************************************************************
+*  FileName: ObdPwr
+*  Content:  On board devices power state manager
+*  Category: Tle941xy Tle9210x Vn7x Bjt
+******************************************************************************************************************
+*  Revision Management
+*  yyyy.mm.dd    name              version      description
+*  ----------    --------          -------      -----------------------------------
+*  2026.01.06    clipping            v0001        Frist edit
+******************************************************************************************************************
+******************************************************************************************************************/
+/* Include Headerfiles  */
+#include "ObdPwr.h"
+#if(OBDPWR_TLE941XY_EN == STD_ON)
+#include "Tle941xy.h"
+#endif
+#if(OBDPWR_TLE9210X_EN == STD_ON)
+#include "Tle9210x.h"
+#endif
+#if(OBDPWR_VN7X_EN == STD_ON)
+#include "Vn7x.h"
+#endif
+#if(OBDPWR_BJT_EN == STD_ON)
+#include "Bjt.h"
+#endif
+#if(OBDPWR_HBRIDGE_EN == STD_ON)
+#include "HBridge.h"
+#endif
+
+static ObdPwr_StateType sObdPwr_eState = OBDPWR_STATE_RUN;
+
+/****************************************************************
+ process: ObdPwr_EnterLowerState
+ purpose: Going down: switch off the loads of the HSD drivers first,
+          then quiet the SPI pre-drivers, so no bridge is left
+          driving while its controller is put to sleep.
+ ****************************************************************/
+static void ObdPwr_EnterLowerState(ObdPwr_StateType eState)
+{
+#if(OBDPWR_HBRIDGE_EN == STD_ON)
+    HBridge_SetPowerState(eState);
+#endif
+#if(OBDPWR_VN7X_EN == STD_ON)
+    Vn7x_SetPowerState(eState);
+#endif
+#if(OBDPWR_BJT_EN == STD_ON)
+    Bjt_SetPowerState(eState);
+#endif
+#if(OBDPWR_TLE941XY_EN == STD_ON)
+    Tle941xy_SetPowerState(eState);
+#endif
+#if(OBDPWR_TLE9210X_EN == STD_ON)
+    Tle9210x_SetPowerState(eState);
+#endif
+}
+
+/****************************************************************
+ process: ObdPwr_EnterHigherState
+ purpose: Going up: enable and restore the SPI devices from their
+          cached register images before the HSD loads come back.
+ ****************************************************************/
+static void ObdPwr_EnterHigherState(ObdPwr_StateType eState)
+{
+#if(OBDPWR_TLE9210X_EN == STD_ON)
+    Tle9210x_SetPowerState(eState);
+#endif
+#if(OBDPWR_TLE941XY_EN == STD_ON)
+    Tle941xy_SetPowerState(eState);
+#endif
+#if(OBDPWR_BJT_EN == STD_ON)
+    Bjt_SetPowerState(eState);
+#endif
+#if(OBDPWR_VN7X_EN == STD_ON)
+    Vn7x_SetPowerState(eState);
+#endif
+}
+
+/****************************************************************
+ process: ObdPwr_Init
+ purpose: Drivers are initialised in RUN state.
+ ****************************************************************/
+void ObdPwr_Init(void)
+{
+    sObdPwr_eState = OBDPWR_STATE_RUN;
+}
+
+/****************************************************************
+ process: ObdPwr_SetState
+ purpose: Move all on board devices to the requested power state
+          in a fixed order.
+ ****************************************************************/
+void ObdPwr_SetState(ObdPwr_StateType eState)
+{
+    if((eState <= OBDPWR_STATE_SLEEP) && (eState != sObdPwr_eState))
+    {
+        if(eState > sObdPwr_eState)
+        {
+            ObdPwr_EnterLowerState(eState);
+        }
+        else
+        {
+            ObdPwr_EnterHigherState(eState);
+        }
+        sObdPwr_eState = eState;
+    }
+    else
+    {
+        /* nothing to do */
+    }
+}
+
+ObdPwr_StateType ObdPwr_GetState(void)
+{
+    return sObdPwr_eState;
+}
@@ -0,0 +1,32 @@
+/*****************************************************************************************************************
+******************************************************************************************************************
+*  Copyright (C) .                                                                            
+*  All rights reserved.                                                                                           
+******************************************************************************************************************
+*  FileName: ObdPwr                                                                                             
+*  Content:  On board devices power state manager
+*  Category: Tle941xy Tle9210x Vn7x Bjt
+******************************************************************************************************************
+*  Revision Management                                                                                            
+*  yyyy.mm.dd    name              version      description                                                       
+*  ----------    --------          -------      -----------------------------------                               
+*  2026.01.06    clipping            v0001        Frist edit                                                        
+******************************************************************************************************************
+******************************************************************************************************************/
+/* Include Headerfiles  */
+#ifndef _OBDPWR_H_
+#define _OBDPWR_H_
+
+#include "ObdPwr_Types.h"
+
+#define OBDPWR_TLE941XY_EN STD_ON
+#define OBDPWR_TLE9210X_EN STD_ON
+#define OBDPWR_VN7X_EN     STD_ON
+#define OBDPWR_BJT_EN      STD_ON
+#define OBDPWR_HBRIDGE_EN  STD_ON
+
+extern void ObdPwr_Init(void);
+extern void ObdPwr_SetState(ObdPwr_StateType eState);
+extern ObdPwr_StateType ObdPwr_GetState(void);
+
+#endif
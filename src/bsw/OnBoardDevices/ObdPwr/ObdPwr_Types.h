@@ -0,0 +1,32 @@
+/*****************************************************************************************************************
+******************************************************************************************************************
+*  Copyright (C) .                                                                            
+*  All rights reserved.                                                                                           
+******************************************************************************************************************
+*  FileName: ObdPwr                                                                                             
+*  Content:  On board devices power state types
+*  Category: Tle941xy Tle9210x Vn7x Bjt
+******************************************************************************************************************
+*  Revision Management                                                                                            
+*  yyyy.mm.dd    name              version      description                                                       
+*  ----------    --------          -------      -----------------------------------                               
+*  2026.01.06    clipping            v0001        Frist edit                                                        
+******************************************************************************************************************
+******************************************************************************************************************/
+/* Include Headerfiles  */
+#ifndef _OBDPWR_TYPES_H_
+#define _OBDPWR_TYPES_H_
+
+#include "Std_Types.h"
+
+/* RUN:      outputs, cyclic SPI refresh and diagnostics active
+   LOWPOWER: devices stay enabled, no diagnostics, SPI only when an output changes
+   SLEEP:    outputs off, enable pins low, no SPI traffic */
+typedef enum
+{
+    OBDPWR_STATE_RUN = 0u,
+    OBDPWR_STATE_LOWPOWER,
+    OBDPWR_STATE_SLEEP
+}ObdPwr_StateType;
+
+#endif
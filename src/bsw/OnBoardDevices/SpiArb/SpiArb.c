@@ -0,0 +1,274 @@
+/*****************************************************************************************************************
+******************************************************************************************************************
+*  Copyright (C) .
+*  All rights reserved.
+******************************************************************************************************************
+*  FileName: SpiArb
+*  Content:  SPI bus job arbitration
+*  Category: Tle941xy Tle9210x
+******************************************************************************************************************
+*  Revision Management
+*  yyyy.mm.dd    name              version      description
+*  ----------    --------          -------      -----------------------------------
+*  2026.01.20    clipping            v0001        Frist edit
+******************************************************************************************************************
+******************************************************************************************************************/
+/* Include Headerfiles  */
+#include "SpiArb.h"
+#include "SchM_SpiArb.h"
+#include <stddef.h>
+#include <string.h>
+
+static const uint8 cSpiArb_au8Deadline[SPIARB_PRIO_MAX] =
+{
+    SPIARB_DEADLINE_SAFETY,
+    SPIARB_DEADLINE_OUTPUT,
+    SPIARB_DEADLINE_DIAG,
+    SPIARB_DEADLINE_STAT
+};
+
+/* FIFO per bus and class */
+static SpiArb_JobType sSpiArb_atQueue[SPIARB_BUS_MAX][SPIARB_PRIO_MAX][SPIARB_QUEUE_LEN];
+static uint8 sSpiArb_au8Head[SPIARB_BUS_MAX][SPIARB_PRIO_MAX];
+static uint8 sSpiArb_au8Cnt[SPIARB_BUS_MAX][SPIARB_PRIO_MAX];
+/* bit n set: class n has a pending job, the lowest set bit is served next */
+static uint8 sSpiArb_au8Pending[SPIARB_BUS_MAX];
+/* a job is running on the bus, requests from a preempting context are queued.
+   Queues, counters and this flag are only changed inside SPIARB_EXCLUSIVE_AREA_0, the
+   jobs themselves run outside of it. */
+static boolean sSpiArb_abBusy[SPIARB_BUS_MAX];
+static uint16 sSpiArb_au16DeadlineMiss[SPIARB_BUS_MAX][SPIARB_PRIO_MAX];
+static uint8 sSpiArb_au8MaxLatency[SPIARB_BUS_MAX][SPIARB_PRIO_MAX];
+
+/****************************************************************
+ process: SpiArb_NextPrio
+ purpose: Highest class with a pending job on the bus,
+          SPIARB_PRIO_MAX when the bus is idle.
+ ****************************************************************/
+static uint8 SpiArb_NextPrio(uint8 u8Bus)
+{
+    uint8 l_u8Prio = 0u;
+    uint8 l_u8Pending = sSpiArb_au8Pending[u8Bus];
+
+    while((l_u8Prio < (uint8)SPIARB_PRIO_MAX) && ((l_u8Pending & (uint8)(1u << l_u8Prio)) == 0u))
+    {
+        l_u8Prio++;
+    }
+    return l_u8Prio;
+}
+
+/****************************************************************
+ process: SpiArb_TakeJob
+ purpose: Take the oldest job of the highest pending class up to
+          u8LastPrio, record its latency and mark the bus busy.
+          Returns SPIARB_PRIO_MAX when no job is taken, also when
+          a preempted context is running a job on the bus: that
+          context serves the queue when its job returns.
+ ****************************************************************/
+static uint8 SpiArb_TakeJob(uint8 u8Bus, uint8 u8LastPrio, SpiArb_JobType* ptJob)
+{
+    uint8 l_u8Prio = (uint8)SPIARB_PRIO_MAX;
+
+    SchM_Enter_SpiArb_SPIARB_EXCLUSIVE_AREA_0();
+    if(sSpiArb_abBusy[u8Bus] == FALSE)
+    {
+        l_u8Prio = SpiArb_NextPrio(u8Bus);
+        if(l_u8Prio <= u8LastPrio)
+        {
+            *ptJob = sSpiArb_atQueue[u8Bus][l_u8Prio][sSpiArb_au8Head[u8Bus][l_u8Prio]];
+            sSpiArb_au8Head[u8Bus][l_u8Prio] = (uint8)((sSpiArb_au8Head[u8Bus][l_u8Prio] + 1u) % SPIARB_QUEUE_LEN);
+            sSpiArb_au8Cnt[u8Bus][l_u8Prio]--;
+            if(sSpiArb_au8Cnt[u8Bus][l_u8Prio] == 0u)
+            {
+                sSpiArb_au8Pending[u8Bus] &= (uint8)~(uint8)(1u << l_u8Prio);
+            }
+
+            if(ptJob->u8Age > sSpiArb_au8MaxLatency[u8Bus][l_u8Prio])
+            {
+                sSpiArb_au8MaxLatency[u8Bus][l_u8Prio] = ptJob->u8Age;
+            }
+            if((ptJob->u8Age > cSpiArb_au8Deadline[l_u8Prio]) && (sSpiArb_au16DeadlineMiss[u8Bus][l_u8Prio] < 0xFFFFu))
+            {
+                sSpiArb_au16DeadlineMiss[u8Bus][l_u8Prio]++;
+            }
+            sSpiArb_abBusy[u8Bus] = TRUE;
+        }
+        else
+        {
+            l_u8Prio = (uint8)SPIARB_PRIO_MAX;
+        }
+    }
+    else
+    {
+        /* nothing to do */
+    }
+    SchM_Exit_SpiArb_SPIARB_EXCLUSIVE_AREA_0();
+    return l_u8Prio;
+}
+
+/****************************************************************
+ process: SpiArb_RunJob
+ purpose: Run a taken job outside the exclusive area. The job
+          only sends complete frames, so the bus is free for any
+          class when it returns.
+ ****************************************************************/
+static void SpiArb_RunJob(uint8 u8Bus, const SpiArb_JobType* ptJob)
+{
+    ptJob->pfJob(ptJob->u8Arg);
+
+    SchM_Enter_SpiArb_SPIARB_EXCLUSIVE_AREA_0();
+    sSpiArb_abBusy[u8Bus] = FALSE;
+    SchM_Exit_SpiArb_SPIARB_EXCLUSIVE_AREA_0();
+}
+
+/****************************************************************
+ process: SpiArb_RunSafety
+ purpose: Safety jobs bypass the job budget and are run before
+          anything else at the next frame boundary.
+ ****************************************************************/
+static void SpiArb_RunSafety(uint8 u8Bus)
+{
+    SpiArb_JobType l_tJob;
+
+    while(SpiArb_TakeJob(u8Bus, (uint8)SPIARB_PRIO_SAFETY, &l_tJob) < (uint8)SPIARB_PRIO_MAX)
+    {
+        SpiArb_RunJob(u8Bus, &l_tJob);
+    }
+}
+
+void SpiArb_Init(void)
+{
+    (void)memset(sSpiArb_au8Head,0u,sizeof(sSpiArb_au8Head));
+    (void)memset(sSpiArb_au8Cnt,0u,sizeof(sSpiArb_au8Cnt));
+    (void)memset(sSpiArb_au8Pending,0u,sizeof(sSpiArb_au8Pending));
+    (void)memset(sSpiArb_abBusy,0u,sizeof(sSpiArb_abBusy));
+    (void)memset(sSpiArb_au16DeadlineMiss,0u,sizeof(sSpiArb_au16DeadlineMiss));
+    (void)memset(sSpiArb_au8MaxLatency,0u,sizeof(sSpiArb_au8MaxLatency));
+}
+
+/****************************************************************
+ process: SpiArb_Request
+ purpose: Queue a job on the bus. A job already pending with the
+          same function and argument is not queued twice, so a
+          slow class cannot flood its queue. A safety job on an
+          idle bus is run at once.
+ ****************************************************************/
+Std_ReturnType SpiArb_Request(uint8 u8Bus, SpiArb_PrioType ePrio, SpiArb_JobFuncType pfJob, uint8 u8Arg)
+{
+    uint8 i;
+    uint8 l_u8Slot;
+    boolean l_bFound = FALSE;
+    Std_ReturnType l_u8RetVal = E_NOT_OK;
+
+    if((u8Bus < (uint8)SPIARB_BUS_MAX) && (ePrio < SPIARB_PRIO_MAX) && (pfJob != NULL))
+    {
+        SchM_Enter_SpiArb_SPIARB_EXCLUSIVE_AREA_0();
+        for(i = 0u;(i < sSpiArb_au8Cnt[u8Bus][ePrio]) && (l_bFound == FALSE);i++)
+        {
+            l_u8Slot = (uint8)((sSpiArb_au8Head[u8Bus][ePrio] + i) % SPIARB_QUEUE_LEN);
+            if((sSpiArb_atQueue[u8Bus][ePrio][l_u8Slot].pfJob == pfJob)
+                && (sSpiArb_atQueue[u8Bus][ePrio][l_u8Slot].u8Arg == u8Arg))
+            {
+                l_bFound = TRUE;
+            }
+        }
+
+        if(l_bFound == TRUE)
+        {
+            l_u8RetVal = E_OK;
+        }
+        else if(sSpiArb_au8Cnt[u8Bus][ePrio] < SPIARB_QUEUE_LEN)
+        {
+            l_u8Slot = (uint8)((sSpiArb_au8Head[u8Bus][ePrio] + sSpiArb_au8Cnt[u8Bus][ePrio]) % SPIARB_QUEUE_LEN);
+            sSpiArb_atQueue[u8Bus][ePrio][l_u8Slot].pfJob = pfJob;
+            sSpiArb_atQueue[u8Bus][ePrio][l_u8Slot].u8Arg = u8Arg;
+            sSpiArb_atQueue[u8Bus][ePrio][l_u8Slot].u8Age = 0u;
+            sSpiArb_au8Cnt[u8Bus][ePrio]++;
+            sSpiArb_au8Pending[u8Bus] |= (uint8)(1u << (uint8)ePrio);
+            l_u8RetVal = E_OK;
+        }
+        else
+        {
+            /* queue full, the caller requests again next cycle */
+        }
+        SchM_Exit_SpiArb_SPIARB_EXCLUSIVE_AREA_0();
+
+        if(ePrio == SPIARB_PRIO_SAFETY)
+        {
+            SpiArb_RunSafety(u8Bus);
+        }
+        else
+        {
+            /* nothing to do */
+        }
+    }
+    return l_u8RetVal;
+}
+
+/****************************************************************
+ process: SpiArb_MainFunction
+ purpose: Serve every bus in priority order. After each job the
+          highest pending class is picked again, so an output
+          update queued meanwhile overtakes the remaining
+          diagnostic jobs. Jobs left over age by one call.
+ ****************************************************************/
+void SpiArb_MainFunction(void)
+{
+    uint8 l_u8Bus;
+    uint8 l_u8Prio;
+    uint8 l_u8Budget;
+    uint8 i;
+    uint8 l_u8Slot;
+    SpiArb_JobType l_tJob;
+
+    for(l_u8Bus = 0u;l_u8Bus < (uint8)SPIARB_BUS_MAX;l_u8Bus++)
+    {
+        l_u8Budget = SPIARB_JOBS_PER_CALL;
+        l_u8Prio = SpiArb_TakeJob(l_u8Bus, (uint8)SPIARB_PRIO_MAX - 1u, &l_tJob);
+        while(l_u8Prio < (uint8)SPIARB_PRIO_MAX)
+        {
+            if(l_u8Prio != (uint8)SPIARB_PRIO_SAFETY)
+            {
+                l_u8Budget--;
+            }
+            SpiArb_RunJob(l_u8Bus, &l_tJob);
+            l_u8Prio = SpiArb_TakeJob(l_u8Bus, (l_u8Budget > 0u) ? ((uint8)SPIARB_PRIO_MAX - 1u) : (uint8)SPIARB_PRIO_SAFETY, &l_tJob);
+        }
+
+        SchM_Enter_SpiArb_SPIARB_EXCLUSIVE_AREA_0();
+        for(l_u8Prio = 0u;l_u8Prio < (uint8)SPIARB_PRIO_MAX;l_u8Prio++)
+        {
+            for(i = 0u;i < sSpiArb_au8Cnt[l_u8Bus][l_u8Prio];i++)
+            {
+                l_u8Slot = (uint8)((sSpiArb_au8Head[l_u8Bus][l_u8Prio] + i) % SPIARB_QUEUE_LEN);
+                if(sSpiArb_atQueue[l_u8Bus][l_u8Prio][l_u8Slot].u8Age < 0xFFu)
+                {
+                    sSpiArb_atQueue[l_u8Bus][l_u8Prio][l_u8Slot].u8Age++;
+                }
+            }
+        }
+        SchM_Exit_SpiArb_SPIARB_EXCLUSIVE_AREA_0();
+    }
+}
+
+uint16 SpiArb_GetDeadlineMissCnt(uint8 u8Bus, SpiArb_PrioType ePrio)
+{
+    uint16 l_u16Cnt = 0u;
+
+    if((u8Bus < (uint8)SPIARB_BUS_MAX) && (ePrio < SPIARB_PRIO_MAX))
+    {
+        l_u16Cnt = sSpiArb_au16DeadlineMiss[u8Bus][ePrio];
+    }
+    return l_u16Cnt;
+}
+
+uint8 SpiArb_GetMaxLatency(uint8 u8Bus, SpiArb_PrioType ePrio)
+{
+    uint8 l_u8Latency = 0u;
+
+    if((u8Bus < (uint8)SPIARB_BUS_MAX) && (ePrio < SPIARB_PRIO_MAX))
+    {
+        l_u8Latency = sSpiArb_au8MaxLatency[u8Bus][ePrio];
+    }
+    return l_u8Latency;
+}
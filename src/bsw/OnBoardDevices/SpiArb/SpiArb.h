@@ -0,0 +1,47 @@
+/*****************************************************************************************************************
+******************************************************************************************************************
+*  Copyright (C) .                                                                            
+*  All rights reserved.                                                                                           
+******************************************************************************************************************
+*  FileName: SpiArb                                                                                             
+*  Content:  SPI bus job arbitration
+*  Category: Tle941xy Tle9210x
+******************************************************************************************************************
+*  Revision Management                                                                                            
+*  yyyy.mm.dd    name              version      description                                                       
+*  ----------    --------          -------      -----------------------------------                               
+*  2026.01.20    clipping            v0001        Frist edit                                                        
+******************************************************************************************************************
+******************************************************************************************************************/
+/* Include Headerfiles  */
+#ifndef _SPIARB_H_
+#define _SPIARB_H_
+
+#include "SpiArb_Types.h"
+
+/* physical SPI units, the driver group configuration names the unit of each group */
+typedef enum
+{
+    SPIARB_BUS_0 = 0u,
+    SPIARB_BUS_1 = 1u,
+    SPIARB_BUS_MAX
+}SpiArb_BusId_e;
+
+/* pending jobs per bus and class */
+#define SPIARB_QUEUE_LEN 4u
+/* jobs per bus and SpiArb_MainFunction call, safety jobs are not counted */
+#define SPIARB_JOBS_PER_CALL 4u
+
+/* deadline of each class in SpiArb_MainFunction calls, a job served later counts as a miss */
+#define SPIARB_DEADLINE_SAFETY 0u
+#define SPIARB_DEADLINE_OUTPUT 1u
+#define SPIARB_DEADLINE_DIAG   10u
+#define SPIARB_DEADLINE_STAT   100u
+
+extern void SpiArb_Init(void);
+extern void SpiArb_MainFunction(void);
+extern Std_ReturnType SpiArb_Request(uint8 u8Bus, SpiArb_PrioType ePrio, SpiArb_JobFuncType pfJob, uint8 u8Arg);
+extern uint16 SpiArb_GetDeadlineMissCnt(uint8 u8Bus, SpiArb_PrioType ePrio);
+extern uint8 SpiArb_GetMaxLatency(uint8 u8Bus, SpiArb_PrioType ePrio);
+
+#endif
@@ -0,0 +1,42 @@
+/*****************************************************************************************************************
+******************************************************************************************************************
+*  Copyright (C) .                                                                            
+*  All rights reserved.                                                                                           
+******************************************************************************************************************
+*  FileName: SpiArb                                                                                             
+*  Content:  SPI bus job arbitration types
+*  Category: Tle941xy Tle9210x
+******************************************************************************************************************
+*  Revision Management                                                                                            
+*  yyyy.mm.dd    name              version      description                                                       
+*  ----------    --------          -------      -----------------------------------                               
+*  2026.01.20    clipping            v0001        Frist edit                                                        
+******************************************************************************************************************
+******************************************************************************************************************/
+/* Include Headerfiles  */
+#ifndef _SPIARB_TYPES_H_
+#define _SPIARB_TYPES_H_
+
+#include "Std_Types.h"
+
+/* priority classes, lower value is served first */
+typedef enum
+{
+    SPIARB_PRIO_SAFETY = 0u,    /* outputs off on shutdown / sleep */
+    SPIARB_PRIO_OUTPUT,         /* actuator update */
+    SPIARB_PRIO_DIAG,           /* diagnostic register reads */
+    SPIARB_PRIO_STAT,           /* statistics, identification */
+    SPIARB_PRIO_MAX
+}SpiArb_PrioType;
+
+/* one job is a short run of complete frames, the bus is handed over between two jobs */
+typedef void (*SpiArb_JobFuncType)(uint8 u8Arg);
+
+typedef struct
+{
+    SpiArb_JobFuncType pfJob;
+    uint8 u8Arg;
+    uint8 u8Age;
+}SpiArb_JobType;
+
+#endif
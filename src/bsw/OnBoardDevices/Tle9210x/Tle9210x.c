@@ -16,9 +16,14 @@
 /* Include Headerfiles  */
 #include "Tle9210x.h"
 #include "Pfm.h"
+#include "IoChnReg.h"
 #include "Spi.h"
 #include "LiBool.h"
 #include "Pwm.h"
+#if(TLE9210X_RIPPLE_EN == STD_ON)
+#include "Tle9210x_Ripple.h"
+#endif
+#include <string.h>
 
 static boolean sTle9210x_abREGBANKSts[TLE9210X_GROUP_MAX][TLE9210X_CHIP_MAX];
 static uint8 sTle9210x_au8GlobalStatus[TLE9210X_GROUP_MAX][TLE9210X_CHIP_MAX];
@@ -31,12 +36,159 @@ static uint16 sTle9210x_au16GenCtrl1[TLE9210X_GROUP_MAX][TLE9210X_CHIP_MAX];
 static uint16 sTle9210x_au16GenCtrl2[TLE9210X_GROUP_MAX][TLE9210X_CHIP_MAX];
 
 static Tle9210x_GenStsRegType sTle9210x_atGenStsReport[TLE9210X_GROUP_MAX][TLE9210X_CHIP_MAX];
-
+static ObdPwr_StateType sTle9210x_ePwrState = OBDPWR_STATE_RUN;
+/* output image changed since the last HBMODE/PWM update, used in low power */
+static boolean sTle9210x_abOutDirty[TLE9210X_GROUP_MAX];
+/* active freewheeling per PWM channel (bit n: channel n) and PWMSET changed since it was last written */
+static uint8 sTle9210x_au8PwmAfw[TLE9210X_GROUP_MAX][TLE9210X_CHIP_MAX];
+static boolean sTle9210x_abPwmSetDirty[TLE9210X_GROUP_MAX];
+#if(TLE9210X_EVENT_OUTPUT_EN == STD_ON)
+/* main cycles since the last output refresh */
+static uint8 sTle9210x_au8OutRefreshCnt[TLE9210X_GROUP_MAX];
+#endif
+/* groups and chips per group present in the selected variant, the loops only run over these */
+static uint8 sTle9210x_u8GroupNum;
+static uint8 sTle9210x_au8ChipNum[TLE9210X_GROUP_MAX];
+/* init progress per group, the cyclic functions skip groups that are not ready */
+static Tle9210x_InitStepType sTle9210x_aeInitStep[TLE9210X_GROUP_MAX];
+/* group woke up from sleep: the init sequence sets normal mode, then restores the cache */
+static boolean sTle9210x_abWakeRestore[TLE9210X_GROUP_MAX];
+/* rejected frames and frames still rejected after all retries, per group */
+static uint16 sTle9210x_au16FrameErrCnt[TLE9210X_GROUP_MAX];
+static uint16 sTle9210x_au16FrameLostCnt[TLE9210X_GROUP_MAX];
+/* a frame of the group was lost in this cycle, its diagnostic result is not used */
+static boolean sTle9210x_abFrameLost[TLE9210X_GROUP_MAX];
+/* VOUT level expected from the last HBMODE write (bit set: HS on), the HBs it holds for
+   (LS or HS on, not PWM mapped) and the HBs changed by that write, one bit per HB */
+static uint8 sTle9210x_au8VoutExp[TLE9210X_GROUP_MAX][TLE9210X_CHIP_MAX];
+static uint8 sTle9210x_au8VoutCare[TLE9210X_GROUP_MAX][TLE9210X_CHIP_MAX];
+static uint8 sTle9210x_au8VoutSettle[TLE9210X_GROUP_MAX][TLE9210X_CHIP_MAX];
+/* addresses of the banked registers, ACT (bank off) and FW/INIT (bank on) share them */
+static const uint8 cTle9210x_au8BankRegAddr[TLE9210X_BANK_REG_NUM] =
+{
+    TLE9210X_CCP_BLK2_ACT,
+    TLE9210X_ST_ICHG,
+    TLE9210X_PWM_ICHG_ACT,
+    TLE9210X_PWM_IDCHG_ACT,
+    TLE9210X_PWM_ICHGMAX_CCP_BLK3_ACT
+};
+/* banked register image set by Tle9210x_WriteBankReg. Mask bit (bank * TLE9210X_BANK_REG_NUM + index):
+   entry changed and not yet written / entry ever set, rewritten after wake up */
+static uint16 sTle9210x_au16BankRegImg[TLE9210X_GROUP_MAX][2u][TLE9210X_BANK_REG_NUM][TLE9210X_CHIP_MAX];
+static uint16 sTle9210x_au16BankRegDirty[TLE9210X_GROUP_MAX];
+static uint16 sTle9210x_au16BankRegUsed[TLE9210X_GROUP_MAX];
+
+static Std_ReturnType Tle9210x_CheckFrame(uint8 u8GroupId, const uint8* pu8RcvBuf, uint8 u8Len);
+static Std_ReturnType Tle9210x_Transfer(uint8 u8GroupId, const uint8* pu8SndBuf, uint8* pu8RcvBuf, uint8 u8Len);
 static void Tle9210x_WriteReg(uint8 u8GroupId,uint8* pu8RegBuf, uint16* pu16WtData);
 static void Tle9210x_ReadReg( uint8 u8GroupId,uint8* pu8RegBuf,uint16* pu16ReadBuf);
 static void Tle9210x_SetChipMode(uint8 u8GroupId,uint8 u8Mode);
 static void Tle9210x_GetChipMode(uint8 u8GroupId,uint8 u8ChipId,uint8* pu8Mode);
 static void Tle9210x_SetGenCtrlReg(uint8 u8Group);
+static void Tle9210x_RestoreReg(uint8 u8Group);
+static uint8 Tle9210x_GetGroupBank(uint8 u8Group);
+static void Tle9210x_SetRegBank(uint8 u8Group,uint8 u8Bank);
+static void Tle9210x_WritePlanEntry(uint8 u8Group, const Tle9210x_RegAccessType* ptAcc);
+static void Tle9210x_WritePlan(uint8 u8Group, const Tle9210x_RegAccessType* ptPlan, uint8 u8Num);
+static uint8 Tle9210x_AddBankRegPlan(uint8 u8Group, uint16 u16Mask, Tle9210x_RegAccessType* ptPlan, uint8 u8Num);
+static void Tle9210x_SetPwmActOrFw(uint8 u8Group, boolean bGenCtrl1);
+static boolean Tle9210x_IsWdgEn(uint8 u8Group);
+static void Tle9210x_ReportDiag(uint8 u8Group);
+#if(TLE9210X_VOUT_DIAG_EN == STD_ON)
+static boolean Tle9210x_ReadVout(uint8 u8Group);
+static void Tle9210x_ClrOVDiagnostic(uint8 u8Group);
+static void Tle9210x_VoutDiagnostic(uint8 u8Group);
+#endif
+static void Tle9210x_SelectVariant(void);
+static void Tle9210x_InitGroupStep(uint8 u8Group);
+static void Tle9210x_InitJob(uint8 u8Group);
+static void Tle9210x_DiagJob(uint8 u8Group);
+static void Tle9210x_OutputJob(uint8 u8Group);
+static boolean Tle9210x_IsOutputDue(uint8 u8Group);
+static void Tle9210x_ShutdownJob(uint8 u8Group);
+static void Tle9210x_RestoreJob(uint8 u8Group);
+static void Tle9210x_OffJob(uint8 u8Group);
+static void Tle9210x_WdgJob(uint8 u8Group);
+static void Tle9210x_Submit(uint8 u8Group, SpiArb_PrioType ePrio, SpiArb_JobFuncType pfJob);
+/****************************************************************************************
+| NAME:    Tle9210x_CheckFrame
+| CALLED BY:     Tle9210x_Transfer
+| PRECONDITIONS:     frame of the group transmitted
+| INPUT PARAMETERS:    uint8 u8GroupId, const uint8* pu8RcvBuf, uint8 u8Len
+| RETURN VALUE:     E_OK: frame accepted, E_NOT_OK: frame rejected
+| DESCRIPTION:      reject the frame when a chip flags an SPI error in its global status
+|                   byte. An all 0x00 frame is a valid answer of an idle chip.
+****************************************************************************************/
+static Std_ReturnType Tle9210x_CheckFrame(uint8 u8GroupId, const uint8* pu8RcvBuf, uint8 u8Len)
+{
+    uint8 l_u8Index;
+    Std_ReturnType l_u8RetVal = E_OK;
+
+    (void)u8Len;
+    for(l_u8Index = 0u;l_u8Index < sTle9210x_au8ChipNum[u8GroupId];l_u8Index++)
+    {
+        if((pu8RcvBuf[l_u8Index] & TLE9210X_GSB_SPI_ERR) != 0u)
+        {
+            l_u8RetVal = E_NOT_OK;
+        }
+        else
+        {
+            /* nothing to do */
+        }
+    }
+    return l_u8RetVal;
+}
+
+/****************************************************************************************
+| NAME:    Tle9210x_Transfer
+| CALLED BY:     Tle9210x_WriteReg, Tle9210x_ReadReg
+| PRECONDITIONS:     NA
+| INPUT PARAMETERS:    uint8 u8GroupId, send/receive buffer, frame length
+| RETURN VALUE:     E_OK: frame accepted, E_NOT_OK: frame lost
+| DESCRIPTION:      send one daisy chain frame and check it. A rejected frame is sent
+|                   again up to TLE9210X_SPI_RETRY_MAX times on this group only, the
+|                   other groups and the register image are not touched.
+****************************************************************************************/
+static Std_ReturnType Tle9210x_Transfer(uint8 u8GroupId, const uint8* pu8SndBuf, uint8* pu8RcvBuf, uint8 u8Len)
+{
+    uint8 l_u8Try;
+    Std_ReturnType l_u8RetVal = E_NOT_OK;
+
+    for(l_u8Try = 0u;(l_u8Try <= TLE9210X_SPI_RETRY_MAX) && (l_u8RetVal != E_OK);l_u8Try++)
+    {
+        if((Spi_SetupEB(cTle9210x_atGroupCfg[u8GroupId].SpiChannel, pu8SndBuf, pu8RcvBuf, u8Len) == E_OK)
+            && (Spi_SyncTransmit(cTle9210x_atGroupCfg[u8GroupId].SpiSequence) == E_OK))
+        {
+            l_u8RetVal = Tle9210x_CheckFrame(u8GroupId, pu8RcvBuf, u8Len);
+        }
+        else
+        {
+            l_u8RetVal = E_NOT_OK;
+        }
+        if((l_u8RetVal != E_OK) && (sTle9210x_au16FrameErrCnt[u8GroupId] < 0xFFFFu))
+        {
+            sTle9210x_au16FrameErrCnt[u8GroupId]++;
+        }
+        else
+        {
+            /* nothing to do */
+        }
+    }
+    if(l_u8RetVal != E_OK)
+    {
+        if(sTle9210x_au16FrameLostCnt[u8GroupId] < 0xFFFFu)
+        {
+            sTle9210x_au16FrameLostCnt[u8GroupId]++;
+        }
+        sTle9210x_abFrameLost[u8GroupId] = TRUE;
+    }
+    else
+    {
+        /* nothing to do */
+    }
+    return l_u8RetVal;
+}
+
 /****************************************************************************************
 | NAME:    Tle9210x_WriteReg
 | CALLED BY:
@@ -49,34 +201,37 @@ static void Tle9210x_WriteReg(uint8 u8GroupId,uint8* pu8RegBuf, uint16* pu16WtDa
 {
     uint8 l_u8ChipIndex;
     uint8 l_u8ChipNum;
-    uint8 l_au8RcvDataBuf[TLE9210X_CHIP_MAX * 3] = {0};
-    uint8 l_au8SndDataBuf[TLE9210X_CHIP_MAX * 3] = {0};
+    uint8 l_au8RcvDataBuf[TLE9210X_CHIP_MAX * 3u] = {0};
+    uint8 l_au8SndDataBuf[TLE9210X_CHIP_MAX * 3u] = {0};
 
-    l_u8ChipNum = *cTle9210x_atGroupCfg[u8GroupId].pu8ChipNum;
+    l_u8ChipNum = sTle9210x_au8ChipNum[u8GroupId];
 
     if(l_u8ChipNum > 0u)
     {
-        /* Reversal data buffer */
+        /* address bytes of all chips first, then the 16 bit data of all chips */
         for(l_u8ChipIndex = 0u; l_u8ChipIndex < l_u8ChipNum; l_u8ChipIndex++)
         {
-            l_au8SndDataBuf[3*l_u8ChipNum - l_u8ChipIndex] =(uint8)(TLE9210X_BASE_ADDR 
+            l_au8SndDataBuf[l_u8ChipIndex] =(uint8)(TLE9210X_BASE_ADDR 
                                             | (uint8)(TLE9210X_LABT_OFF << 7u) 
                                             | (uint8)(pu8RegBuf[(l_u8ChipIndex)] << 1u) 
                                             | TLE9210X_OP_RW_OR_R1C);
-            l_au8SndDataBuf[2*l_u8ChipIndex] = pu16WtData[l_u8ChipIndex] ;
-            l_au8SndDataBuf[2*l_u8ChipIndex + 1u] = (uint8)(pu16WtData[l_u8ChipIndex] >> 8u);
+            l_au8SndDataBuf[l_u8ChipNum + 2u * l_u8ChipIndex] = (uint8)pu16WtData[l_u8ChipIndex];
+            l_au8SndDataBuf[l_u8ChipNum + 2u * l_u8ChipIndex + 1u] = (uint8)(pu16WtData[l_u8ChipIndex] >> 8u);
         }
         /****The last chip control LABT is 1 whether it is daisy chain communication or not********/
-        l_au8SndDataBuf[2*l_u8ChipNum + 1u] |= (TLE9210X_LABT_ON << 7u);
+        l_au8SndDataBuf[l_u8ChipNum - 1u] |= (uint8)(TLE9210X_LABT_ON << 7u);
 
-        /* Send Read  */
-        (void)Spi_SetupEB(cTle9210x_atGroupCfg[u8GroupId].SpiChannel, &l_au8SndDataBuf[0], &l_au8RcvDataBuf[0], (l_u8ChipNum * 3));
-
-        (void)Spi_SyncTransmit(cTle9210x_atGroupCfg[u8GroupId].SpiSequence);
-
-        for(l_u8ChipIndex = 0u; l_u8ChipIndex < l_u8ChipNum; l_u8ChipIndex++)
+        /* Send Write  */
+        if(Tle9210x_Transfer(u8GroupId, &l_au8SndDataBuf[0], &l_au8RcvDataBuf[0], (uint8)(l_u8ChipNum * 3u)) == E_OK)
         {
-            sTle9210x_au8GlobalStatus[u8GroupId][l_u8ChipIndex] = l_au8RcvDataBuf[(3u * l_u8ChipNum - l_u8ChipIndex - 1u)];
+            for(l_u8ChipIndex = 0u; l_u8ChipIndex < l_u8ChipNum; l_u8ChipIndex++)
+            {
+                sTle9210x_au8GlobalStatus[u8GroupId][l_u8ChipIndex] = l_au8RcvDataBuf[(l_u8ChipNum - l_u8ChipIndex - 1u)];
+            }
+        }
+        else
+        {
+            /* frame lost, keep the last global status */
         }
     }
     else
@@ -95,36 +250,40 @@ static void Tle9210x_WriteReg(uint8 u8GroupId,uint8* pu8RegBuf, uint16* pu16WtDa
 ****************************************************************************************/
 static void Tle9210x_ReadReg( uint8 u8GroupId,uint8* pu8RegBuf,uint16* pu16ReadBuf)
 {
-
     uint8 l_u8ChipIndex;
     uint8 l_u8ChipNum;
-    uint16 l_au8RcvDataBuf[TLE9210X_CHIP_MAX * 3u] = {0};
-    uint16 l_au8SndDataBuf[TLE9210X_CHIP_MAX * 3u] = {0};
+    uint8 l_u8DataIndex;
+    uint8 l_au8RcvDataBuf[TLE9210X_CHIP_MAX * 3u] = {0};
+    uint8 l_au8SndDataBuf[TLE9210X_CHIP_MAX * 3u] = {0};
 
-    l_u8ChipNum = *cTle9210x_atGroupCfg[u8GroupId].pu8ChipNum;
+    l_u8ChipNum = sTle9210x_au8ChipNum[u8GroupId];
 
     if(l_u8ChipNum > 0u)
     {
-        /* Reversal data buffer */
+        /* address bytes of all chips first, the data bytes are clocked as 0 */
         for(l_u8ChipIndex = 0u; l_u8ChipIndex < l_u8ChipNum; l_u8ChipIndex++)
         {
-            l_au8SndDataBuf[3*l_u8ChipNum - l_u8ChipIndex] =(uint8)(TLE9210X_BASE_ADDR 
+            l_au8SndDataBuf[l_u8ChipIndex] =(uint8)(TLE9210X_BASE_ADDR 
                                             | (uint8)(TLE9210X_LABT_OFF << 7u) 
                                             | (uint8)(pu8RegBuf[(l_u8ChipIndex)] << 1u) 
                                             | TLE9210X_OP_READ_ONLY);
         }
         /****The last chip control LABT is 1 whether it is daisy chain communication or not********/
-        l_au8SndDataBuf[2*l_u8ChipNum + 1u] |= (uint8)(TLE9210X_LABT_ON << 7u);
+        l_au8SndDataBuf[l_u8ChipNum - 1u] |= (uint8)(TLE9210X_LABT_ON << 7u);
 
         /* Send Read  */
-        (void)Spi_SetupEB(cTle9210x_atGroupCfg[u8GroupId].SpiChannel, &l_au8SndDataBuf[0], &l_au8RcvDataBuf[0], (l_u8ChipNum * 2u));
-
-        (void)Spi_SyncTransmit(cTle9210x_atGroupCfg[u8GroupId].SpiSequence);
-
-        for(l_u8ChipIndex = 0u; l_u8ChipIndex < l_u8ChipNum; l_u8ChipIndex++)
+        if(Tle9210x_Transfer(u8GroupId, &l_au8SndDataBuf[0], &l_au8RcvDataBuf[0], (uint8)(l_u8ChipNum * 3u)) == E_OK)
+        {
+            for(l_u8ChipIndex = 0u; l_u8ChipIndex < l_u8ChipNum; l_u8ChipIndex++)
+            {
+                l_u8DataIndex = (uint8)(l_u8ChipNum + 2u * (l_u8ChipNum - l_u8ChipIndex - 1u));
+                pu16ReadBuf[l_u8ChipIndex] = (uint16)((uint16)l_au8RcvDataBuf[l_u8DataIndex + 1u] << 8u) + l_au8RcvDataBuf[l_u8DataIndex];
+                sTle9210x_au8GlobalStatus[u8GroupId][l_u8ChipIndex] = l_au8RcvDataBuf[(l_u8ChipNum - l_u8ChipIndex - 1u)];
+            }
+        }
+        else
         {
-            pu16ReadBuf[l_u8ChipIndex] = (uint16)(l_au8RcvDataBuf[l_u8ChipNum * 2u + 1u] << 8u) + l_au8RcvDataBuf[l_u8ChipNum * 2u];
-            sTle9210x_au8GlobalStatus[u8GroupId][l_u8ChipIndex] = l_au8RcvDataBuf[(3u*l_u8ChipNum - l_u8ChipIndex - 1u)];
+            /* frame lost, the read buffer keeps its caller values */
         }
     }
     else
@@ -140,7 +299,7 @@ static void Tle9210x_SetChipMode(uint8 u8GroupId,uint8 u8Mode)
     uint8 j;
     uint8 l_u8ChipNum;
 
-    l_u8ChipNum = *cTle9210x_atGroupCfg[u8GroupId].pu8ChipNum;
+    l_u8ChipNum = sTle9210x_au8ChipNum[u8GroupId];
     for(j = 0u;j < l_u8ChipNum;j++)
     {
         switch(u8Mode)
@@ -177,10 +336,10 @@ static void Tle9210x_SetGenCtrlReg(uint8 u8Group)
 
     uint8 j;
     uint8 l_au8RegBuf[TLE9210X_CHIP_MAX] = {0};
-    uint8 l_au16DataBuf[TLE9210X_CHIP_MAX] = {0};
+    uint16 l_au16DataBuf[TLE9210X_CHIP_MAX] = {0};
     uint8 l_u8ChipNum;
 
-    l_u8ChipNum = *cTle9210x_atGroupCfg[u8Group].pu8ChipNum;
+    l_u8ChipNum = sTle9210x_au8ChipNum[u8Group];
 
     for(j = 0u;j < l_u8ChipNum;j++)
     {
@@ -208,6 +367,7 @@ static void Tle9210x_SetGenCtrlReg(uint8 u8Group)
     {
         l_au16DataBuf[j] &= 0xfdffu;
         l_au16DataBuf[j] |= (uint16)(cTle9210x_atChipCfg[u8Group][j].WDDIS << 9u);
+        sTle9210x_au16GenCtrl2[u8Group][j] = l_au16DataBuf[j];
     }
     Tle9210x_WriteReg(u8Group,l_au8RegBuf,l_au16DataBuf);
 
@@ -217,10 +377,10 @@ static void Tle9210x_SetVDSReg(uint8 u8Group)
 {
     uint8 j;
     uint8 l_au8RegBuf[TLE9210X_CHIP_MAX] = {0};
-    uint8 l_au16DataBuf[TLE9210X_CHIP_MAX] = {0};
+    uint16 l_au16DataBuf[TLE9210X_CHIP_MAX] = {0};
     uint8 l_u8ChipNum;
 
-    l_u8ChipNum = *cTle9210x_atGroupCfg[u8Group].pu8ChipNum;
+    l_u8ChipNum = sTle9210x_au8ChipNum[u8Group];
 
     for(j = 0u;j < l_u8ChipNum;j++)
     {
@@ -260,141 +420,333 @@ static void Tle9210x_SetHbOutputReg(uint8 u8Group)
 {
 
     uint8 j;
+    uint8 k;
     uint8 l_au8RegBuf[TLE9210X_CHIP_MAX] = {0};
-    uint8 l_au16DataBuf[TLE9210X_CHIP_MAX] = {0};
+    uint16 l_au16DataBuf[TLE9210X_CHIP_MAX] = {0};
     uint8 l_u8ChipNum;
+    uint8 l_u8Sts;
+    uint8 l_u8Exp;
+    uint8 l_u8Care;
 
-    l_u8ChipNum = *cTle9210x_atGroupCfg[u8Group].pu8ChipNum;
-    /***OUT1-OUT4**/
+    l_u8ChipNum = sTle9210x_au8ChipNum[u8Group];
+    /***HB1-HB8**/
     for(j = 0u;j < l_u8ChipNum;j++)
     {
         l_au8RegBuf[j] = TLE9210X_HBMODE;
-        l_au16DataBuf[j] = (sTle9210x_au8HbOutSts[u8Group][j][0] 
-                        | (uint8)(sTle9210x_au8HbOutSts[u8Group][j][1] << 2u)
-                        | (uint8)(sTle9210x_au8HbOutSts[u8Group][j][2] << 4u)
-                        | (uint8)(sTle9210x_au8HbOutSts[u8Group][j][3] << 6u)
-                        | (uint8)(sTle9210x_au8HbOutSts[u8Group][j][4] << 8u)
-                        | (uint8)(sTle9210x_au8HbOutSts[u8Group][j][5] << 10u)
-                        | (uint8)(sTle9210x_au8HbOutSts[u8Group][j][6] << 12u)
-                        | (uint8)(sTle9210x_au8HbOutSts[u8Group][j][7] << 14u));
+        l_u8Exp = 0u;
+        l_u8Care = 0u;
+        for(k = 0u;k < TLE9210X_HB_CHN_MAX;k++)
+        {
+            l_u8Sts = sTle9210x_au8HbOutSts[u8Group][j][k];
+            l_au16DataBuf[j] |= (uint16)((uint16)l_u8Sts << (2u * k));
+            if(l_u8Sts == TLE9210X_OUT_STATUS_HS)
+            {
+                l_u8Exp |= (uint8)(1u << k);
+                l_u8Care |= (uint8)(1u << k);
+            }
+            else if(l_u8Sts == TLE9210X_OUT_STATUS_LS)
+            {
+                l_u8Care |= (uint8)(1u << k);
+            }
+            else
+            {
+                /* HB off: VOUT floats */
+            }
+        }
+        /* a HB switched by a PWM channel toggles, its VOUT level is not checked */
+        for(k = 0u;k < TLE9210X_PWM_CHN_MAX;k++)
+        {
+            if(cTle9210x_atPwmChnCfg[u8Group][j][k].bPwmEn == TLE9210X_PWM_ENABLE)
+            {
+                l_u8Care &= (uint8)~(uint8)(1u << cTle9210x_atPwmChnCfg[u8Group][j][k].u8PwmMapChn);
+            }
+            else
+            {
+                /* nothing to do */
+            }
+        }
+        sTle9210x_au8VoutSettle[u8Group][j] |= (uint8)((l_u8Exp ^ sTle9210x_au8VoutExp[u8Group][j])
+                                            | (l_u8Care ^ sTle9210x_au8VoutCare[u8Group][j]));
+        sTle9210x_au8VoutExp[u8Group][j] = l_u8Exp;
+        sTle9210x_au8VoutCare[u8Group][j] = l_u8Care;
     }
     Tle9210x_WriteReg(u8Group,l_au8RegBuf,l_au16DataBuf);
 
 }
 
-static void Tle9210x_SetPwmActOrFw(uint8 u8Group)
+/****************************************************************************************
+| NAME:    Tle9210x_GetGroupBank
+| CALLED BY:     Tle9210x_SetRegBank, Tle9210x_WritePlan
+| PRECONDITIONS:     NA
+| INPUT PARAMETERS:    uint8 u8Group
+| RETURN VALUE:     REG_BANK of all chips, TLE9210X_REG_BANK_ANY when the chips differ
+| DESCRIPTION:      register bank selected in the group
+****************************************************************************************/
+static uint8 Tle9210x_GetGroupBank(uint8 u8Group)
 {
     uint8 j;
-    uint8 l_au8RegBuf[TLE9210X_CHIP_MAX] = {0};
-    uint8 l_au16DataBuf[TLE9210X_CHIP_MAX] = {0};
+    uint8 l_u8Bank;
     uint8 l_u8ChipNum;
 
-    l_u8ChipNum = *cTle9210x_atGroupCfg[u8Group].pu8ChipNum;
-    for(j = 0u;j < l_u8ChipNum;j++)
+    l_u8ChipNum = sTle9210x_au8ChipNum[u8Group];
+    l_u8Bank = (uint8)sTle9210x_abREGBANKSts[u8Group][0];
+    for(j = 1u;j < l_u8ChipNum;j++)
     {
-        if(sTle9210x_abREGBANKSts[u8Group][j] == TLE9210X_REG_BANK_OFF)
+        if(sTle9210x_abREGBANKSts[u8Group][j] != sTle9210x_abREGBANKSts[u8Group][0])
         {
-            l_au8RegBuf[j] = TLE9210X_CCP_BLK2_ACT;
+            l_u8Bank = TLE9210X_REG_BANK_ANY;
         }
         else
         {
-            l_au8RegBuf[j] = TLE9210X_CCP_BLK2_FW;
+            /* nothing to do */
         }
     }
-    Tle9210x_WriteReg(u8Group,l_au8RegBuf,l_au16DataBuf);
+    return l_u8Bank;
+}
+
+/****************************************************************************************
+| NAME:    Tle9210x_SetRegBank
+| CALLED BY:     Tle9210x_WritePlan
+| PRECONDITIONS:     GENCTRL1 cache valid (Tle9210x_SetGenCtrlReg done)
+| INPUT PARAMETERS:    uint8 u8Group, uint8 u8Bank: TLE9210X_REG_BANK_OFF/ON, ANY keeps the cached bit
+| RETURN VALUE:     void
+| DESCRIPTION:      write GENCTRL1 of all chips from the cache with the REG_BANK bit set,
+|                   one frame, no read back
+****************************************************************************************/
+static void Tle9210x_SetRegBank(uint8 u8Group,uint8 u8Bank)
+{
+    uint8 j;
+    uint8 l_au8RegBuf[TLE9210X_CHIP_MAX] = {0};
+    uint16 l_au16DataBuf[TLE9210X_CHIP_MAX] = {0};
+    uint8 l_u8ChipNum;
+
+    l_u8ChipNum = sTle9210x_au8ChipNum[u8Group];
 
     for(j = 0u;j < l_u8ChipNum;j++)
     {
-        if(sTle9210x_abREGBANKSts[u8Group][j] == TLE9210X_REG_BANK_OFF)
+        if(u8Bank == TLE9210X_REG_BANK_ON)
+        {
+            SETBIT_U16(sTle9210x_au16GenCtrl1[u8Group][j],TLE9210X_REG_BANK_BIT);
+        }
+        else if(u8Bank == TLE9210X_REG_BANK_OFF)
         {
-            l_au8RegBuf[j] = TLE9210X_ST_ICHG;
+            CLRBIT_U16(sTle9210x_au16GenCtrl1[u8Group][j],TLE9210X_REG_BANK_BIT);
         }
         else
         {
-            l_au8RegBuf[j] = TLE9210X_PWM_PCHG_INIT;
+            /* keep the cached bank */
         }
+        sTle9210x_abREGBANKSts[u8Group][j] = (GETBIT_U16(sTle9210x_au16GenCtrl1[u8Group][j],TLE9210X_REG_BANK_BIT) == TRUE)
+                                            ? TLE9210X_REG_BANK_ON : TLE9210X_REG_BANK_OFF;
+        l_au8RegBuf[j] = TLE9210X_GENCTRL1;
+        l_au16DataBuf[j] = sTle9210x_au16GenCtrl1[u8Group][j];
     }
     Tle9210x_WriteReg(u8Group,l_au8RegBuf,l_au16DataBuf);
+}
+
+static void Tle9210x_WritePlanEntry(uint8 u8Group, const Tle9210x_RegAccessType* ptAcc)
+{
+    uint8 j;
+    uint8 l_au8RegBuf[TLE9210X_CHIP_MAX] = {0};
+    uint16 l_au16DataBuf[TLE9210X_CHIP_MAX] = {0};
+    uint8 l_u8ChipNum;
 
+    l_u8ChipNum = sTle9210x_au8ChipNum[u8Group];
     for(j = 0u;j < l_u8ChipNum;j++)
     {
-        if(sTle9210x_abREGBANKSts[u8Group][j] == TLE9210X_REG_BANK_OFF)
+        l_au8RegBuf[j] = ptAcc->u8Reg;
+        l_au16DataBuf[j] = ptAcc->pu16Data[j];
+    }
+    Tle9210x_WriteReg(u8Group,l_au8RegBuf,l_au16DataBuf);
+}
+
+/****************************************************************************************
+| NAME:    Tle9210x_WritePlan
+| CALLED BY:     Tle9210x_SetPwmActOrFw, Tle9210x_RestoreReg
+| PRECONDITIONS:     GENCTRL1 cache valid
+| INPUT PARAMETERS:    uint8 u8Group, const Tle9210x_RegAccessType* ptPlan, uint8 u8Num
+| RETURN VALUE:     void
+| DESCRIPTION:      write a set of register accesses of both banks with the least bank
+|                   switches: GENCTRL1 of the plan first, it already carries the bank of
+|                   the first banked pass, then the bank independent registers, then the
+|                   current bank, one switch (a single GENCTRL1 frame from the cache) and
+|                   the other bank. Entries of one class keep their order.
+****************************************************************************************/
+static void Tle9210x_WritePlan(uint8 u8Group, const Tle9210x_RegAccessType* ptPlan, uint8 u8Num)
+{
+    uint8 i;
+    uint8 l_u8Pass;
+    uint8 l_u8Bank;
+    uint8 l_u8PassBank;
+    uint8 l_u8First;
+    boolean l_abNeed[2] = {FALSE, FALSE};
+    boolean l_bGenCtrl1 = FALSE;
+
+    for(i = 0u;i < u8Num;i++)
+    {
+        if(ptPlan[i].u8Reg == TLE9210X_GENCTRL1)
+        {
+            l_bGenCtrl1 = TRUE;
+        }
+        else if(ptPlan[i].u8Bank < TLE9210X_REG_BANK_ANY)
         {
-            l_au8RegBuf[j] = TLE9210X_PWM_ICHG_ACT;
+            l_abNeed[ptPlan[i].u8Bank] = TRUE;
         }
         else
         {
-            l_au8RegBuf[j] = TLE9210X_PWM_ICHG_FW;
+            /* bank independent */
         }
     }
-    Tle9210x_WriteReg(u8Group,l_au8RegBuf,l_au16DataBuf);
 
-    for(j = 0u;j < l_u8ChipNum;j++)
+    /* start in the current bank when it has work, so at most one switch is left */
+    l_u8Bank = Tle9210x_GetGroupBank(u8Group);
+    if((l_u8Bank != TLE9210X_REG_BANK_ANY) && (l_abNeed[l_u8Bank] == TRUE))
+    {
+        l_u8First = l_u8Bank;
+    }
+    else if(l_abNeed[TLE9210X_REG_BANK_OFF] == TRUE)
+    {
+        l_u8First = TLE9210X_REG_BANK_OFF;
+    }
+    else if(l_abNeed[TLE9210X_REG_BANK_ON] == TRUE)
+    {
+        l_u8First = TLE9210X_REG_BANK_ON;
+    }
+    else
+    {
+        l_u8First = TLE9210X_REG_BANK_ANY;
+    }
+
+    if(l_bGenCtrl1 == TRUE)
     {
-        if(sTle9210x_abREGBANKSts[u8Group][j] == TLE9210X_REG_BANK_OFF)
+        Tle9210x_SetRegBank(u8Group,l_u8First);
+        l_u8Bank = Tle9210x_GetGroupBank(u8Group);
+    }
+    else
+    {
+        /* nothing to do */
+    }
+
+    for(i = 0u;i < u8Num;i++)
+    {
+        if((ptPlan[i].u8Reg != TLE9210X_GENCTRL1) && (ptPlan[i].u8Bank >= TLE9210X_REG_BANK_ANY))
         {
-            l_au8RegBuf[j] = TLE9210X_PWM_IDCHG_ACT;
+            Tle9210x_WritePlanEntry(u8Group,&ptPlan[i]);
         }
         else
         {
-            l_au8RegBuf[j] = TLE9210X_PWM_PDCHG_INIT;
+            /* nothing to do */
         }
     }
-    Tle9210x_WriteReg(u8Group,l_au8RegBuf,l_au16DataBuf);
 
-    for(j = 0u;j < l_u8ChipNum;j++)
+    for(l_u8Pass = 0u;(l_u8Pass < 2u) && (l_u8First < TLE9210X_REG_BANK_ANY);l_u8Pass++)
     {
-        if(sTle9210x_abREGBANKSts[u8Group][j] == TLE9210X_REG_BANK_OFF)
+        l_u8PassBank = (l_u8Pass == 0u) ? l_u8First : (uint8)(1u - l_u8First);
+        if(l_abNeed[l_u8PassBank] == TRUE)
         {
-            l_au8RegBuf[j] = TLE9210X_PWM_ICHGMAX_CCP_BLK3_ACT;
+            if(l_u8Bank != l_u8PassBank)
+            {
+                Tle9210x_SetRegBank(u8Group,l_u8PassBank);
+                l_u8Bank = l_u8PassBank;
+            }
+            else
+            {
+                /* nothing to do */
+            }
+            for(i = 0u;i < u8Num;i++)
+            {
+                if((ptPlan[i].u8Reg != TLE9210X_GENCTRL1) && (ptPlan[i].u8Bank == l_u8PassBank))
+                {
+                    Tle9210x_WritePlanEntry(u8Group,&ptPlan[i]);
+                }
+                else
+                {
+                    /* nothing to do */
+                }
+            }
         }
         else
         {
-            l_au8RegBuf[j] = TLE9210X_PWM_ICHGMAX_CCP_BLK3_FW;
+            /* nothing to do */
         }
     }
-    Tle9210x_WriteReg(u8Group,l_au8RegBuf,l_au16DataBuf);
 }
 
-static void Tle9210x_SetRegBank(uint8 u8Group,boolean bEn)
+/****************************************************************************************
+| NAME:    Tle9210x_AddBankRegPlan
+| CALLED BY:     Tle9210x_SetPwmActOrFw, Tle9210x_RestoreReg
+| PRECONDITIONS:     NA
+| INPUT PARAMETERS:    uint8 u8Group, uint16 u16Mask: banked register image entries,
+|                    Tle9210x_RegAccessType* ptPlan, uint8 u8Num: entries already planned
+| RETURN VALUE:     number of planned entries
+| DESCRIPTION:      append the selected entries of the banked register image to a plan
+****************************************************************************************/
+static uint8 Tle9210x_AddBankRegPlan(uint8 u8Group, uint16 u16Mask, Tle9210x_RegAccessType* ptPlan, uint8 u8Num)
 {
-    uint8 j;
-    uint8 l_au8RegBuf[TLE9210X_CHIP_MAX] = {0};
-    uint8 l_au16DataBuf[TLE9210X_CHIP_MAX] = {0};
-    uint8 l_u8ChipNum;
-
-    l_u8ChipNum = *cTle9210x_atGroupCfg[u8Group].pu8ChipNum;
+    uint8 l_u8Bank;
+    uint8 k;
 
-    for(j = 0u;j < l_u8ChipNum;j++)
-    {
-        l_au8RegBuf[j] = TLE9210X_GENCTRL1;
-    }
-    Tle9210x_ReadReg(u8Group,l_au8RegBuf,l_au16DataBuf);
-    for(j = 0u;j < l_u8ChipNum;j++)
+    for(l_u8Bank = 0u;l_u8Bank < 2u;l_u8Bank++)
     {
-        if(TRUE == bEn)
-        {
-            SETBIT_U16(l_au16DataBuf[j],9u);
-            sTle9210x_abREGBANKSts[u8Group][j] = TLE9210X_REG_BANK_ON;
-        }
-        else
+        for(k = 0u;k < TLE9210X_BANK_REG_NUM;k++)
         {
-            CLRBIT_U16(l_au16DataBuf[j],9u);
-            sTle9210x_abREGBANKSts[u8Group][j] = TLE9210X_REG_BANK_OFF;
+            if(GETBIT_U16(u16Mask,(l_u8Bank * TLE9210X_BANK_REG_NUM) + k) == TRUE)
+            {
+                ptPlan[u8Num].u8Reg = cTle9210x_au8BankRegAddr[k];
+                ptPlan[u8Num].u8Bank = l_u8Bank;
+                ptPlan[u8Num].pu16Data = &sTle9210x_au16BankRegImg[u8Group][l_u8Bank][k][0];
+                u8Num++;
+            }
+            else
+            {
+                /* nothing to do */
+            }
         }
     }
+    return u8Num;
+}
 
-    Tle9210x_WriteReg(u8Group,l_au8RegBuf,l_au16DataBuf);
+/****************************************************************************************
+| NAME:    Tle9210x_SetPwmActOrFw
+| CALLED BY:     Tle9210x_WdgJob, Tle9210x_OutputJob
+| PRECONDITIONS:     NA
+| INPUT PARAMETERS:    uint8 u8Group, boolean bGenCtrl1: GENCTRL1 has to be sent anyway
+| RETURN VALUE:     void
+| DESCRIPTION:      write the changed ACT (bank off) and FW/INIT (bank on) registers. With
+|                   bGenCtrl1 the cached GENCTRL1 is part of the plan and carries the bank
+|                   of the first pass, no separate switch frame is sent for it.
+****************************************************************************************/
+static void Tle9210x_SetPwmActOrFw(uint8 u8Group, boolean bGenCtrl1)
+{
+    Tle9210x_RegAccessType l_atPlan[TLE9210X_PLAN_MAX];
+    uint8 l_u8Num = 0u;
+
+    if(bGenCtrl1 == TRUE)
+    {
+        l_atPlan[0].u8Reg = TLE9210X_GENCTRL1;
+        l_atPlan[0].u8Bank = TLE9210X_REG_BANK_ANY;
+        l_atPlan[0].pu16Data = sTle9210x_au16GenCtrl1[u8Group];
+        l_u8Num = 1u;
+    }
+    else
+    {
+        /* nothing to do */
+    }
+    l_u8Num = Tle9210x_AddBankRegPlan(u8Group,sTle9210x_au16BankRegDirty[u8Group],l_atPlan,l_u8Num);
+    sTle9210x_au16BankRegDirty[u8Group] = 0u;
+    Tle9210x_WritePlan(u8Group,l_atPlan,l_u8Num);
 }
 
 static void Tle9210x_SetPwmMappingReg(uint8 u8Group)
 {
     uint8 j;
     uint8 l_au8RegBuf[TLE9210X_CHIP_MAX] = {0};
-    uint8 l_au16DataBuf[TLE9210X_CHIP_MAX] = {0};
+    uint16 l_au16DataBuf[TLE9210X_CHIP_MAX] = {0};
     uint8 l_u8ChipNum;
-    Tle9210x_SetRegBank(u8Group,TLE9210X_REG_BANK_OFF);
-    l_u8ChipNum = *cTle9210x_atGroupCfg[u8Group].pu8ChipNum;
+
+    /* PWMSET is not banked, no bank switch */
+    l_u8ChipNum = sTle9210x_au8ChipNum[u8Group];
+    sTle9210x_abPwmSetDirty[u8Group] = FALSE;
     /***OUT1-OUT4**/
     for(j = 0u;j < l_u8ChipNum;j++)
     {
@@ -404,7 +756,8 @@ static void Tle9210x_SetPwmMappingReg(uint8 u8Group)
                         | (uint16)(cTle9210x_atPwmChnCfg[u8Group][j][1].bPwmEn << 4u)
                         | (uint16)(cTle9210x_atPwmChnCfg[u8Group][j][1].u8PwmMapChn << 5u)
                         | (uint16)(cTle9210x_atPwmChnCfg[u8Group][j][2].bPwmEn << 8u)
-                        | (uint16)(cTle9210x_atPwmChnCfg[u8Group][j][2].u8PwmMapChn << 9u));
+                        | (uint16)(cTle9210x_atPwmChnCfg[u8Group][j][2].u8PwmMapChn << 9u)
+                        | (uint16)((uint16)sTle9210x_au8PwmAfw[u8Group][j] << TLE9210X_PWMSET_AFW_BIT));
     }
     Tle9210x_WriteReg(u8Group,l_au8RegBuf,l_au16DataBuf);
 
@@ -414,12 +767,12 @@ static void Tle9210x_SetPwmDelayTimeReg(uint8 u8Group)
 {
     uint8 j;
     uint8 l_au8RegBuf[TLE9210X_CHIP_MAX] = {0};
-    uint8 l_au16DataBuf[TLE9210X_CHIP_MAX] = {0};
+    uint16 l_au16DataBuf[TLE9210X_CHIP_MAX] = {0};
     uint8 l_u8ChipNum;
     uint8 l_u8ErrCnt;
     uint8 l_u8RetVal;
 
-    l_u8ChipNum = *cTle9210x_atGroupCfg[u8Group].pu8ChipNum;
+    l_u8ChipNum = sTle9210x_au8ChipNum[u8Group];
     /***PWM1**/
     for(j = 0u;j < l_u8ChipNum;j++)
     {
@@ -453,10 +806,10 @@ static void Tle9210x_GetAllGenSts(uint8 u8Group)
 {
     uint8 j;
     uint8 l_au8RegBuf[TLE9210X_CHIP_MAX] = {0};
-    uint8 l_au16DataBuf[TLE9210X_CHIP_MAX] = {0};
+    uint16 l_au16DataBuf[TLE9210X_CHIP_MAX] = {0};
     uint8 l_u8ChipNum;
 
-    l_u8ChipNum = *cTle9210x_atGroupCfg[u8Group].pu8ChipNum;
+    l_u8ChipNum = sTle9210x_au8ChipNum[u8Group];
 
     for(j = 0u;j < l_u8ChipNum;j++)
     {
@@ -565,10 +918,11 @@ static void Tle9210x_OVDiagnostic(uint8 u8Group)
     uint8 k;
     uint8 l_u8Chn;
     uint8 l_au8RegBuf[TLE9210X_CHIP_MAX] = {0};
-    uint8 l_au16DataBuf[TLE9210X_CHIP_MAX] = {0};
+    uint16 l_au16DataBuf[TLE9210X_CHIP_MAX] = {0};
     uint8 l_u8ChipNum;
-    uint8 l_u8ErrCnt;
+    uint8 l_u8ErrCnt = 0u;
 
+    l_u8ChipNum = sTle9210x_au8ChipNum[u8Group];
     for(j = 0u;j < l_u8ChipNum;j++)
     {
         l_au8RegBuf[j] = TLE9210X_DSOV;
@@ -577,10 +931,10 @@ static void Tle9210x_OVDiagnostic(uint8 u8Group)
     for(j = 0u;j < l_u8ChipNum;j++)
     {
         sTle9210x_atGenStsReport[u8Group][j].u16DSOV = l_au16DataBuf[j];
-        for(k = 0u;k < 16u;k + 2u)
+        for(k = 0u;k < 16u;k += 2u)
         {
             l_u8Chn = (uint8)(k/2u);
-            sTle9210x_atDiagResult[u8Group][j][l_u8Chn].eShort2Vcc = 
+            sTle9210x_atDiagResult[u8Group][j][l_u8Chn].Short2Vcc = 
                 (TRUE == (GETBIT_U16(sTle9210x_atGenStsReport[u8Group][j].u16DSOV,k)
                 ||GETBIT_U16(sTle9210x_atGenStsReport[u8Group][j].u16DSOV,(k+1u))))
                 ? PFM_DDS_POS : PFM_DDS_NEG;
@@ -594,108 +948,1003 @@ static void Tle9210x_OVDiagnostic(uint8 u8Group)
             /*Nothing to do*/
         }
     }
-    if(l_u8ErrCnt > 0u)
+    if((l_u8ErrCnt > 0u) && (sTle9210x_abFrameLost[u8Group] == FALSE))
     {
         memset(l_au16DataBuf,0u,sizeof(l_au16DataBuf));
         Tle9210x_WriteReg(u8Group,l_au8RegBuf,l_au16DataBuf);
     }
 }
 
-static void Tle9210x_SetPwmDutyOut(uint8 u8Group)
+#if(TLE9210X_VOUT_DIAG_EN == STD_ON)
+/****************************************************************************************
+| NAME:    Tle9210x_ReadVout
+| CALLED BY:     Tle9210x_DiagJob
+| PRECONDITIONS:     NA
+| INPUT PARAMETERS:    uint8 u8Group
+| RETURN VALUE:     TRUE: a chip flags a global error, DSOV needs a frame of its own
+| DESCRIPTION:      diagnostic frame of the group: read HBVOUT of all chips in one frame,
+|                   the global status byte of each chip comes with it. Without a global
+|                   error no drain source overvoltage is latched and DSOV is not read.
+****************************************************************************************/
+static boolean Tle9210x_ReadVout(uint8 u8Group)
 {
     uint8 j;
-    uint8 k;
+    uint8 l_au8RegBuf[TLE9210X_CHIP_MAX] = {0};
+    uint16 l_au16DataBuf[TLE9210X_CHIP_MAX] = {0};
     uint8 l_u8ChipNum;
+    boolean l_bGlobalErr = FALSE;
 
-    l_u8ChipNum = *cTle9210x_atGroupCfg[u8Group].pu8ChipNum;
-    /***PWM1 - PWM3**/
+    l_u8ChipNum = sTle9210x_au8ChipNum[u8Group];
     for(j = 0u;j < l_u8ChipNum;j++)
     {
-        for(k = 0u;k < 3u; k++)
+        l_au8RegBuf[j] = TLE9210X_HBVOUT_PWMERR;
+    }
+    Tle9210x_ReadReg(u8Group,l_au8RegBuf,l_au16DataBuf);
+    if(sTle9210x_abFrameLost[u8Group] == FALSE)
+    {
+        for(j = 0u;j < l_u8ChipNum;j++)
         {
-            if(cTle9210x_atPwmChnCfg[u8Group][j][0].bPwmEn == TLE9210X_PWM_ENABLE)
+            sTle9210x_atGenStsReport[u8Group][j].u16HBVOUT_PWMERR = l_au16DataBuf[j];
+            if((sTle9210x_au8GlobalStatus[u8Group][j] & TLE9210X_GSB_GEF) != 0u)
             {
-                Pwm_SetDutyCycle(cTle9210x_atPwmChnCfg[u8Group][j][0].u8PwmChn,
-                    sTle9210x_au8PwmDuty[u8Group][j][0]);
+                l_bGlobalErr = TRUE;
+            }
+            else
+            {
+                /* nothing to do */
             }
         }
     }
-}
-
-void Tle9210x_Init(void)
-{
-    uint8 i;
-
-    memset(sTle9210x_au8HbOutSts,0u,sizeof(sTle9210x_au8HbOutSts));
-
-    for(i = 0u;i < TLE9210X_GROUP_MAX;i++)
+    else
     {
-        Tle9210x_SetChipMode(i,TLE9210X_MODE_NORMAL);
-        Tle9210x_SetGenCtrlReg(i);
-        Tle9210x_SetPwmMappingReg(i);
-        Tle9210x_SetPwmDelayTimeReg(i);
-        Tle9210x_GetAllGenSts(i);
-        Tle9210x_SetVDSReg(i);
-
-        Tle9210x_SetHbOutputReg(i);
+        /* frame lost: no report in this cycle, DSOV is not read either */
     }
+    return l_bGlobalErr;
 }
 
-
-void Tle9210x_MainFunction(void)
+/****************************************************************************************
+| NAME:    Tle9210x_ClrOVDiagnostic
+| CALLED BY:     Tle9210x_DiagJob
+| PRECONDITIONS:     diagnostic frame without global error
+| INPUT PARAMETERS:    uint8 u8Group
+| RETURN VALUE:     void
+| DESCRIPTION:      result of Tle9210x_OVDiagnostic for a group without DSOV flags
+****************************************************************************************/
+static void Tle9210x_ClrOVDiagnostic(uint8 u8Group)
 {
-    uint8 i;
+    uint8 j;
+    uint8 k;
+    uint8 l_u8ChipNum;
 
-    for(i = 0u;i < TLE9210X_GROUP_MAX;i++)
+    l_u8ChipNum = sTle9210x_au8ChipNum[u8Group];
+    for(j = 0u;j < l_u8ChipNum;j++)
     {
-        Tle9210x_OVDiagnostic(i);
-        Tle9210x_SetHbOutputReg(i);
-        Tle9210x_SetPwmDutyOut(i);
+        sTle9210x_atGenStsReport[u8Group][j].u16DSOV = 0u;
+        for(k = 0u;k < TLE9210X_HB_CHN_MAX;k++)
+        {
+            sTle9210x_atDiagResult[u8Group][j][k].Short2Vcc = PFM_DDS_NEG;
+        }
     }
 }
 
-void Tle9210x_DeInit(void)
+/****************************************************************************************
+| NAME:    Tle9210x_VoutDiagnostic
+| CALLED BY:     Tle9210x_DiagJob
+| PRECONDITIONS:     HBMODE of the group written by Tle9210x_SetHbOutputReg,
+|                    HBVOUT read by Tle9210x_ReadVout in this cycle
+| INPUT PARAMETERS:    uint8 u8Group
+| RETURN VALUE:     void
+| DESCRIPTION:      compare the 8 HB levels of a chip at once with the commanded image:
+|                   HS on but VOUT low is reported as Short2Gnd (output stuck low), LS on
+|                   but VOUT high as Short2Vcc (stuck high). HBs changed by the last HBMODE
+|                   write are skipped for one cycle to settle.
+****************************************************************************************/
+static void Tle9210x_VoutDiagnostic(uint8 u8Group)
 {
-    uint8 i;
+    uint8 j;
+    uint8 k;
+    uint8 l_u8ChipNum;
+    uint8 l_u8Vout;
+    uint8 l_u8Care;
+    uint8 l_u8Err;
 
-    memset(sTle9210x_au8HbOutSts,0u,sizeof(sTle9210x_au8HbOutSts));
-    memset(sTle9210x_au8PwmDuty,0u,sizeof(sTle9210x_au8PwmDuty));
-    for(i = 0u;i < TLE9210X_GROUP_MAX;i++)
+    l_u8ChipNum = sTle9210x_au8ChipNum[u8Group];
+    if(sTle9210x_abFrameLost[u8Group] == FALSE)
     {
-        Tle9210x_SetHbOutputReg(i);
-        Tle9210x_SetPwmDutyOut(i);
+        for(j = 0u;j < l_u8ChipNum;j++)
+        {
+            l_u8Vout = (uint8)(sTle9210x_atGenStsReport[u8Group][j].u16HBVOUT_PWMERR & TLE9210X_HBVOUT_MASK);
+            l_u8Care = (uint8)(sTle9210x_au8VoutCare[u8Group][j] & (uint8)~sTle9210x_au8VoutSettle[u8Group][j]);
+            l_u8Err = (uint8)((l_u8Vout ^ sTle9210x_au8VoutExp[u8Group][j]) & l_u8Care);
+            sTle9210x_au8VoutSettle[u8Group][j] = 0u;
+            for(k = 0u;k < TLE9210X_HB_CHN_MAX;k++)
+            {
+                if(GETBIT_U16(l_u8Care,k) == FALSE)
+                {
+                    sTle9210x_atDiagResult[u8Group][j][k].Short2Gnd = PFM_DDS_ING;
+                }
+                else if(GETBIT_U16(l_u8Err,k) == FALSE)
+                {
+                    sTle9210x_atDiagResult[u8Group][j][k].Short2Gnd = PFM_DDS_NEG;
+                }
+                else if(GETBIT_U16(l_u8Vout,k) == FALSE)
+                {
+                    sTle9210x_atDiagResult[u8Group][j][k].Short2Gnd = PFM_DDS_POS;
+                }
+                else
+                {
+                    /* Short2Vcc keeps a drain source overvoltage found in this cycle */
+                    sTle9210x_atDiagResult[u8Group][j][k].Short2Gnd = PFM_DDS_NEG;
+                    sTle9210x_atDiagResult[u8Group][j][k].Short2Vcc = PFM_DDS_POS;
+                }
+            }
+        }
     }
-}
-
-void Tle9210x_WriteHbChn(uint8 u8GroupId, uint8 u8ChipId,uint8 u8ChnId, uint8 u8Val)
-{
-    if((u8GroupId < (uint8)TLE9210X_GROUP_MAX)
-    &&(u8ChipId < (uint8)TLE9210X_CHIP_MAX)
-    &&(u8ChnId < (uint8)TLE9210X_HB_CHN_MAX))
+    else
     {
-        sTle9210x_au8HbOutSts[u8GroupId][u8ChipId][u8ChnId] = u8Val;
+        /* frame lost: settle marks stay for the next cycle */
     }
 }
+#endif
 
-void Tle9210x_WritePwmChn(uint8 u8GroupId, uint8 u8ChipId,uint8 u8PwmChn, uint8 u8Val)
+static void Tle9210x_SetPwmDutyOut(uint8 u8Group)
 {
-    if((u8GroupId < (uint8)TLE9210X_GROUP_MAX)
-    &&(u8ChipId < (uint8)TLE9210X_CHIP_MAX)
+    uint8 j;
+    uint8 k;
+    uint8 l_u8ChipNum;
+
+    l_u8ChipNum = sTle9210x_au8ChipNum[u8Group];
+    /***PWM1 - PWM3**/
+    for(j = 0u;j < l_u8ChipNum;j++)
+    {
+        for(k = 0u;k < 3u; k++)
+        {
+            if(cTle9210x_atPwmChnCfg[u8Group][j][0].bPwmEn == TLE9210X_PWM_ENABLE)
+            {
+                Pwm_SetDutyCycle(cTle9210x_atPwmChnCfg[u8Group][j][0].u8PwmChn,
+                    sTle9210x_au8PwmDuty[u8Group][j][0]);
+            }
+        }
+    }
+}
+
+/****************************************************************************************
+| NAME:    Tle9210x_ReportDiag
+| CALLED BY:     Tle9210x_MainFunction
+| PRECONDITIONS:     diagnostic registers of the group read in this cycle
+| INPUT PARAMETERS:    uint8 u8Group
+| RETURN VALUE:     void
+| DESCRIPTION:      report the diagnostic result of every channel to Pfm, the PID comes
+|                   from the IO channel registry, channels without a PID are skipped
+****************************************************************************************/
+static void Tle9210x_ReportDiag(uint8 u8Group)
+{
+    uint8 j;
+    uint8 k;
+    uint8 l_u8ChipNum;
+    PFM_PhysicalId_e l_ePid;
+
+    l_u8ChipNum = sTle9210x_au8ChipNum[u8Group];
+    for(j = 0u;j < l_u8ChipNum;j++)
+    {
+        for(k = 0u;k < TLE9210X_HB_CHN_MAX;k++)
+        {
+            l_ePid = IoChnReg_Tle9210xPid(u8Group, j, k);
+            if(l_ePid != PFM_PID_DUMMTY)
+            {
+                Pfm_DefectReport(l_ePid, sTle9210x_atDiagResult[u8Group][j][k].OpenLoad,
+                    sTle9210x_atDiagResult[u8Group][j][k].Short2Vcc, sTle9210x_atDiagResult[u8Group][j][k].Short2Gnd);
+            }
+            else
+            {
+                /* nothing to do */
+            }
+        }
+    }
+}
+
+/****************************************************************************************
+| NAME:    Tle9210x_DiagJob
+| CALLED BY:     Tle9210x_Submit, diagnostic class
+| PRECONDITIONS:     NA
+| INPUT PARAMETERS:    uint8 u8Group
+| RETURN VALUE:     void
+| DESCRIPTION:      read the diagnostic registers of the group, report them when no frame was lost.
+|                   With the VOUT check a fault free cycle is the HBVOUT frame only.
+****************************************************************************************/
+static void Tle9210x_DiagJob(uint8 u8Group)
+{
+    if((sTle9210x_aeInitStep[u8Group] == TLE9210X_INIT_DONE) && (sTle9210x_ePwrState == OBDPWR_STATE_RUN))
+    {
+        sTle9210x_abFrameLost[u8Group] = FALSE;
+#if(TLE9210X_VOUT_DIAG_EN == STD_ON)
+        if(Tle9210x_ReadVout(u8Group) != FALSE)
+        {
+            Tle9210x_OVDiagnostic(u8Group);
+        }
+        else
+        {
+            Tle9210x_ClrOVDiagnostic(u8Group);
+        }
+        Tle9210x_VoutDiagnostic(u8Group);
+#else
+        Tle9210x_OVDiagnostic(u8Group);
+#endif
+        if(sTle9210x_abFrameLost[u8Group] == FALSE)
+        {
+            Tle9210x_ReportDiag(u8Group);
+        }
+        else
+        {
+            /* diagnostic frame lost: no report, Pfm keeps the last qualification */
+        }
+    }
+    else
+    {
+        /* power state changed since the request */
+    }
+}
+
+/****************************************************************************************
+| NAME:    Tle9210x_OutputJob
+| CALLED BY:     Tle9210x_Submit, output class
+| PRECONDITIONS:     NA
+| INPUT PARAMETERS:    uint8 u8Group
+| RETURN VALUE:     void
+| DESCRIPTION:      write the output image of the group, the freewheeling selection
+|                   before the outputs when it changed
+****************************************************************************************/
+static void Tle9210x_OutputJob(uint8 u8Group)
+{
+    if((sTle9210x_aeInitStep[u8Group] == TLE9210X_INIT_DONE) && (sTle9210x_ePwrState != OBDPWR_STATE_SLEEP))
+    {
+        /* cleared first: a change written while the job runs is not lost */
+        sTle9210x_abOutDirty[u8Group] = FALSE;
+        if(sTle9210x_abPwmSetDirty[u8Group] == TRUE)
+        {
+            Tle9210x_SetPwmMappingReg(u8Group);
+        }
+        else
+        {
+            /* nothing to do */
+        }
+        Tle9210x_SetHbOutputReg(u8Group);
+        Tle9210x_SetPwmDutyOut(u8Group);
+        if((sTle9210x_au16BankRegDirty[u8Group] != 0u) && (Tle9210x_IsWdgEn(u8Group) == FALSE))
+        {
+            Tle9210x_SetPwmActOrFw(u8Group, FALSE);
+        }
+        else
+        {
+            /* nothing changed, or written with the next watchdog trigger */
+        }
+    }
+    else
+    {
+        /* power state changed since the request */
+    }
+}
+
+/****************************************************************************************
+| NAME:    Tle9210x_ShutdownJob
+| CALLED BY:     Tle9210x_Submit, safety class
+| PRECONDITIONS:     output image of the group cleared
+| INPUT PARAMETERS:    uint8 u8Group
+| RETURN VALUE:     void
+| DESCRIPTION:      switch the outputs of the group off and put the chips to sleep
+****************************************************************************************/
+static void Tle9210x_ShutdownJob(uint8 u8Group)
+{
+    Tle9210x_SetHbOutputReg(u8Group);
+    Tle9210x_SetPwmDutyOut(u8Group);
+    Tle9210x_SetChipMode(u8Group,TLE9210X_MODE_SLEEP);
+}
+
+/****************************************************************************************
+| NAME:    Tle9210x_OffJob
+| CALLED BY:     Tle9210x_Submit, safety class
+| PRECONDITIONS:     output image of the group cleared
+| INPUT PARAMETERS:    uint8 u8Group
+| RETURN VALUE:     void
+| DESCRIPTION:      switch the outputs of the group off, the chips stay in normal mode
+****************************************************************************************/
+static void Tle9210x_OffJob(uint8 u8Group)
+{
+    Tle9210x_SetHbOutputReg(u8Group);
+    Tle9210x_SetPwmDutyOut(u8Group);
+}
+
+/****************************************************************************************
+| NAME:    Tle9210x_RestoreJob
+| CALLED BY:     Tle9210x_Submit, output class
+| PRECONDITIONS:     chips in normal mode for at least one main cycle after sleep
+| INPUT PARAMETERS:    uint8 u8Group
+| RETURN VALUE:     void
+| DESCRIPTION:      restore the cached registers of a woken group and release it to the
+|                   cyclic jobs
+****************************************************************************************/
+static void Tle9210x_RestoreJob(uint8 u8Group)
+{
+    if((sTle9210x_aeInitStep[u8Group] == TLE9210X_INIT_RESTORE) && (sTle9210x_ePwrState != OBDPWR_STATE_SLEEP))
+    {
+        Tle9210x_RestoreReg(u8Group);
+        sTle9210x_abWakeRestore[u8Group] = FALSE;
+        sTle9210x_aeInitStep[u8Group] = TLE9210X_INIT_DONE;
+    }
+    else
+    {
+        /* power state changed since the request */
+    }
+}
+
+/****************************************************************************************
+| NAME:    Tle9210x_Submit
+| CALLED BY:     Tle9210x_MainFunction, Tle9210x_InitMainFunction, Tle9210x_SetPowerState,
+|                Tle9210x_InitGroupStep, Tle9210x_DeInit, Tle9210x_TriggerWdg, output interface
+| PRECONDITIONS:     NA
+| INPUT PARAMETERS:    uint8 u8Group, priority class, job
+| RETURN VALUE:     void
+| DESCRIPTION:      hand the job to the arbiter of the group's SPI unit, without arbitration
+|                   the job is run at once
+****************************************************************************************/
+static void Tle9210x_Submit(uint8 u8Group, SpiArb_PrioType ePrio, SpiArb_JobFuncType pfJob)
+{
+#if(TLE9210X_SPIARB_EN == STD_ON)
+    (void)SpiArb_Request(cTle9210x_atGroupCfg[u8Group].u8SpiBus, ePrio, pfJob, u8Group);
+#else
+    (void)ePrio;
+    pfJob(u8Group);
+#endif
+}
+
+/****************************************************************************************
+| NAME:    Tle9210x_SelectVariant
+| CALLED BY:     Tle9210x_Init
+| PRECONDITIONS:     IoChnReg_Init done
+| INPUT PARAMETERS:    void
+| RETURN VALUE:     void
+| DESCRIPTION:      take the active group and chip numbers from the variant record,
+|                   limited to the chips the board configuration provides
+****************************************************************************************/
+static void Tle9210x_SelectVariant(void)
+{
+    uint8 i;
+    uint8 l_u8ChipNum;
+
+    sTle9210x_u8GroupNum = IoChnReg_GetGroupNum(IOCHNREG_DRV_TLE9210X);
+    if(sTle9210x_u8GroupNum > (uint8)TLE9210X_GROUP_MAX)
+    {
+        sTle9210x_u8GroupNum = (uint8)TLE9210X_GROUP_MAX;
+    }
+    else
+    {
+        /* nothing to do */
+    }
+    for(i = 0u;i < TLE9210X_GROUP_MAX;i++)
+    {
+        l_u8ChipNum = 0u;
+        if(i < sTle9210x_u8GroupNum)
+        {
+            l_u8ChipNum = IoChnReg_GetChipNum(IOCHNREG_DRV_TLE9210X, i);
+            if(l_u8ChipNum > *cTle9210x_atGroupCfg[i].pu8ChipNum)
+            {
+                l_u8ChipNum = *cTle9210x_atGroupCfg[i].pu8ChipNum;
+            }
+            else
+            {
+                /* nothing to do */
+            }
+        }
+        else
+        {
+            /* group not present in this variant */
+        }
+        sTle9210x_au8ChipNum[i] = l_u8ChipNum;
+    }
+}
+
+/****************************************************************************************
+| NAME:    Tle9210x_InitGroupStep
+| CALLED BY:     Tle9210x_Init, Tle9210x_InitJob
+| PRECONDITIONS:     NA
+| INPUT PARAMETERS:    uint8 u8Group
+| RETURN VALUE:     void
+| DESCRIPTION:      run the current init step of a group and advance to the next one.
+|                   After a wake up the chips are not configured again, the step after
+|                   normal mode queues the restore of the cached registers instead.
+****************************************************************************************/
+static void Tle9210x_InitGroupStep(uint8 u8Group)
+{
+    switch(sTle9210x_aeInitStep[u8Group])
+    {
+        case TLE9210X_INIT_NORMAL_MODE:
+            Tle9210x_SetChipMode(u8Group,TLE9210X_MODE_NORMAL);
+            break;
+        case TLE9210X_INIT_GEN_CTRL:
+            if(sTle9210x_abWakeRestore[u8Group] == TRUE)
+            {
+                sTle9210x_aeInitStep[u8Group] = TLE9210X_INIT_RESTORE;
+                Tle9210x_Submit(u8Group, SPIARB_PRIO_OUTPUT, &Tle9210x_RestoreJob);
+            }
+            else
+            {
+                Tle9210x_SetGenCtrlReg(u8Group);
+            }
+            break;
+        case TLE9210X_INIT_PWM_MAPPING:
+            Tle9210x_SetPwmMappingReg(u8Group);
+            break;
+        case TLE9210X_INIT_PWM_DELAY:
+            Tle9210x_SetPwmDelayTimeReg(u8Group);
+            break;
+        case TLE9210X_INIT_GEN_STS:
+            Tle9210x_GetAllGenSts(u8Group);
+            break;
+        case TLE9210X_INIT_VDS:
+            Tle9210x_SetVDSReg(u8Group);
+            break;
+        case TLE9210X_INIT_HB_OUTPUT:
+            Tle9210x_SetHbOutputReg(u8Group);
+            break;
+        case TLE9210X_INIT_RESTORE:
+            /* job still queued or dropped by a full queue, the arbiter drops duplicates */
+            Tle9210x_Submit(u8Group, SPIARB_PRIO_OUTPUT, &Tle9210x_RestoreJob);
+            break;
+        default:
+            /* TLE9210X_INIT_DONE, nothing to do */
+            break;
+    }
+    if(sTle9210x_aeInitStep[u8Group] < TLE9210X_INIT_DONE)
+    {
+        sTle9210x_aeInitStep[u8Group] = (Tle9210x_InitStepType)((uint8)sTle9210x_aeInitStep[u8Group] + 1u);
+    }
+    else
+    {
+        /* nothing to do */
+    }
+}
+
+/****************************************************************************************
+| NAME:    Tle9210x_InitJob
+| CALLED BY:     Tle9210x_Submit, output class
+| PRECONDITIONS:     NA
+| INPUT PARAMETERS:    uint8 u8Group
+| RETURN VALUE:     void
+| DESCRIPTION:      run TLE9210X_INIT_STEPS_PER_CALL init steps of the group. A woken group
+|                   runs one step per job: normal mode, then the restore is queued by
+|                   the next job once the chips had a cycle to wake up.
+****************************************************************************************/
+static void Tle9210x_InitJob(uint8 u8Group)
+{
+    uint8 n;
+
+    if(sTle9210x_ePwrState == OBDPWR_STATE_SLEEP)
+    {
+        /* power state changed since the request */
+    }
+    else if(sTle9210x_abWakeRestore[u8Group] == TRUE)
+    {
+        Tle9210x_InitGroupStep(u8Group);
+    }
+    else
+    {
+        for(n = 0u;(n < TLE9210X_INIT_STEPS_PER_CALL) && (sTle9210x_aeInitStep[u8Group] != TLE9210X_INIT_DONE);n++)
+        {
+            Tle9210x_InitGroupStep(u8Group);
+        }
+    }
+}
+
+void Tle9210x_Init(void)
+{
+    uint8 i;
+
+    Tle9210x_SelectVariant();
+    memset(sTle9210x_au8HbOutSts,0u,sizeof(sTle9210x_au8HbOutSts));
+    memset(sTle9210x_au8PwmAfw,0u,sizeof(sTle9210x_au8PwmAfw));
+    for(i = 0u;i < TLE9210X_GROUP_MAX;i++)
+    {
+        sTle9210x_abPwmSetDirty[i] = FALSE;
+        sTle9210x_aeInitStep[i] = TLE9210X_INIT_NORMAL_MODE;
+        sTle9210x_abWakeRestore[i] = FALSE;
+    }
+#if(TLE9210X_RIPPLE_EN == STD_ON)
+    /* CSO sampling runs on the ADC, Tle9210x_RippleMainFunction is called from the 1ms task */
+    Tle9210x_RippleInit();
+#endif
+#if(TLE9210X_INCREMENTAL_INIT == STD_OFF)
+    for(i = 0u;i < sTle9210x_u8GroupNum;i++)
+    {
+        while(sTle9210x_aeInitStep[i] != TLE9210X_INIT_DONE)
+        {
+            Tle9210x_InitGroupStep(i);
+        }
+    }
+#endif
+}
+
+/****************************************************************************************
+| NAME:    Tle9210x_InitMainFunction
+| CALLED BY:     1ms or background task, until all groups are ready
+| PRECONDITIONS:     Tle9210x_Init done
+| INPUT PARAMETERS:    void
+| RETURN VALUE:     void
+| DESCRIPTION:      queue the init job of every group still in init, each job advances its
+|                   group by TLE9210X_INIT_STEPS_PER_CALL steps, so no group waits for the
+|                   others to finish. The groups share one SPI bus (u8SpiBus, all on
+|                   SPIARB_BUS_1 on this board), the arbiter sends their frames one after
+|                   the other between the output jobs of the ready groups.
+****************************************************************************************/
+void Tle9210x_InitMainFunction(void)
+{
+    uint8 i;
+
+    if(sTle9210x_ePwrState != OBDPWR_STATE_SLEEP)
+    {
+        for(i = 0u;i < sTle9210x_u8GroupNum;i++)
+        {
+            if((sTle9210x_aeInitStep[i] != TLE9210X_INIT_DONE) && (sTle9210x_abWakeRestore[i] == FALSE))
+            {
+                /* the arbiter drops the request while the job of the group is still queued */
+                Tle9210x_Submit(i, SPIARB_PRIO_OUTPUT, &Tle9210x_InitJob);
+            }
+            else
+            {
+                /* nothing to do */
+            }
+        }
+    }
+    else
+    {
+        /* chips are off, init continues after wake up */
+    }
+}
+
+boolean Tle9210x_IsGroupReady(uint8 u8Group)
+{
+    boolean l_bReady = FALSE;
+
+    if((u8Group < sTle9210x_u8GroupNum) && (sTle9210x_aeInitStep[u8Group] == TLE9210X_INIT_DONE))
+    {
+        l_bReady = TRUE;
+    }
+    else
+    {
+        /* nothing to do */
+    }
+    return l_bReady;
+}
+
+
+/****************************************************************************************
+| NAME:    Tle9210x_IsOutputDue
+| CALLED BY:     Tle9210x_MainFunction
+| PRECONDITIONS:     NA
+| INPUT PARAMETERS:    uint8 u8Group
+| RETURN VALUE:     TRUE: queue the output job of the group in this cycle
+| DESCRIPTION:      without event mode the output image is written every cycle. In event
+|                   mode only a changed image is written, the write interface has queued
+|                   it already, plus a slow refresh of the output registers.
+****************************************************************************************/
+static boolean Tle9210x_IsOutputDue(uint8 u8Group)
+{
+    boolean l_bDue = TRUE;
+
+#if(TLE9210X_EVENT_OUTPUT_EN == STD_ON)
+    l_bDue = sTle9210x_abOutDirty[u8Group];
+    sTle9210x_au8OutRefreshCnt[u8Group]++;
+    if(sTle9210x_au8OutRefreshCnt[u8Group] >= TLE9210X_OUTPUT_REFRESH_CYCLES)
+    {
+        sTle9210x_au8OutRefreshCnt[u8Group] = 0u;
+        l_bDue = TRUE;
+    }
+    else
+    {
+        /* nothing to do */
+    }
+#else
+    (void)u8Group;
+#endif
+    return l_bDue;
+}
+
+#if((TLE9210X_EVENT_OUTPUT_EN == STD_ON) && (TLE9210X_SPIARB_EN == STD_OFF))
+/****************************************************************************************
+| NAME:    Tle9210x_OutputMainFunction
+| CALLED BY:     output task activated through TLE9210X_OUTPUT_TRIGGER, same priority
+|                as Tle9210x_MainFunction
+| PRECONDITIONS:     Tle9210x_Init done
+| INPUT PARAMETERS:    void
+| RETURN VALUE:     void
+| DESCRIPTION:      without the arbiter the write interface cannot run SPI jobs in the
+|                   caller, the changed output images are written here instead.
+|                   Tle9210x_MainFunction keeps writing them as fallback.
+****************************************************************************************/
+void Tle9210x_OutputMainFunction(void)
+{
+    uint8 i;
+
+    for(i = 0u;i < sTle9210x_u8GroupNum;i++)
+    {
+        if(sTle9210x_abOutDirty[i] == TRUE)
+        {
+            Tle9210x_OutputJob(i);
+        }
+        else
+        {
+            /* nothing changed */
+        }
+    }
+}
+#endif
+
+void Tle9210x_MainFunction(void)
+{
+    uint8 i;
+
+    for(i = 0u;i < sTle9210x_u8GroupNum;i++)
+    {
+        if(sTle9210x_aeInitStep[i] != TLE9210X_INIT_DONE)
+        {
+            if((sTle9210x_abWakeRestore[i] == TRUE) && (sTle9210x_ePwrState != OBDPWR_STATE_SLEEP))
+            {
+                /* one step per job: EN high, the chips wake up until the next job queues the restore */
+                Tle9210x_Submit(i, SPIARB_PRIO_OUTPUT, &Tle9210x_InitJob);
+            }
+            else
+            {
+                /* group still in init, see Tle9210x_InitMainFunction */
+            }
+        }
+        else if(sTle9210x_ePwrState == OBDPWR_STATE_RUN)
+        {
+            Tle9210x_Submit(i, SPIARB_PRIO_DIAG, &Tle9210x_DiagJob);
+            if(Tle9210x_IsOutputDue(i) == TRUE)
+            {
+                Tle9210x_Submit(i, SPIARB_PRIO_OUTPUT, &Tle9210x_OutputJob);
+            }
+            else
+            {
+                /* output image unchanged, no SPI traffic for it */
+            }
+        }
+        else if((sTle9210x_ePwrState == OBDPWR_STATE_LOWPOWER) && (sTle9210x_abOutDirty[i] == TRUE))
+        {
+            /* no diagnostics in low power, only flush changed outputs */
+            Tle9210x_Submit(i, SPIARB_PRIO_OUTPUT, &Tle9210x_OutputJob);
+        }
+        else
+        {
+            /* sleep or nothing changed: no SPI traffic */
+        }
+    }
+}
+
+/****************************************************************************************
+| NAME:    Tle9210x_RestoreReg
+| CALLED BY:     Tle9210x_RestoreJob
+| PRECONDITIONS:     chip back in normal mode after sleep, register content lost
+| INPUT PARAMETERS:    uint8 u8Group
+| RETURN VALUE:     void
+| DESCRIPTION:      write GENCTRL1/2 and the banked registers from the cached image as one
+|                   access plan, then the static configuration and the current output image
+****************************************************************************************/
+static void Tle9210x_RestoreReg(uint8 u8Group)
+{
+    Tle9210x_RegAccessType l_atPlan[TLE9210X_PLAN_MAX];
+    uint8 l_u8Num;
+
+    /* register content lost in sleep, the chips are back in bank off */
+    (void)memset(sTle9210x_abREGBANKSts[u8Group],0u,sizeof(sTle9210x_abREGBANKSts[u8Group]));
+    l_atPlan[0].u8Reg = TLE9210X_GENCTRL1;
+    l_atPlan[0].u8Bank = TLE9210X_REG_BANK_ANY;
+    l_atPlan[0].pu16Data = sTle9210x_au16GenCtrl1[u8Group];
+    l_atPlan[1].u8Reg = TLE9210X_GENCTRL2;
+    l_atPlan[1].u8Bank = TLE9210X_REG_BANK_ANY;
+    l_atPlan[1].pu16Data = sTle9210x_au16GenCtrl2[u8Group];
+    l_u8Num = Tle9210x_AddBankRegPlan(u8Group,sTle9210x_au16BankRegUsed[u8Group],l_atPlan,2u);
+    sTle9210x_au16BankRegDirty[u8Group] = 0u;
+    Tle9210x_WritePlan(u8Group,l_atPlan,l_u8Num);
+
+    Tle9210x_SetPwmMappingReg(u8Group);
+    Tle9210x_SetPwmDelayTimeReg(u8Group);
+    Tle9210x_SetVDSReg(u8Group);
+    Tle9210x_SetHbOutputReg(u8Group);
+    Tle9210x_SetPwmDutyOut(u8Group);
+}
+
+/****************************************************************************************
+| NAME:    Tle9210x_SetPowerState
+| CALLED BY:     ObdPwr
+| PRECONDITIONS:     Tle9210x_Init done
+| INPUT PARAMETERS:    ObdPwr_StateType eState
+| RETURN VALUE:     void
+| DESCRIPTION:      SLEEP switches the bridges and PWM off and puts the chips to sleep,
+|                   leaving SLEEP restarts the init sequence of the group in restore mode,
+|                   Tle9210x_MainFunction wakes the chips and restores the cached registers
+|                   one cycle later through the arbiter
+****************************************************************************************/
+void Tle9210x_SetPowerState(ObdPwr_StateType eState)
+{
+    uint8 i;
+
+    if(eState != sTle9210x_ePwrState)
+    {
+        for(i = 0u;i < sTle9210x_u8GroupNum;i++)
+        {
+            if(eState == OBDPWR_STATE_SLEEP)
+            {
+                (void)memset(sTle9210x_au8HbOutSts[i],0u,sizeof(sTle9210x_au8HbOutSts[i]));
+                (void)memset(sTle9210x_au8PwmDuty[i],0u,sizeof(sTle9210x_au8PwmDuty[i]));
+                Tle9210x_Submit(i, SPIARB_PRIO_SAFETY, &Tle9210x_ShutdownJob);
+            }
+            else if((sTle9210x_ePwrState == OBDPWR_STATE_SLEEP) && (sTle9210x_aeInitStep[i] == TLE9210X_INIT_DONE))
+            {
+                sTle9210x_abWakeRestore[i] = TRUE;
+                sTle9210x_aeInitStep[i] = TLE9210X_INIT_NORMAL_MODE;
+            }
+            else if(sTle9210x_ePwrState == OBDPWR_STATE_SLEEP)
+            {
+                /* init or restore was interrupted by sleep, start it over */
+                sTle9210x_aeInitStep[i] = TLE9210X_INIT_NORMAL_MODE;
+            }
+            else
+            {
+                /* RUN <-> LOWPOWER: chips stay configured */
+            }
+            sTle9210x_abOutDirty[i] = FALSE;
+        }
+
+        if(eState != OBDPWR_STATE_RUN)
+        {
+            /* diagnostics are suspended, results are unknown */
+            (void)memset(sTle9210x_atDiagResult,0u,sizeof(sTle9210x_atDiagResult));
+        }
+        sTle9210x_ePwrState = eState;
+    }
+}
+
+void Tle9210x_DeInit(void)
+{
+    uint8 i;
+
+    memset(sTle9210x_au8HbOutSts,0u,sizeof(sTle9210x_au8HbOutSts));
+    memset(sTle9210x_au8PwmDuty,0u,sizeof(sTle9210x_au8PwmDuty));
+    for(i = 0u;i < sTle9210x_u8GroupNum;i++)
+    {
+        Tle9210x_Submit(i, SPIARB_PRIO_SAFETY, &Tle9210x_OffJob);
+    }
+}
+
+void Tle9210x_WriteHbChn(uint8 u8GroupId, uint8 u8ChipId,uint8 u8ChnId, uint8 u8Val)
+{
+    if((u8GroupId < sTle9210x_u8GroupNum)
+    &&(u8ChipId < sTle9210x_au8ChipNum[u8GroupId])
+    &&(u8ChnId < (uint8)TLE9210X_HB_CHN_MAX))
+    {
+        if(sTle9210x_au8HbOutSts[u8GroupId][u8ChipId][u8ChnId] != u8Val)
+        {
+            sTle9210x_au8HbOutSts[u8GroupId][u8ChipId][u8ChnId] = u8Val;
+            sTle9210x_abOutDirty[u8GroupId] = TRUE;
+#if((TLE9210X_SPIARB_EN == STD_ON) || (TLE9210X_EVENT_OUTPUT_EN == STD_ON))
+            if((sTle9210x_aeInitStep[u8GroupId] == TLE9210X_INIT_DONE) && (sTle9210x_ePwrState != OBDPWR_STATE_SLEEP))
+            {
+#if(TLE9210X_SPIARB_EN == STD_ON)
+                /* flush on the next arbiter call instead of the next driver cycle */
+                Tle9210x_Submit(u8GroupId, SPIARB_PRIO_OUTPUT, &Tle9210x_OutputJob);
+#endif
+#if(TLE9210X_EVENT_OUTPUT_EN == STD_ON)
+                TLE9210X_OUTPUT_TRIGGER();
+#endif
+            }
+            else
+            {
+                /* written with the init or wake up sequence */
+            }
+#endif
+        }
+    }
+}
+
+void Tle9210x_WritePwmChn(uint8 u8GroupId, uint8 u8ChipId,uint8 u8PwmChn, uint8 u8Val)
+{
+    if((u8GroupId < sTle9210x_u8GroupNum)
+    &&(u8ChipId < sTle9210x_au8ChipNum[u8GroupId])
     &&(u8PwmChn < (uint8)TLE9210X_PWM_CHN_MAX))
     {
-        sTle9210x_au8PwmDuty[u8GroupId][u8ChipId][u8PwmChn] = u8Val;
+        if(sTle9210x_au8PwmDuty[u8GroupId][u8ChipId][u8PwmChn] != u8Val)
+        {
+            sTle9210x_au8PwmDuty[u8GroupId][u8ChipId][u8PwmChn] = u8Val;
+            sTle9210x_abOutDirty[u8GroupId] = TRUE;
+#if((TLE9210X_SPIARB_EN == STD_ON) || (TLE9210X_EVENT_OUTPUT_EN == STD_ON))
+            if((sTle9210x_aeInitStep[u8GroupId] == TLE9210X_INIT_DONE) && (sTle9210x_ePwrState != OBDPWR_STATE_SLEEP))
+            {
+#if(TLE9210X_SPIARB_EN == STD_ON)
+                /* flush on the next arbiter call instead of the next driver cycle */
+                Tle9210x_Submit(u8GroupId, SPIARB_PRIO_OUTPUT, &Tle9210x_OutputJob);
+#endif
+#if(TLE9210X_EVENT_OUTPUT_EN == STD_ON)
+                TLE9210X_OUTPUT_TRIGGER();
+#endif
+            }
+            else
+            {
+                /* written with the init or wake up sequence */
+            }
+#endif
+        }
     }
 }
 
-void Tle9210x_TriggerWdg(uint8 u8Group)
+/****************************************************************************************
+| NAME:    Tle9210x_WriteFwChn
+| CALLED BY:     HBridge
+| PRECONDITIONS:     NA
+| INPUT PARAMETERS:    uint8 u8GroupId, uint8 u8ChipId, uint8 u8PwmChn, boolean bActive
+| RETURN VALUE:     void
+| DESCRIPTION:      select active (TRUE) or passive freewheeling of a PWM channel. PWMSET is
+|                   sent with the next output job, before the init sequence is done it is
+|                   written by its PWM mapping step.
+****************************************************************************************/
+void Tle9210x_WriteFwChn(uint8 u8GroupId, uint8 u8ChipId, uint8 u8PwmChn, boolean bActive)
+{
+    uint8 l_u8Afw;
+
+    if((u8GroupId < sTle9210x_u8GroupNum)
+    &&(u8ChipId < sTle9210x_au8ChipNum[u8GroupId])
+    &&(u8PwmChn < (uint8)TLE9210X_PWM_CHN_MAX))
+    {
+        l_u8Afw = sTle9210x_au8PwmAfw[u8GroupId][u8ChipId];
+        if(bActive == TRUE)
+        {
+            l_u8Afw |= (uint8)(1u << u8PwmChn);
+        }
+        else
+        {
+            l_u8Afw &= (uint8)~(uint8)(1u << u8PwmChn);
+        }
+        if(sTle9210x_au8PwmAfw[u8GroupId][u8ChipId] != l_u8Afw)
+        {
+            sTle9210x_au8PwmAfw[u8GroupId][u8ChipId] = l_u8Afw;
+            sTle9210x_abPwmSetDirty[u8GroupId] = TRUE;
+            sTle9210x_abOutDirty[u8GroupId] = TRUE;
+#if((TLE9210X_SPIARB_EN == STD_ON) || (TLE9210X_EVENT_OUTPUT_EN == STD_ON))
+            if((sTle9210x_aeInitStep[u8GroupId] == TLE9210X_INIT_DONE) && (sTle9210x_ePwrState != OBDPWR_STATE_SLEEP))
+            {
+#if(TLE9210X_SPIARB_EN == STD_ON)
+                Tle9210x_Submit(u8GroupId, SPIARB_PRIO_OUTPUT, &Tle9210x_OutputJob);
+#endif
+#if(TLE9210X_EVENT_OUTPUT_EN == STD_ON)
+                TLE9210X_OUTPUT_TRIGGER();
+#endif
+            }
+            else
+            {
+                /* written with the init or wake up sequence */
+            }
+#endif
+        }
+    }
+}
+
+/****************************************************************************************
+| NAME:    Tle9210x_WriteBankReg
+| CALLED BY:     application (charge current / blank time reconfiguration)
+| PRECONDITIONS:     NA
+| INPUT PARAMETERS:    uint8 u8GroupId, uint8 u8ChipId, uint8 u8Bank: TLE9210X_REG_BANK_OFF (ACT)
+|                    or TLE9210X_REG_BANK_ON (FW/INIT), uint8 u8Reg: banked register address,
+|                    uint16 u16Val
+| RETURN VALUE:     void
+| DESCRIPTION:      set a banked register in the image, changed entries of the group are written
+|                   with the least bank switches: with the watchdog enabled by the next
+|                   Tle9210x_TriggerWdg, the bank switch rides in its GENCTRL1 frame, else
+|                   by the next output update.
+|                   A frame writes the entry of every chip, set it for all chips of the group.
+****************************************************************************************/
+void Tle9210x_WriteBankReg(uint8 u8GroupId, uint8 u8ChipId, uint8 u8Bank, uint8 u8Reg, uint16 u16Val)
+{
+    uint8 k;
+    uint8 l_u8Idx = TLE9210X_BANK_REG_NUM;
+    uint16 l_u16Bit;
+
+    for(k = 0u;k < TLE9210X_BANK_REG_NUM;k++)
+    {
+        if(cTle9210x_au8BankRegAddr[k] == u8Reg)
+        {
+            l_u8Idx = k;
+        }
+        else
+        {
+            /* nothing to do */
+        }
+    }
+
+    if((u8GroupId < sTle9210x_u8GroupNum)
+    &&(u8ChipId < sTle9210x_au8ChipNum[u8GroupId])
+    &&(u8Bank < TLE9210X_REG_BANK_ANY)
+    &&(l_u8Idx < TLE9210X_BANK_REG_NUM))
+    {
+        l_u16Bit = (uint16)(1u << ((u8Bank * TLE9210X_BANK_REG_NUM) + l_u8Idx));
+        if((sTle9210x_au16BankRegImg[u8GroupId][u8Bank][l_u8Idx][u8ChipId] != u16Val)
+        ||((sTle9210x_au16BankRegUsed[u8GroupId] & l_u16Bit) == 0u))
+        {
+            sTle9210x_au16BankRegImg[u8GroupId][u8Bank][l_u8Idx][u8ChipId] = u16Val;
+            sTle9210x_au16BankRegDirty[u8GroupId] |= l_u16Bit;
+            sTle9210x_au16BankRegUsed[u8GroupId] |= l_u16Bit;
+            if(Tle9210x_IsWdgEn(u8GroupId) == FALSE)
+            {
+                sTle9210x_abOutDirty[u8GroupId] = TRUE;
+            }
+            else
+            {
+                /* left to the watchdog trigger */
+            }
+#if((TLE9210X_SPIARB_EN == STD_ON) || (TLE9210X_EVENT_OUTPUT_EN == STD_ON))
+            if((sTle9210x_abOutDirty[u8GroupId] == TRUE)
+            && (sTle9210x_aeInitStep[u8GroupId] == TLE9210X_INIT_DONE) && (sTle9210x_ePwrState != OBDPWR_STATE_SLEEP))
+            {
+#if(TLE9210X_SPIARB_EN == STD_ON)
+                Tle9210x_Submit(u8GroupId, SPIARB_PRIO_OUTPUT, &Tle9210x_OutputJob);
+#endif
+#if(TLE9210X_EVENT_OUTPUT_EN == STD_ON)
+                TLE9210X_OUTPUT_TRIGGER();
+#endif
+            }
+            else
+            {
+                /* written with the init or wake up sequence */
+            }
+#endif
+        }
+    }
+}
+
+/****************************************************************************************
+| NAME:    Tle9210x_IsWdgEn
+| CALLED BY:     Tle9210x_OutputJob, Tle9210x_WriteBankReg
+| PRECONDITIONS:     NA
+| INPUT PARAMETERS:    uint8 u8Group
+| RETURN VALUE:     TRUE: a chip of the group has its watchdog enabled
+| DESCRIPTION:      Tle9210x_TriggerWdg has to send GENCTRL1 of the group periodically
+****************************************************************************************/
+static boolean Tle9210x_IsWdgEn(uint8 u8Group)
 {
+    uint8 j;
+    boolean l_bEn = FALSE;
+
+    for(j = 0u;j < sTle9210x_au8ChipNum[u8Group];j++)
+    {
+        if(cTle9210x_atChipCfg[u8Group][j].WDDIS == TLE9210X_WD_EN)
+        {
+            l_bEn = TRUE;
+        }
+        else
+        {
+            /* nothing to do */
+        }
+    }
+    return l_bEn;
+}
 
+/****************************************************************************************
+| NAME:    Tle9210x_WdgJob
+| CALLED BY:     Tle9210x_Submit, safety class
+| PRECONDITIONS:     Tle9210x_SetGenCtrlReg done
+| INPUT PARAMETERS:    uint8 u8Group
+| RETURN VALUE:     void
+| DESCRIPTION:      toggle the watchdog trigger bit of GENCTRL1. Changed banked registers are
+|                   written in the same plan, the GENCTRL1 frame carries the first bank.
+|                   The bit is toggled here and not at the request, so requests merged
+|                   by the arbiter toggle it once.
+****************************************************************************************/
+static void Tle9210x_WdgJob(uint8 u8Group)
+{
     uint8 j;
     uint8 l_au8RegBuf[TLE9210X_CHIP_MAX] = {0};
-    uint8 l_au16DataBuf[TLE9210X_CHIP_MAX] = {0};
+    uint16 l_au16DataBuf[TLE9210X_CHIP_MAX] = {0};
     uint8 l_u8ChipNum;
 
-    l_u8ChipNum = *cTle9210x_atGroupCfg[u8Group].pu8ChipNum;
+    l_u8ChipNum = sTle9210x_au8ChipNum[u8Group];
 
     for(j = 0u;j < l_u8ChipNum;j++)
     {
@@ -712,5 +1961,71 @@ void Tle9210x_TriggerWdg(uint8 u8Group)
         l_au16DataBuf[j] = sTle9210x_au16GenCtrl1[u8Group][j];
     }
 
-    Tle9210x_WriteReg(u8Group,l_au8RegBuf,l_au16DataBuf);
+    if((sTle9210x_au16BankRegDirty[u8Group] != 0u) && (sTle9210x_aeInitStep[u8Group] == TLE9210X_INIT_DONE))
+    {
+        /* the toggled GENCTRL1 heads the plan and selects the bank of the first pass */
+        Tle9210x_SetPwmActOrFw(u8Group, TRUE);
+    }
+    else
+    {
+        Tle9210x_WriteReg(u8Group,l_au8RegBuf,l_au16DataBuf);
+    }
+}
+
+/****************************************************************************************
+| NAME:    Tle9210x_TriggerWdg
+| CALLED BY:     application, within the watchdog period of the group
+| PRECONDITIONS:     Tle9210x_SetGenCtrlReg done
+| INPUT PARAMETERS:    uint8 u8Group
+| RETURN VALUE:     void
+| DESCRIPTION:      queue the watchdog trigger of the group, see Tle9210x_WdgJob
+****************************************************************************************/
+void Tle9210x_TriggerWdg(uint8 u8Group)
+{
+    if(u8Group < sTle9210x_u8GroupNum)
+    {
+        Tle9210x_Submit(u8Group, SPIARB_PRIO_SAFETY, &Tle9210x_WdgJob);
+    }
+    else
+    {
+        /* nothing to do */
+    }
+}
+
+/****************************************************************************************
+| NAME:    Tle9210x_GetFrameErrCnt
+| CALLED BY:     diagnostic service / application
+| PRECONDITIONS:     NA
+| INPUT PARAMETERS:    uint8 u8Group
+| RETURN VALUE:     rejected frames of the group, retries included, saturated
+| DESCRIPTION:      SPI frame error counter
+****************************************************************************************/
+uint16 Tle9210x_GetFrameErrCnt(uint8 u8Group)
+{
+    uint16 l_u16Cnt = 0u;
+
+    if(u8Group < TLE9210X_GROUP_MAX)
+    {
+        l_u16Cnt = sTle9210x_au16FrameErrCnt[u8Group];
+    }
+    return l_u16Cnt;
+}
+
+/****************************************************************************************
+| NAME:    Tle9210x_GetFrameLostCnt
+| CALLED BY:     diagnostic service / application
+| PRECONDITIONS:     NA
+| INPUT PARAMETERS:    uint8 u8Group
+| RETURN VALUE:     frames of the group still rejected after all retries, saturated
+| DESCRIPTION:      SPI frame lost counter
+****************************************************************************************/
+uint16 Tle9210x_GetFrameLostCnt(uint8 u8Group)
+{
+    uint16 l_u16Cnt = 0u;
+
+    if(u8Group < TLE9210X_GROUP_MAX)
+    {
+        l_u16Cnt = sTle9210x_au16FrameLostCnt[u8Group];
+    }
+    return l_u16Cnt;
 }
@@ -18,12 +18,23 @@
 #define _TLE9210X_H_
 #include "Tle9210x_HwCfg.h"
 #include "Tle9210x_Types.h"
+#include "ObdPwr_Types.h"
 
 
 extern void Tle9210x_Init(void);
+extern void Tle9210x_InitMainFunction(void);
+extern boolean Tle9210x_IsGroupReady(uint8 u8Group);
 extern void Tle9210x_MainFunction(void);
+#if((TLE9210X_EVENT_OUTPUT_EN == STD_ON) && (TLE9210X_SPIARB_EN == STD_OFF))
+extern void Tle9210x_OutputMainFunction(void);
+#endif
 extern void Tle9210x_DeInit(void);
-extern void Tle9210x_WriteOhbChn(uint8 u8GroupId, uint8 u8ChipId,uint8 u8ChnId, uint8 u8Val);
+extern void Tle9210x_WriteHbChn(uint8 u8GroupId, uint8 u8ChipId,uint8 u8ChnId, uint8 u8Val);
 extern void Tle9210x_WritePwmChn(uint8 u8GroupId, uint8 u8ChipId,uint8 u8PwmChn, uint8 u8Val);
+extern void Tle9210x_WriteFwChn(uint8 u8GroupId, uint8 u8ChipId, uint8 u8PwmChn, boolean bActive);
+extern void Tle9210x_WriteBankReg(uint8 u8GroupId, uint8 u8ChipId, uint8 u8Bank, uint8 u8Reg, uint16 u16Val);
+extern uint16 Tle9210x_GetFrameErrCnt(uint8 u8Group);
+extern uint16 Tle9210x_GetFrameLostCnt(uint8 u8Group);
+extern void Tle9210x_SetPowerState(ObdPwr_StateType eState);
 
 #endif
@@ -18,6 +18,7 @@
 #include "Dio.h"
 #include "Spi.h"
 #include "Pwm.h"
+#include "Adc.h"
 uint8 gTle9210x_u8Group0ChipNum = TLE9210X_CHIP_MAX;
 const Tle9210x_GroupType cTle9210x_atGroupCfg[TLE9210X_GROUP_MAX] =
 {
@@ -26,18 +27,21 @@ const Tle9210x_GroupType cTle9210x_atGroupCfg[TLE9210X_GROUP_MAX] =
         SpiConf_SpiSequence_SpiSequence_TLE92108_0,
         TLE9210X_DAISY_CHAIN_NO_USER,
         &gTle9210x_u8Group0ChipNum,
+        SPIARB_BUS_1,
     },
     {
         SpiConf_SpiChannel_SpiChannel_TLE92108_1, 
         SpiConf_SpiSequence_SpiSequence_TLE92108_1,
         TLE9210X_DAISY_CHAIN_NO_USER,
         &gTle9210x_u8Group0ChipNum,
+        SPIARB_BUS_1,
     },
     {
         SpiConf_SpiChannel_SpiChannel_TLE92108_2, 
         SpiConf_SpiSequence_SpiSequence_TLE92108_2,
         TLE9210X_DAISY_CHAIN_NO_USER,
         &gTle9210x_u8Group0ChipNum,
+        SPIARB_BUS_1,
     },
 };
 
@@ -49,7 +53,9 @@ const Tle9210x_ChipType cTle9210x_atChipCfg[TLE9210X_GROUP_MAX][TLE9210X_CHIP_MA
             DioConf_DioChannel_DioChannel_P32_02,
             TLE9210X_REG_BANK_OFF,
             TLE9210X_WD_200_MS,
-            TLE9210X_WD_DIS
+            TLE9210X_WD_DIS,
+            AdcConf_AdcGroup_AdcGroup_Tle92108_0_Cso1,
+            AdcConf_AdcGroup_AdcGroup_Tle92108_0_Cso2
         },
     },
     {
@@ -58,7 +64,9 @@ const Tle9210x_ChipType cTle9210x_atChipCfg[TLE9210X_GROUP_MAX][TLE9210X_CHIP_MA
             DioConf_DioChannel_DioChannel_P32_04,
             TLE9210X_REG_BANK_OFF,
             TLE9210X_WD_200_MS,
-            TLE9210X_WD_DIS
+            TLE9210X_WD_DIS,
+            AdcConf_AdcGroup_AdcGroup_Tle92108_1_Cso1,
+            AdcConf_AdcGroup_AdcGroup_Tle92108_1_Cso2
         },
     },
     {
@@ -67,7 +75,9 @@ const Tle9210x_ChipType cTle9210x_atChipCfg[TLE9210X_GROUP_MAX][TLE9210X_CHIP_MA
             DioConf_DioChannel_DioChannel_P31_00,
             TLE9210X_REG_BANK_OFF,
             TLE9210X_WD_200_MS,
-            TLE9210X_WD_DIS
+            TLE9210X_WD_DIS,
+            AdcConf_AdcGroup_AdcGroup_Tle92108_2_Cso1,
+            AdcConf_AdcGroup_AdcGroup_Tle92108_2_Cso2
         },
     },
 };
@@ -136,3 +146,20 @@ const Tle9210x_HbChnType cTle9210x_atHbChnCfg[TLE9210X_GROUP_MAX][TLE9210X_CHIP_
         },
     },
 };
+
+#if(TLE9210X_RIPPLE_EN == STD_ON)
+/* window lift motor on HB1/HB2 of group 0: CSO1 sampled at 20kHz, band-pass 150Hz - 1.5kHz */
+const Tle9210x_RippleMotorType cTle9210x_atRippleCfg[TLE9210X_RIPPLE_MOTOR_MAX] =
+{
+    {
+        TLE9210X_GROUP_0,
+        TLE9210X_CHIP_0,
+        TLE9210X_CSO1,
+        {2858, 0, -2858},
+        {-26753, 10669},
+        8u,
+        4u,
+        12u
+    },
+};
+#endif
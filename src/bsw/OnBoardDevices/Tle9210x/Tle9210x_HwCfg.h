@@ -18,6 +18,7 @@
 #define _TLE9210X_HWCFG_H_
 
 #include "Tle9210x_Types.h"
+#include "SpiArb.h"
 
 typedef enum
 {
@@ -36,10 +37,47 @@ typedef enum
 #define TLE9210X_TLE92104_CHIP_EN STD_OFF
 #define TLE9210X_TLE92108_CHIP_EN STD_ON
 
+/* STD_ON: Tle9210x_Init only arms the group init, the register sequence is run by
+   Tle9210x_InitMainFunction. STD_OFF: Tle9210x_Init runs the whole sequence blocking. */
+#define TLE9210X_INCREMENTAL_INIT STD_ON
+/* init steps per group and Tle9210x_InitMainFunction call, each step is one register access sequence */
+#define TLE9210X_INIT_STEPS_PER_CALL 1u
+/* STD_ON: the cyclic SPI work is queued as jobs on the arbiter of the group's SPI unit
+   (SpiArb_MainFunction runs them by priority). STD_OFF: jobs run at once in the caller. */
+#define TLE9210X_SPIARB_EN STD_ON
+/* repetitions of a rejected frame, only the failed group's last transaction is sent again */
+#define TLE9210X_SPI_RETRY_MAX 2u
+/* STD_ON: the cyclic output job is only queued for a changed output image, and every
+   TLE9210X_OUTPUT_REFRESH_CYCLES main cycles against lost register content (1u: every cycle).
+   Diagnostics stay on the main cycle. */
+#define TLE9210X_EVENT_OUTPUT_EN STD_ON
+#define TLE9210X_OUTPUT_REFRESH_CYCLES 10u
+/* callout after the write interface changed the output image, e.g. activation of the task
+   running SpiArb_MainFunction, or Tle9210x_OutputMainFunction when the arbiter is off,
+   so the change is applied before the next raster */
+#define TLE9210X_OUTPUT_TRIGGER() ((void)0)
+/* STD_ON: HBVOUT is read with the cyclic diagnostic and compared with the commanded HBMODE image */
+#define TLE9210X_VOUT_DIAG_EN STD_ON
+
+/* STD_ON: sensorless motor position by counting commutation ripples on CSO, see Tle9210x_Ripple */
+#define TLE9210X_RIPPLE_EN STD_ON
+typedef enum
+{
+    TLE9210X_RIPPLE_MOTOR_0 = 0u,
+    TLE9210X_RIPPLE_MOTOR_MAX
+}Tle9210x_RippleMotorId_e;
+/* circular ADC streaming buffer per motor, at least the samples of one 1ms cycle (20 at 20kHz) */
+#define TLE9210X_RIPPLE_BUF_LEN 32u
+/* ripple envelope time constant, 2^n samples */
+#define TLE9210X_RIPPLE_ENV_SHIFT 6u
+
 
 extern const Tle9210x_GroupType cTle9210x_atGroupCfg[TLE9210X_GROUP_MAX];
 extern const Tle9210x_ChipType cTle9210x_atChipCfg[TLE9210X_GROUP_MAX][TLE9210X_CHIP_MAX];
 extern const Tle9210x_PwmChnType cTle9210x_atPwmChnCfg[TLE9210X_GROUP_MAX][TLE9210X_CHIP_MAX][TLE9210X_PWM_CHN_MAX];
 extern const Tle9210x_HbChnType cTle9210x_atHbChnCfg[TLE9210X_GROUP_MAX][TLE9210X_CHIP_MAX][TLE9210X_HB_CHN_MAX];
+#if(TLE9210X_RIPPLE_EN == STD_ON)
+extern const Tle9210x_RippleMotorType cTle9210x_atRippleCfg[TLE9210X_RIPPLE_MOTOR_MAX];
+#endif
 
 #endif
@@ -0,0 +1,245 @@
+/*****************************************************************************************************************
+******************************************************************************************************************
+*  Copyright (C) .
+*  All rights reserved.
+******************************************************************************************************************
+*  FileName: Tle9210x_Ripple
+*  Content:  Sensorless motor position from the commutation ripple of the Tle9210x current sense
+*  Category: Tle92104 Tle92108
+******************************************************************************************************************
+*  Revision Management
+*  yyyy.mm.dd    name              version      description
+*  ----------    --------          -------      -----------------------------------
+*  2026.01.24    clipping            v0001        Frist edit
+******************************************************************************************************************
+******************************************************************************************************************/
+/* Include Headerfiles  */
+#include "Tle9210x_Ripple.h"
+#include "Adc.h"
+#include <string.h>
+
+#if(TLE9210X_RIPPLE_EN == STD_ON)
+
+/* circular streaming buffer of the CSO group of every motor, filled by the ADC hardware trigger */
+static Adc_ValueGroupType sTle9210x_au16RippleBuf[TLE9210X_RIPPLE_MOTOR_MAX][TLE9210X_RIPPLE_BUF_LEN];
+static Tle9210x_RippleStateType sTle9210x_atRipple[TLE9210X_RIPPLE_MOTOR_MAX];
+
+static Adc_GroupType Tle9210x_RippleAdcGroup(uint8 u8Motor);
+static void Tle9210x_RippleSample(uint8 u8Motor, uint16 u16Raw);
+
+/****************************************************************
+ process: Tle9210x_RippleAdcGroup
+ purpose: ADC streaming group of the CSO output the motor current
+          is sensed on, taken from the chip configuration.
+ ****************************************************************/
+static Adc_GroupType Tle9210x_RippleAdcGroup(uint8 u8Motor)
+{
+    const Tle9210x_RippleMotorType* l_ptCfg = &cTle9210x_atRippleCfg[u8Motor];
+    const Tle9210x_ChipType* l_ptChip = &cTle9210x_atChipCfg[l_ptCfg->u8Group][l_ptCfg->u8Chip];
+
+    return (Adc_GroupType)((l_ptCfg->u8Cso == TLE9210X_CSO1) ? l_ptChip->u8CSO1AdcMap : l_ptChip->u8CSO2AdcMap);
+}
+
+/****************************************************************
+ process: Tle9210x_RippleSample
+ purpose: One CSO sample through band-pass, envelope and ripple
+          detector. The band-pass removes the DC load current and
+          the PWM/switching noise, the threshold follows the ripple
+          envelope so the detector works from start-up current to
+          stall. A ripple is a rise above +thr after the signal was
+          below -thr, no sooner than 5/8 of the filtered ripple period.
+ ****************************************************************/
+static void Tle9210x_RippleSample(uint8 u8Motor, uint16 u16Raw)
+{
+    const Tle9210x_RippleMotorType* l_ptCfg = &cTle9210x_atRippleCfg[u8Motor];
+    Tle9210x_RippleStateType* l_ptSt = &sTle9210x_atRipple[u8Motor];
+    sint32 l_s32X;
+    sint32 l_s32Acc;
+    sint32 l_s32Y;
+    uint32 l_u32Abs;
+    uint32 l_u32Thr;
+    uint16 l_u16Blank;
+
+    /* direct form I, Q14 coefficients, 12 bit input keeps the accumulator in 32 bit.
+       The truncated fraction is fed back into the next sample, otherwise the
+       high DC gain of the feedback path turns it into an offset of the output. */
+    l_s32X = (sint32)u16Raw;
+    l_s32Acc = ((sint32)l_ptCfg->as16BpB[0] * l_s32X)
+             + ((sint32)l_ptCfg->as16BpB[1] * l_ptSt->as32X[0])
+             + ((sint32)l_ptCfg->as16BpB[2] * l_ptSt->as32X[1])
+             - ((sint32)l_ptCfg->as16BpA[0] * l_ptSt->as32Y[0])
+             - ((sint32)l_ptCfg->as16BpA[1] * l_ptSt->as32Y[1])
+             + l_ptSt->s32Err;
+    l_s32Y = l_s32Acc >> 14;
+    l_ptSt->s32Err = l_s32Acc - (l_s32Y * 16384);
+    l_ptSt->as32X[1] = l_ptSt->as32X[0];
+    l_ptSt->as32X[0] = l_s32X;
+    l_ptSt->as32Y[1] = l_ptSt->as32Y[0];
+    l_ptSt->as32Y[0] = l_s32Y;
+
+    /* envelope of |y|, first order low pass */
+    l_u32Abs = (uint32)((l_s32Y < 0) ? -l_s32Y : l_s32Y);
+    if(l_u32Abs > 0xFFFFu)
+    {
+        l_u32Abs = 0xFFFFu;
+    }
+    l_ptSt->u16Env = (uint16)((sint32)l_ptSt->u16Env + (((sint32)l_u32Abs - (sint32)l_ptSt->u16Env) >> TLE9210X_RIPPLE_ENV_SHIFT));
+    l_u32Thr = ((uint32)l_ptSt->u16Env * l_ptCfg->u8ThrRatio) >> 3u;
+    if(l_u32Thr < l_ptCfg->u16ThrMin)
+    {
+        l_u32Thr = l_ptCfg->u16ThrMin;
+    }
+
+    if(l_ptSt->u16Since < 0xFFFFu)
+    {
+        l_ptSt->u16Since++;
+    }
+    /* no ripple for 4 periods: motor stopped or restarting, forget the period */
+    if((uint32)l_ptSt->u16Since > ((uint32)l_ptSt->u16Period << 2u))
+    {
+        l_ptSt->u16Period = 0u;
+    }
+    l_u16Blank = (uint16)(((uint32)l_ptSt->u16Period * 5u) >> 3u);
+    if(l_u16Blank < l_ptCfg->u16BlankMin)
+    {
+        l_u16Blank = l_ptCfg->u16BlankMin;
+    }
+
+    if(l_s32Y < -(sint32)l_u32Thr)
+    {
+        l_ptSt->bArmed = TRUE;
+    }
+    else if((l_ptSt->bArmed == TRUE) && (l_s32Y > (sint32)l_u32Thr))
+    {
+        l_ptSt->bArmed = FALSE;
+        if(l_ptSt->u16Since >= l_u16Blank)
+        {
+            l_ptSt->u16Period = (l_ptSt->u16Period == 0u) ? l_ptSt->u16Since
+                              : (uint16)(((uint32)l_ptSt->u16Period * 3u + l_ptSt->u16Since) >> 2u);
+            l_ptSt->u16Since = 0u;
+            l_ptSt->s32Pos += l_ptSt->s8Dir;
+        }
+        else
+        {
+            /* ripple inside the blanking window: the period estimate is too long
+               (motor accelerating), shorten it so the detector does not lock on
+               every second ripple */
+            l_ptSt->u16Period = (uint16)(l_ptSt->u16Period - (l_ptSt->u16Period >> 3u));
+        }
+    }
+    else
+    {
+        /* nothing to do */
+    }
+}
+
+/****************************************************************
+ process: Tle9210x_RippleInit
+ purpose: Reset the filter state and start the hardware triggered
+          CSO streaming groups. The position is kept, it is set by
+          Tle9210x_RippleSetPos after homing.
+ ****************************************************************/
+void Tle9210x_RippleInit(void)
+{
+    uint8 i;
+    sint32 l_s32Pos;
+
+    for(i = 0u;i < (uint8)TLE9210X_RIPPLE_MOTOR_MAX;i++)
+    {
+        l_s32Pos = sTle9210x_atRipple[i].s32Pos;
+        (void)memset(&sTle9210x_atRipple[i],0,sizeof(sTle9210x_atRipple[i]));
+        sTle9210x_atRipple[i].s32Pos = l_s32Pos;
+        (void)Adc_SetupResultBuffer(Tle9210x_RippleAdcGroup(i),&sTle9210x_au16RippleBuf[i][0]);
+        Adc_EnableHardwareTrigger(Tle9210x_RippleAdcGroup(i));
+    }
+}
+
+/****************************************************************
+ process: Tle9210x_RippleMainFunction
+ purpose: 1ms task. Process the samples streamed since the last
+          call, from the own read index up to the last sample the
+          ADC wrote. Constant memory per motor, no sample copy.
+ ****************************************************************/
+void Tle9210x_RippleMainFunction(void)
+{
+    uint8 i;
+    uint8 l_u8WrIdx;
+    Adc_ValueGroupType* l_pu16Last;
+    Tle9210x_RippleStateType* l_ptSt;
+
+    for(i = 0u;i < (uint8)TLE9210X_RIPPLE_MOTOR_MAX;i++)
+    {
+        l_ptSt = &sTle9210x_atRipple[i];
+        if(Adc_GetStreamLastPointer(Tle9210x_RippleAdcGroup(i),&l_pu16Last) > 0u)
+        {
+            l_u8WrIdx = (uint8)((uint8)(l_pu16Last - &sTle9210x_au16RippleBuf[i][0]) + 1u);
+            if(l_u8WrIdx >= TLE9210X_RIPPLE_BUF_LEN)
+            {
+                l_u8WrIdx = 0u;
+            }
+            while(l_ptSt->u8RdIdx != l_u8WrIdx)
+            {
+                Tle9210x_RippleSample(i,sTle9210x_au16RippleBuf[i][l_ptSt->u8RdIdx]);
+                l_ptSt->u8RdIdx++;
+                if(l_ptSt->u8RdIdx >= TLE9210X_RIPPLE_BUF_LEN)
+                {
+                    l_ptSt->u8RdIdx = 0u;
+                }
+            }
+        }
+        else
+        {
+            /* no new sample */
+        }
+    }
+}
+
+/****************************************************************
+ process: Tle9210x_RippleSetDir
+ purpose: Counting direction from the commanded bridge: +1, -1,
+          0 stops counting (motor off, ripples are ignored).
+ ****************************************************************/
+void Tle9210x_RippleSetDir(uint8 u8Motor, sint8 s8Dir)
+{
+    if(u8Motor < (uint8)TLE9210X_RIPPLE_MOTOR_MAX)
+    {
+        sTle9210x_atRipple[u8Motor].s8Dir = (s8Dir > 0) ? 1 : ((s8Dir < 0) ? -1 : 0);
+    }
+}
+
+void Tle9210x_RippleSetPos(uint8 u8Motor, sint32 s32Pos)
+{
+    if(u8Motor < (uint8)TLE9210X_RIPPLE_MOTOR_MAX)
+    {
+        sTle9210x_atRipple[u8Motor].s32Pos = s32Pos;
+    }
+}
+
+sint32 Tle9210x_RippleGetPos(uint8 u8Motor)
+{
+    sint32 l_s32Pos = 0;
+
+    if(u8Motor < (uint8)TLE9210X_RIPPLE_MOTOR_MAX)
+    {
+        l_s32Pos = sTle9210x_atRipple[u8Motor].s32Pos;
+    }
+    return l_s32Pos;
+}
+
+/****************************************************************
+ process: Tle9210x_RippleGetPeriod
+ purpose: Filtered ripple period in CSO samples, 0 while stopped.
+          Motor speed = sample rate / (period * ripples per turn).
+ ****************************************************************/
+uint16 Tle9210x_RippleGetPeriod(uint8 u8Motor)
+{
+    uint16 l_u16Period = 0u;
+
+    if(u8Motor < (uint8)TLE9210X_RIPPLE_MOTOR_MAX)
+    {
+        l_u16Period = sTle9210x_atRipple[u8Motor].u16Period;
+    }
+    return l_u16Period;
+}
+
+#endif
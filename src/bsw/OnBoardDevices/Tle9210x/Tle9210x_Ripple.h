@@ -0,0 +1,31 @@
+/*****************************************************************************************************************
+******************************************************************************************************************
+*  Copyright (C) .
+*  All rights reserved.
+******************************************************************************************************************
+*  FileName: Tle9210x_Ripple
+*  Content:  Sensorless motor position from the commutation ripple of the Tle9210x current sense
+*  Category: Tle92104 Tle92108
+******************************************************************************************************************
+*  Revision Management
+*  yyyy.mm.dd    name              version      description
+*  ----------    --------          -------      -----------------------------------
+*  2026.01.24    clipping            v0001        Frist edit
+******************************************************************************************************************
+******************************************************************************************************************/
+/* Include Headerfiles  */
+#ifndef _TLE9210X_RIPPLE_H_
+#define _TLE9210X_RIPPLE_H_
+#include "Tle9210x_HwCfg.h"
+#include "Tle9210x_Types.h"
+
+#if(TLE9210X_RIPPLE_EN == STD_ON)
+extern void Tle9210x_RippleInit(void);
+extern void Tle9210x_RippleMainFunction(void);
+extern void Tle9210x_RippleSetDir(uint8 u8Motor, sint8 s8Dir);
+extern void Tle9210x_RippleSetPos(uint8 u8Motor, sint32 s32Pos);
+extern sint32 Tle9210x_RippleGetPos(uint8 u8Motor);
+extern uint16 Tle9210x_RippleGetPeriod(uint8 u8Motor);
+#endif
+
+#endif
@@ -57,6 +57,13 @@
 
 #define TLE9210X_REG_BANK_ON  1u
 #define TLE9210X_REG_BANK_OFF 0u
+/* access plan entry valid in either bank, or group bank not known */
+#define TLE9210X_REG_BANK_ANY 2u
+#define TLE9210X_REG_BANK_BIT 9u
+/* CCP_BLK2, ST_ICHG/PWM_PCHG_INIT, PWM_ICHG, PWM_IDCHG/PWM_PDCHG_INIT, PWM_ICHGMAX_CCP_BLK3 */
+#define TLE9210X_BANK_REG_NUM 5u
+/* GENCTRL1/2 and every banked register in both banks */
+#define TLE9210X_PLAN_MAX (2u + (2u * TLE9210X_BANK_REG_NUM))
 
 #define TLE9210X_WD_50_MS 0u
 #define TLE9210X_WD_200_MS 1u
@@ -78,6 +85,10 @@
 #define TLE9210X_LABT_OFF 0u
 #define TLE9210X_LABT_ON 1u
 
+/*****Global status byte, first byte of every chip in the response frame******/
+#define TLE9210X_GSB_GEF     0x80u   /* global error flag */
+#define TLE9210X_GSB_SPI_ERR 0x40u   /* SPI frame error: clock count or LABT framing wrong */
+
 #define TLE9210X_MODE_SLEEP 0u
 #define TLE9210X_MODE_NORMAL 1u
 #define TLE9210X_MODE_FAIL_SAFE 2u
@@ -89,6 +100,9 @@
 #define TLE9210X_OUT_STATUS_LS  1u
 #define TLE9210X_OUT_STATUS_HS  2u
 
+/* HBVOUT_PWMERR: bit n is the VOUT comparator level of HB(n+1) */
+#define TLE9210X_HBVOUT_MASK 0x00FFu
+
 #define TLE9210X_HB1 0u
 #define TLE9210X_HB2 1u
 #define TLE9210X_HB3 2u
@@ -128,6 +142,8 @@
 #define TLE9210X_PWM_CH2 1u
 #define TLE9210X_PWM_CH3 2u
 #define TLE9210X_PWM_CHN_MAX 3u
+/* PWMSET bit (TLE9210X_PWMSET_AFW_BIT + n): active freewheeling of PWM channel n, else passive */
+#define TLE9210X_PWMSET_AFW_BIT 12u
 
 #define TLE0210X_PWM_CHARGE_TIME_125NS 0u
 #define TLE0210X_PWM_CHARGE_TIME_250NS 1u
@@ -141,7 +157,7 @@ typedef struct
     Spi_SequenceType SpiSequence;
     uint8 u8DaisyChainEn;
     uint8* pu8ChipNum;
-
+    uint8 u8SpiBus;
 }Tle9210x_GroupType;
 
 typedef struct 
@@ -189,5 +205,59 @@ typedef struct
     uint16 u16DEVID;
 }Tle9210x_GenStsRegType;
 
+/* one register write for all chips of a group, pu16Data holds one value per chip.
+   GENCTRL1 is always written from the driver cache with the planned REG_BANK bit. */
+typedef struct
+{
+    uint8 u8Reg;
+    uint8 u8Bank;
+    const uint16* pu16Data;
+}Tle9210x_RegAccessType;
+
+/* steps of the group init sequence, see Tle9210x_InitMainFunction */
+typedef enum
+{
+    TLE9210X_INIT_NORMAL_MODE = 0u,
+    TLE9210X_INIT_GEN_CTRL,
+    TLE9210X_INIT_PWM_MAPPING,
+    TLE9210X_INIT_PWM_DELAY,
+    TLE9210X_INIT_GEN_STS,
+    TLE9210X_INIT_VDS,
+    TLE9210X_INIT_HB_OUTPUT,
+    TLE9210X_INIT_DONE,
+    /* wake up: register restore job queued, the job sets DONE */
+    TLE9210X_INIT_RESTORE
+}Tle9210x_InitStepType;
+
+#define TLE9210X_CSO1 0u
+#define TLE9210X_CSO2 1u
+
+/* ripple counting motor: current sense output of one chip, band-pass biquad in Q14 */
+typedef struct
+{
+    uint8 u8Group;
+    uint8 u8Chip;
+    uint8 u8Cso;
+    sint16 as16BpB[3];
+    sint16 as16BpA[2];
+    uint16 u16ThrMin;
+    uint8 u8ThrRatio;
+    uint16 u16BlankMin;
+}Tle9210x_RippleMotorType;
+
+typedef struct
+{
+    sint32 as32X[2];
+    sint32 as32Y[2];
+    sint32 s32Err;
+    uint16 u16Env;
+    boolean bArmed;
+    uint16 u16Since;
+    uint16 u16Period;
+    uint8 u8RdIdx;
+    sint8 s8Dir;
+    sint32 s32Pos;
+}Tle9210x_RippleStateType;
+
 
 #endif
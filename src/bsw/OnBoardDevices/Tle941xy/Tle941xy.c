@@ -17,17 +17,56 @@
 #include "Tle941xy.h"
 #include "Tle941xy_Types.h"
 #include "Pfm.h"
+#include "IoChnReg.h"
+#include <stddef.h>
+#include <string.h>
 
 static uint8 sTle941xy_u8GlobalStatus[TLE941XY_GROUP_MAX][TLE941XY_CHIP_MAX];
 static uint8 sTle941xy_u8PwmDuty[TLE941XY_GROUP_MAX][TLE941XY_CHIP_MAX][TLE941XY_PWM_CHN_MAX];
 static uint8 sTle941xy_u8HbOutSts[TLE941XY_GROUP_MAX][TLE941XY_CHIP_MAX][TLE941XY_CHANNEL_MAX];
 static PFM_DefectReportState_t sTle941xy_atDiagResult[TLE941XY_GROUP_MAX][TLE941XY_CHIP_MAX][TLE941XY_CHANNEL_MAX];
 static Tle941xy_RegDataType sTle941xy_atRegData[TLE941XY_GROUP_MAX][TLE941XY_CHIP_MAX];
+static ObdPwr_StateType sTle941xy_ePwrState = OBDPWR_STATE_RUN;
+/* output image changed since the last HB_ACT/PWM write, used in low power */
+static boolean sTle941xy_abOutDirty[TLE941XY_GROUP_MAX];
+/* active freewheeling selected per output, starts from the configuration, and
+   FW_OL_CTRL/FW_CTRL changed since they were last written */
+static boolean sTle941xy_abFwSel[TLE941XY_GROUP_MAX][TLE941XY_CHIP_MAX][TLE941XY_CHANNEL_MAX];
+static boolean sTle941xy_abFwDirty[TLE941XY_GROUP_MAX];
+#if(TLE941XY_EVENT_OUTPUT_EN == STD_ON)
+/* main cycles since the last output refresh */
+static uint8 sTle941xy_au8OutRefreshCnt[TLE941XY_GROUP_MAX];
+#endif
+/* groups and chips per group present in the selected variant, the loops only run over these */
+static uint8 sTle941xy_u8GroupNum;
+static uint8 sTle941xy_au8ChipNum[TLE941XY_GROUP_MAX];
+/* init progress per group, the cyclic functions skip groups that are not ready */
+static Tle941xy_InitStepType sTle941xy_aeInitStep[TLE941XY_GROUP_MAX];
+/* group woke up from sleep: the init sequence re-enables the chips, then restores the cache */
+static boolean sTle941xy_abWakeRestore[TLE941XY_GROUP_MAX];
+/* rejected frames and frames still rejected after all retries, per group */
+static uint16 sTle941xy_au16FrameErrCnt[TLE941XY_GROUP_MAX];
+static uint16 sTle941xy_au16FrameLostCnt[TLE941XY_GROUP_MAX];
+/* a frame of the group was lost in this cycle, its diagnostic result is not used */
+static boolean sTle941xy_abFrameLost[TLE941XY_GROUP_MAX];
+/* last accepted write per control register: a write answers with the register content, so the
+   echo of the next write to the same register is this value (or the new one on a retry) */
+static uint8 sTle941xy_au8EchoImg[TLE941XY_GROUP_MAX][TLE941XY_CHIP_MAX][TLE941XY_REG_ADDR_MASK + 1u];
+static uint32 sTle941xy_au32EchoValid[TLE941XY_GROUP_MAX][TLE941XY_CHIP_MAX];
+#if(TLE941XY_DERATE_EN == STD_ON)
+/* thermal derating level per chip and the debounce counters towards the next step */
+static uint8 sTle941xy_au8DerateLvl[TLE941XY_GROUP_MAX][TLE941XY_CHIP_MAX];
+static uint8 sTle941xy_au8DerateQualCnt[TLE941XY_GROUP_MAX][TLE941XY_CHIP_MAX];
+static uint8 sTle941xy_au8DerateHealCnt[TLE941XY_GROUP_MAX][TLE941XY_CHIP_MAX];
+#endif
 /****************************************************************************************
 |     Function Source Code
 |***************************************************************************************/
 
 static void Tle941xy_Recovery(uint8 u8GroupId,uint8* pu8RegBuf);
+static Std_ReturnType Tle941xy_CheckFrame(uint8 u8GroupId, const uint8* pu8SndBuf, const uint8* pu8RcvBuf);
+static void Tle941xy_UpdateEcho(uint8 u8GroupId, const uint8* pu8SndBuf, boolean bAccepted);
+static Std_ReturnType Tle941xy_Transfer(uint8 u8GroupId, const uint8* pu8SndBuf, uint8* pu8RcvBuf, uint8 u8Len);
 static void Tle941xy_WriteReg(uint8 u8GroupId,uint8* pu8RegBuf, uint8* pu8WtData);
 static void Tle941xy_ReadReg( uint8 u8GroupId,uint8* pu8RegBuf,uint8* pu8ReadBuf);
 
@@ -37,8 +76,161 @@ static void Tle941xy_SetFmPwmFreqReg(uint8 u8Group);
 static void Tle941xy_SetHbOutputReg(uint8 u8Group);
 static void Tle941xy_SetHbModeReg(uint8 u8Group);
 static void Tle941xy_ShortDiagnostic(uint8 u8Group);
+#if(TLE941XY_DERATE_EN == STD_ON)
+static boolean Tle941xy_GlobalDiagnostic(uint8 u8Group);
+static boolean Tle941xy_UpdateDerate(uint8 u8Group, uint8 u8Chip, uint8 u8SysDiag1);
+static void Tle941xy_ClearGlobalDiag(uint8 u8Group);
+#endif
+static uint8 Tle941xy_GetHbOutVal(uint8 u8Group, uint8 u8Chip, uint8 u8Chn);
+#if((TLE941XY_TLE94106_CHIP_EN == STD_ON)||(TLE941XY_TLE94108_CHIP_EN == STD_ON)||(TLE941XY_TLE94110_CHIP_EN == STD_ON)||(TLE941XY_TLE94112_CHIP_EN == STD_ON))
+static uint8 Tle941xy_GetPwmDutyVal(uint8 u8Group, uint8 u8Chip, uint8 u8PwmChn);
+#endif
 static void Tle941xy_SetFwOlReg(uint8 u8Group);
 static void Tle941xy_OLDiagnostic(uint8 u8Group);
+static void Tle941xy_ReportDiag(uint8 u8Group);
+static void Tle941xy_SelectVariant(void);
+static void Tle941xy_InitGroupStep(uint8 u8Group);
+static void Tle941xy_InitJob(uint8 u8Group);
+static void Tle941xy_WriteCacheReg(uint8 u8Group, uint8 u8Reg, uint8 u8Offset);
+static void Tle941xy_RestoreReg(uint8 u8Group);
+static void Tle941xy_SetChipEnable(uint8 u8Group, uint8 u8Level);
+static void Tle941xy_DiagJob(uint8 u8Group);
+static void Tle941xy_OutputJob(uint8 u8Group);
+static boolean Tle941xy_IsOutputDue(uint8 u8Group);
+static void Tle941xy_ShutdownJob(uint8 u8Group);
+static void Tle941xy_RestoreJob(uint8 u8Group);
+static void Tle941xy_OffJob(uint8 u8Group);
+static void Tle941xy_Submit(uint8 u8Group, SpiArb_PrioType ePrio, SpiArb_JobFuncType pfJob);
+/****************************************************************************************
+| NAME:    Tle941xy_CheckFrame
+| CALLED BY:     Tle941xy_Transfer
+| PRECONDITIONS:     frame of the group transmitted
+| INPUT PARAMETERS:    uint8 u8GroupId, const uint8* pu8SndBuf, const uint8* pu8RcvBuf
+| RETURN VALUE:     E_OK: frame accepted, E_NOT_OK: frame rejected
+| DESCRIPTION:      reject the frame when a chip flags an SPI error in its global status
+|                   byte, or when a write to a control register does not echo the last
+|                   accepted value (or, on a retry, the value being written)
+****************************************************************************************/
+static Std_ReturnType Tle941xy_CheckFrame(uint8 u8GroupId, const uint8* pu8SndBuf, const uint8* pu8RcvBuf)
+{
+    uint8 l_u8ChipIndex;
+    uint8 l_u8ChipNum;
+    uint8 l_u8Addr;
+    uint8 l_u8Echo;
+    Std_ReturnType l_u8RetVal = E_OK;
+
+    l_u8ChipNum = sTle941xy_au8ChipNum[u8GroupId];
+    for(l_u8ChipIndex = 0u;l_u8ChipIndex < l_u8ChipNum;l_u8ChipIndex++)
+    {
+        l_u8Addr = (uint8)((pu8SndBuf[l_u8ChipIndex] >> 2u) & TLE941XY_REG_ADDR_MASK);
+        l_u8Echo = pu8RcvBuf[(l_u8ChipNum * 2u) - l_u8ChipIndex - 1u];
+        if((pu8RcvBuf[l_u8ChipNum - l_u8ChipIndex - 1u] & TLE941XY_GSB_SPI_ERR) != 0u)
+        {
+            l_u8RetVal = E_NOT_OK;
+        }
+        else if(((pu8SndBuf[l_u8ChipIndex] & (uint8)(TLE941XY_WRITE << 7u)) != 0u)
+            && ((sTle941xy_au32EchoValid[u8GroupId][l_u8ChipIndex] & ((uint32)1u << l_u8Addr)) != 0u)
+            && (l_u8Echo != sTle941xy_au8EchoImg[u8GroupId][l_u8ChipIndex][l_u8Addr])
+            && (l_u8Echo != pu8SndBuf[l_u8ChipIndex + l_u8ChipNum]))
+        {
+            l_u8RetVal = E_NOT_OK;
+        }
+        else
+        {
+            /* nothing to do */
+        }
+    }
+    return l_u8RetVal;
+}
+
+/****************************************************************************************
+| NAME:    Tle941xy_UpdateEcho
+| CALLED BY:     Tle941xy_Transfer
+| PRECONDITIONS:     NA
+| INPUT PARAMETERS:    uint8 u8GroupId, const uint8* pu8SndBuf, boolean bAccepted
+| RETURN VALUE:     void
+| DESCRIPTION:      take the written control register values as the next expected echo.
+|                   A lost write leaves the register content unknown, the entries are
+|                   dropped and learnt again from the next accepted write.
+****************************************************************************************/
+static void Tle941xy_UpdateEcho(uint8 u8GroupId, const uint8* pu8SndBuf, boolean bAccepted)
+{
+    uint8 l_u8ChipIndex;
+    uint8 l_u8ChipNum;
+    uint8 l_u8Addr;
+
+    l_u8ChipNum = sTle941xy_au8ChipNum[u8GroupId];
+    for(l_u8ChipIndex = 0u;l_u8ChipIndex < l_u8ChipNum;l_u8ChipIndex++)
+    {
+        l_u8Addr = (uint8)((pu8SndBuf[l_u8ChipIndex] >> 2u) & TLE941XY_REG_ADDR_MASK);
+        if(((pu8SndBuf[l_u8ChipIndex] & (uint8)(TLE941XY_WRITE << 7u)) == 0u)
+            || ((TLE941XY_ECHO_REG_MASK & ((uint32)1u << l_u8Addr)) == 0u))
+        {
+            /* read or clear-on-write of a status register, no echo expected */
+        }
+        else if(bAccepted == TRUE)
+        {
+            sTle941xy_au8EchoImg[u8GroupId][l_u8ChipIndex][l_u8Addr] = pu8SndBuf[l_u8ChipIndex + l_u8ChipNum];
+            sTle941xy_au32EchoValid[u8GroupId][l_u8ChipIndex] |= ((uint32)1u << l_u8Addr);
+        }
+        else
+        {
+            sTle941xy_au32EchoValid[u8GroupId][l_u8ChipIndex] &= ~((uint32)1u << l_u8Addr);
+        }
+    }
+}
+
+/****************************************************************************************
+| NAME:    Tle941xy_Transfer
+| CALLED BY:     Tle941xy_WriteReg, Tle941xy_ReadReg
+| PRECONDITIONS:     NA
+| INPUT PARAMETERS:    uint8 u8GroupId, send/receive buffer, frame length
+| RETURN VALUE:     E_OK: frame accepted, E_NOT_OK: frame lost
+| DESCRIPTION:      send one daisy chain frame and check it. A rejected frame is sent
+|                   again up to TLE941XY_SPI_RETRY_MAX times on this group only, the
+|                   other groups and the register image are not touched.
+****************************************************************************************/
+static Std_ReturnType Tle941xy_Transfer(uint8 u8GroupId, const uint8* pu8SndBuf, uint8* pu8RcvBuf, uint8 u8Len)
+{
+    uint8 l_u8Try;
+    Std_ReturnType l_u8RetVal = E_NOT_OK;
+
+    for(l_u8Try = 0u;(l_u8Try <= TLE941XY_SPI_RETRY_MAX) && (l_u8RetVal != E_OK);l_u8Try++)
+    {
+        if((Spi_SetupEB(cTle941xy_atGroupCfg[u8GroupId].SpiChannel, pu8SndBuf, pu8RcvBuf, u8Len) == E_OK)
+            && (Spi_SyncTransmit(cTle941xy_atGroupCfg[u8GroupId].SpiSequence) == E_OK))
+        {
+            l_u8RetVal = Tle941xy_CheckFrame(u8GroupId, pu8SndBuf, pu8RcvBuf);
+        }
+        else
+        {
+            l_u8RetVal = E_NOT_OK;
+        }
+        if((l_u8RetVal != E_OK) && (sTle941xy_au16FrameErrCnt[u8GroupId] < 0xFFFFu))
+        {
+            sTle941xy_au16FrameErrCnt[u8GroupId]++;
+        }
+        else
+        {
+            /* nothing to do */
+        }
+    }
+    if(l_u8RetVal != E_OK)
+    {
+        if(sTle941xy_au16FrameLostCnt[u8GroupId] < 0xFFFFu)
+        {
+            sTle941xy_au16FrameLostCnt[u8GroupId]++;
+        }
+        sTle941xy_abFrameLost[u8GroupId] = TRUE;
+    }
+    else
+    {
+        /* nothing to do */
+    }
+    Tle941xy_UpdateEcho(u8GroupId, pu8SndBuf, (boolean)(l_u8RetVal == E_OK));
+    return l_u8RetVal;
+}
+
 /****************************************************************************************
 | NAME:    Tle941xy_WriteReg
 | CALLED BY:
@@ -54,7 +246,7 @@ static void Tle941xy_WriteReg(uint8 u8GroupId,uint8* pu8RegBuf, uint8* pu8WtData
     uint8 l_au8RcvDataBuf[TLE941XY_CHIP_MAX * 2] = {0};
     uint8 l_au8SndDataBuf[TLE941XY_CHIP_MAX * 2] = {0};
 
-    l_u8ChipNum = *cTle941xy_atGroupCfg[u8GroupId].pu8ChipNum;
+    l_u8ChipNum = sTle941xy_au8ChipNum[u8GroupId];
 
     if(l_u8ChipNum > 0u)
     {
@@ -70,14 +262,17 @@ static void Tle941xy_WriteReg(uint8 u8GroupId,uint8* pu8RegBuf, uint8* pu8WtData
         /****The last chip control LABT is 1 whether it is daisy chain communication or not********/
         l_au8SndDataBuf[l_u8ChipNum - 1u] |= (TLE941XY_LABT_ON << 1u);
 
-        /* Send Read  */
-        (void)Spi_SetupEB(cTle941xy_atGroupCfg[u8GroupId].SpiChannel, &l_au8SndDataBuf[0], &l_au8RcvDataBuf[0], (l_u8ChipNum * 2));
-
-        (void)Spi_SyncTransmit(cTle941xy_atGroupCfg[u8GroupId].SpiSequence);
-
-        for(l_u8ChipIndex = 0u; l_u8ChipIndex < l_u8ChipNum; l_u8ChipIndex++)
+        /* Send Write  */
+        if(Tle941xy_Transfer(u8GroupId, &l_au8SndDataBuf[0], &l_au8RcvDataBuf[0], (uint8)(l_u8ChipNum * 2u)) == E_OK)
+        {
+            for(l_u8ChipIndex = 0u; l_u8ChipIndex < l_u8ChipNum; l_u8ChipIndex++)
+            {
+                sTle941xy_u8GlobalStatus[u8GroupId][l_u8ChipIndex] = l_au8RcvDataBuf[(l_u8ChipNum - l_u8ChipIndex - 1u)];
+            }
+        }
+        else
         {
-            sTle941xy_u8GlobalStatus[u8GroupId][l_u8ChipIndex] = l_au8RcvDataBuf[(l_u8ChipNum - l_u8ChipIndex - 1u)];
+            /* frame lost, keep the last global status */
         }
     }
     else
@@ -98,10 +293,10 @@ static void Tle941xy_ReadReg( uint8 u8GroupId,uint8* pu8RegBuf,uint8* pu8ReadBuf
 {
     uint8 l_u8ChipIndex;
     uint8 l_u8ChipNum;
-    uint16 l_au8RcvDataBuf[TLE941XY_CHIP_MAX * 2u] = {0};
-    uint16 l_au8SndDataBuf[TLE941XY_CHIP_MAX * 2u] = {0};
+    uint8 l_au8RcvDataBuf[TLE941XY_CHIP_MAX * 2u] = {0};
+    uint8 l_au8SndDataBuf[TLE941XY_CHIP_MAX * 2u] = {0};
 
-    l_u8ChipNum = *cTle941xy_atGroupCfg[u8GroupId].pu8ChipNum;
+    l_u8ChipNum = sTle941xy_au8ChipNum[u8GroupId];
 
     if(l_u8ChipNum > 0u)
     {
@@ -117,13 +312,17 @@ static void Tle941xy_ReadReg( uint8 u8GroupId,uint8* pu8RegBuf,uint8* pu8ReadBuf
         l_au8SndDataBuf[l_u8ChipNum - 1u] |= (uint8)(TLE941XY_LABT_ON << 1u);
 
         /* Send Read  */
-        (void)Spi_SetupEB(cTle941xy_atGroupCfg[u8GroupId].SpiChannel, &l_au8SndDataBuf[0], &l_au8RcvDataBuf[0], (l_u8ChipNum * 2u));
-
-        (void)Spi_SyncTransmit(cTle941xy_atGroupCfg[u8GroupId].SpiSequence);
-
-        for(l_u8ChipIndex = 0u; l_u8ChipIndex < l_u8ChipNum; l_u8ChipIndex++)
+        if(Tle941xy_Transfer(u8GroupId, &l_au8SndDataBuf[0], &l_au8RcvDataBuf[0], (uint8)(l_u8ChipNum * 2u)) == E_OK)
+        {
+            for(l_u8ChipIndex = 0u; l_u8ChipIndex < l_u8ChipNum; l_u8ChipIndex++)
+            {
+                sTle941xy_u8GlobalStatus[u8GroupId][l_u8ChipIndex] = l_au8RcvDataBuf[(l_u8ChipNum - l_u8ChipIndex - 1u)];
+                pu8ReadBuf[l_u8ChipIndex] = l_au8RcvDataBuf[(l_u8ChipNum * 2u - l_u8ChipIndex - 1u)];
+            }
+        }
+        else
         {
-            pu8ReadBuf[l_u8ChipIndex] = l_au8RcvDataBuf[(l_u8ChipNum * 2u - l_u8ChipIndex - 1u)];
+            /* frame lost, the read buffer keeps its caller values */
         }
     }
     else
@@ -133,6 +332,55 @@ static void Tle941xy_ReadReg( uint8 u8GroupId,uint8* pu8RegBuf,uint8* pu8ReadBuf
 
 }
 
+/****************************************************************************************
+| NAME:    Tle941xy_GetHbOutVal
+| CALLED BY:     Tle941xy_SetHbOutputReg
+| PRECONDITIONS:     NA
+| INPUT PARAMETERS:    uint8 u8Group, uint8 u8Chip, uint8 u8Chn
+| RETURN VALUE:     HB_ACT field of the channel
+| DESCRIPTION:      output image of the channel, OFF while the channel is shed by the
+|                   thermal derating of its chip. The image itself is kept, so the
+|                   channel comes back as requested when the level drops.
+****************************************************************************************/
+static uint8 Tle941xy_GetHbOutVal(uint8 u8Group, uint8 u8Chip, uint8 u8Chn)
+{
+    uint8 l_u8Val;
+
+    l_u8Val = sTle941xy_u8HbOutSts[u8Group][u8Chip][u8Chn];
+#if(TLE941XY_DERATE_EN == STD_ON)
+    if(cTle941xy_au8ChnPrioCfg[u8Group][u8Chip][u8Chn] < sTle941xy_au8DerateLvl[u8Group][u8Chip])
+    {
+        l_u8Val = TLE941XY_OUT_STATUS_OFF;
+    }
+    else
+    {
+        /* nothing to do */
+    }
+#endif
+    return l_u8Val;
+}
+
+#if((TLE941XY_TLE94106_CHIP_EN == STD_ON)||(TLE941XY_TLE94108_CHIP_EN == STD_ON)||(TLE941XY_TLE94110_CHIP_EN == STD_ON)||(TLE941XY_TLE94112_CHIP_EN == STD_ON))
+/****************************************************************************************
+| NAME:    Tle941xy_GetPwmDutyVal
+| CALLED BY:     Tle941xy_SetHbPwmDutyReg
+| PRECONDITIONS:     NA
+| INPUT PARAMETERS:    uint8 u8Group, uint8 u8Chip, uint8 u8PwmChn
+| RETURN VALUE:     PWMx_DC_CTRL value
+| DESCRIPTION:      requested duty scaled to the derating level of the chip
+****************************************************************************************/
+static uint8 Tle941xy_GetPwmDutyVal(uint8 u8Group, uint8 u8Chip, uint8 u8PwmChn)
+{
+    uint8 l_u8Val;
+
+    l_u8Val = sTle941xy_u8PwmDuty[u8Group][u8Chip][u8PwmChn];
+#if(TLE941XY_DERATE_EN == STD_ON)
+    l_u8Val = (uint8)(((uint16)l_u8Val * cTle941xy_au8DerateDutyCfg[sTle941xy_au8DerateLvl[u8Group][u8Chip]]) / 100u);
+#endif
+    return l_u8Val;
+}
+#endif
+
 static void Tle941xy_SetHbOutputReg(uint8 u8Group)
 {
     uint8 j;
@@ -140,29 +388,35 @@ static void Tle941xy_SetHbOutputReg(uint8 u8Group)
     uint8 l_au8DataBuf[TLE941XY_CHIP_MAX] = {0};
     uint8 l_u8ChipNum;
 
-    l_u8ChipNum = *cTle941xy_atGroupCfg[u8Group].pu8ChipNum;
+    l_u8ChipNum = sTle941xy_au8ChipNum[u8Group];
     /***OUT1-OUT4**/
     for(j = 0u;j<l_u8ChipNum;j++)
     {
         l_au8RegBuf[j] = TLE941XY_HB_ACT_1_CTRL;
-        l_au8DataBuf[j] = (sTle941xy_u8HbOutSts[u8Group][j][0] 
-                        | (uint8)(sTle941xy_u8HbOutSts[u8Group][j][1] << 2u)
-                        | (uint8)(sTle941xy_u8HbOutSts[u8Group][j][2] << 4u)
-                        | (uint8)(sTle941xy_u8HbOutSts[u8Group][j][3] << 6u));
+        l_au8DataBuf[j] = (Tle941xy_GetHbOutVal(u8Group,j,0u)
+                        | (uint8)(Tle941xy_GetHbOutVal(u8Group,j,1u) << 2u)
+                        | (uint8)(Tle941xy_GetHbOutVal(u8Group,j,2u) << 4u)
+                        | (uint8)(Tle941xy_GetHbOutVal(u8Group,j,3u) << 6u));
+    }
+    for(j = 0u;j < l_u8ChipNum;j++)
+    {
+        sTle941xy_atRegData[u8Group][j].HB_ACT_1_CTRL = l_au8DataBuf[j];
     }
-    sTle941xy_atRegData[u8Group][j].HB_ACT_1_CTRL = l_au8DataBuf[j];
     Tle941xy_WriteReg(u8Group,l_au8RegBuf,l_au8DataBuf);
 #if((TLE941XY_TLE94106_CHIP_EN == STD_ON)||(TLE941XY_TLE94108_CHIP_EN == STD_ON)||(TLE941XY_TLE94110_CHIP_EN == STD_ON)||(TLE941XY_TLE94112_CHIP_EN == STD_ON))
     /***OUT5-OUT8**/
     for(j = 0u;j < l_u8ChipNum;j++)
     {
         l_au8RegBuf[j] = TLE941XY_HB_ACT_2_CTRL;
-        l_au8DataBuf[j] = (sTle941xy_u8HbOutSts[u8Group][j][4] 
-                        | (uint8)(sTle941xy_u8HbOutSts[u8Group][j][5] << 2u)
-                        | (uint8)(sTle941xy_u8HbOutSts[u8Group][j][6] << 4u)
-                        | (uint8)(sTle941xy_u8HbOutSts[u8Group][j][7] << 6u));
+        l_au8DataBuf[j] = (Tle941xy_GetHbOutVal(u8Group,j,4u)
+                        | (uint8)(Tle941xy_GetHbOutVal(u8Group,j,5u) << 2u)
+                        | (uint8)(Tle941xy_GetHbOutVal(u8Group,j,6u) << 4u)
+                        | (uint8)(Tle941xy_GetHbOutVal(u8Group,j,7u) << 6u));
+    }
+    for(j = 0u;j < l_u8ChipNum;j++)
+    {
+        sTle941xy_atRegData[u8Group][j].HB_ACT_2_CTRL = l_au8DataBuf[j];
     }
-    sTle941xy_atRegData[u8Group][j].HB_ACT_2_CTRL = l_au8DataBuf[j];
     Tle941xy_WriteReg(u8Group,l_au8RegBuf,l_au8DataBuf);
 #endif
 #if((TLE941XY_TLE94110_CHIP_EN == STD_ON)||(TLE941XY_TLE94112_CHIP_EN == STD_ON))
@@ -170,12 +424,15 @@ static void Tle941xy_SetHbOutputReg(uint8 u8Group)
     for(j = 0u;j < l_u8ChipNum;j++)
     {
         l_au8RegBuf[j] = TLE941XY_HB_ACT_3_CTRL;
-        l_au8DataBuf[j] = (sTle941xy_u8HbOutSts[u8Group][j][8] 
-                        | (uint8)(sTle941xy_u8HbOutSts[u8Group][j][9] << 2u)
-                        | (uint8)(sTle941xy_u8HbOutSts[u8Group][j][10] << 4u)
-                        | (uint8)(sTle941xy_u8HbOutSts[u8Group][j][11] << 6u));
+        l_au8DataBuf[j] = (Tle941xy_GetHbOutVal(u8Group,j,8u)
+                        | (uint8)(Tle941xy_GetHbOutVal(u8Group,j,9u) << 2u)
+                        | (uint8)(Tle941xy_GetHbOutVal(u8Group,j,10u) << 4u)
+                        | (uint8)(Tle941xy_GetHbOutVal(u8Group,j,11u) << 6u));
+    }
+    for(j = 0u;j < l_u8ChipNum;j++)
+    {
+        sTle941xy_atRegData[u8Group][j].HB_ACT_3_CTRL = l_au8DataBuf[j];
     }
-    sTle941xy_atRegData[u8Group][j].HB_ACT_3_CTRL = l_au8DataBuf[j];
     Tle941xy_WriteReg(u8Group,l_au8RegBuf,l_au8DataBuf);
 #endif
 }
@@ -187,7 +444,7 @@ static void Tle941xy_SetHbModeReg(uint8 u8Group)
     uint8 l_au8DataBuf[TLE941XY_CHIP_MAX] = {0};
     uint8 l_u8ChipNum;
 
-    l_u8ChipNum = *cTle941xy_atGroupCfg[u8Group].pu8ChipNum;
+    l_u8ChipNum = sTle941xy_au8ChipNum[u8Group];
     /***OUT1-OUT4**/
     for(j = 0u;j<l_u8ChipNum;j++)
     {
@@ -197,7 +454,10 @@ static void Tle941xy_SetHbModeReg(uint8 u8Group)
                         | (uint8)(cTle941xy_au8ChnModeCfg[u8Group][j][2] << 4u)
                         | (uint8)(cTle941xy_au8ChnModeCfg[u8Group][j][3] << 6u));
     }
-    sTle941xy_atRegData[u8Group][j].HB_MODE_1_CTRL = l_au8DataBuf[j];
+    for(j = 0u;j < l_u8ChipNum;j++)
+    {
+        sTle941xy_atRegData[u8Group][j].HB_MODE_1_CTRL = l_au8DataBuf[j];
+    }
     Tle941xy_WriteReg(u8Group,l_au8RegBuf,l_au8DataBuf);
 #if((TLE941XY_TLE94106_CHIP_EN == STD_ON)||(TLE941XY_TLE94108_CHIP_EN == STD_ON)||(TLE941XY_TLE94110_CHIP_EN == STD_ON)||(TLE941XY_TLE94112_CHIP_EN == STD_ON))
     /***OUT5-OUT8**/
@@ -209,7 +469,10 @@ static void Tle941xy_SetHbModeReg(uint8 u8Group)
                         | (uint8)(cTle941xy_au8ChnModeCfg[u8Group][j][6] << 4u)
                         | (uint8)(cTle941xy_au8ChnModeCfg[u8Group][j][7] << 6u));
     }
-    sTle941xy_atRegData[u8Group][j].HB_MODE_2_CTRL = l_au8DataBuf[j];
+    for(j = 0u;j < l_u8ChipNum;j++)
+    {
+        sTle941xy_atRegData[u8Group][j].HB_MODE_2_CTRL = l_au8DataBuf[j];
+    }
     Tle941xy_WriteReg(u8Group,l_au8RegBuf,l_au8DataBuf);
 #endif
 #if((TLE941XY_TLE94110_CHIP_EN == STD_ON)||(TLE941XY_TLE94112_CHIP_EN == STD_ON))
@@ -222,7 +485,10 @@ static void Tle941xy_SetHbModeReg(uint8 u8Group)
                         | (uint8)(cTle941xy_au8ChnModeCfg[u8Group][j][10] << 4u)
                         | (uint8)(cTle941xy_au8ChnModeCfg[u8Group][j][11] << 6u));
     }
-    sTle941xy_atRegData[u8Group][j].HB_MODE_3_CTRL = l_au8DataBuf[j];   
+    for(j = 0u;j < l_u8ChipNum;j++)
+    {
+        sTle941xy_atRegData[u8Group][j].HB_MODE_3_CTRL = l_au8DataBuf[j];
+    }
     Tle941xy_WriteReg(u8Group,l_au8RegBuf,l_au8DataBuf);
 #endif
 }
@@ -234,7 +500,7 @@ static void Tle941xy_SetFmPwmFreqReg(uint8 u8Group)
     uint8 l_au8DataBuf[TLE941XY_CHIP_MAX] = {0};
     uint8 l_u8ChipNum;
 
-    l_u8ChipNum = *cTle941xy_atGroupCfg[u8Group].pu8ChipNum;
+    l_u8ChipNum = sTle941xy_au8ChipNum[u8Group];
     /***OUT1-OUT4**/
     for(j = 0u;j < l_u8ChipNum;j++)
     {
@@ -251,7 +517,10 @@ static void Tle941xy_SetFmPwmFreqReg(uint8 u8Group)
                         | (uint8)(cTle941xy_atChipFmPwmFreqCfg[u8Group][j].u8Pwm2Freq << 4u)
                         | (uint8)(cTle941xy_atChipFmPwmFreqCfg[u8Group][j].u8Pwm3Freq << 6u));
     }
-    sTle941xy_atRegData[u8Group][j].PWM_CH_FREQ_CTRL = l_au8DataBuf[j];
+    for(j = 0u;j < l_u8ChipNum;j++)
+    {
+        sTle941xy_atRegData[u8Group][j].PWM_CH_FREQ_CTRL = l_au8DataBuf[j];
+    }
     Tle941xy_WriteReg(u8Group,l_au8RegBuf,l_au8DataBuf);
 }
 
@@ -262,13 +531,16 @@ static void Tle941xy_ReadDeviceIdReg(uint8 u8Group)
     uint8 l_au8DataBuf[TLE941XY_CHIP_MAX] = {0};
     uint8 l_u8ChipNum;
 
-    l_u8ChipNum = *cTle941xy_atGroupCfg[u8Group].pu8ChipNum;
+    l_u8ChipNum = sTle941xy_au8ChipNum[u8Group];
     for(j = 0u;j<l_u8ChipNum;j++)
     {
         l_au8RegBuf[j] = TLE941XY_CONFIG_CTRL;
     }
-    sTle941xy_atRegData[u8Group][j].CONFIG_CTRL = l_au8DataBuf[j];
     Tle941xy_ReadReg(u8Group,l_au8RegBuf,l_au8DataBuf);
+    for(j = 0u;j < l_u8ChipNum;j++)
+    {
+        sTle941xy_atRegData[u8Group][j].CONFIG_CTRL = l_au8DataBuf[j];
+    }
 }
 
 
@@ -280,30 +552,39 @@ static void Tle941xy_SetHbPwmDutyReg(uint8 u8Group)
     uint8 l_au8DataBuf[TLE941XY_CHIP_MAX] = {0};
     uint8 l_u8ChipNum;
 
-    l_u8ChipNum = *cTle941xy_atGroupCfg[u8Group].pu8ChipNum;
+    l_u8ChipNum = sTle941xy_au8ChipNum[u8Group];
 
     for(j = 0u;j<l_u8ChipNum;j++)
     {
         l_au8RegBuf[j] = TLE941XY_PWM1_DC_CTRL;
-        l_au8DataBuf[j] = sTle941xy_u8PwmDuty[u8Group][j][0];
+        l_au8DataBuf[j] = Tle941xy_GetPwmDutyVal(u8Group,j,0u);
+    }
+    for(j = 0u;j < l_u8ChipNum;j++)
+    {
+        sTle941xy_atRegData[u8Group][j].PWM1_DC_CTRL = l_au8DataBuf[j];
     }
-    sTle941xy_atRegData[u8Group][j].PWM1_DC_CTRL = l_au8DataBuf[j];
     Tle941xy_WriteReg(u8Group,l_au8RegBuf,l_au8DataBuf);
 
     for(j = 0u;j<l_u8ChipNum;j++)
     {
         l_au8RegBuf[j] = TLE941XY_PWM2_DC_CTRL;
-        l_au8DataBuf[j] = sTle941xy_u8PwmDuty[u8Group][j][1];
+        l_au8DataBuf[j] = Tle941xy_GetPwmDutyVal(u8Group,j,1u);
+    }
+    for(j = 0u;j < l_u8ChipNum;j++)
+    {
+        sTle941xy_atRegData[u8Group][j].PWM2_DC_CTRL = l_au8DataBuf[j];
     }
-    sTle941xy_atRegData[u8Group][j].PWM2_DC_CTRL = l_au8DataBuf[j];
     Tle941xy_WriteReg(u8Group,l_au8RegBuf,l_au8DataBuf);
 
     for(j = 0u;j<l_u8ChipNum;j++)
     {
         l_au8RegBuf[j] = TLE941XY_PWM3_DC_CTRL;
-        l_au8DataBuf[j] = sTle941xy_u8PwmDuty[u8Group][j][2];
+        l_au8DataBuf[j] = Tle941xy_GetPwmDutyVal(u8Group,j,2u);
+    }
+    for(j = 0u;j < l_u8ChipNum;j++)
+    {
+        sTle941xy_atRegData[u8Group][j].PWM3_DC_CTRL = l_au8DataBuf[j];
     }
-    sTle941xy_atRegData[u8Group][j].PWM3_DC_CTRL = l_au8DataBuf[j];
     Tle941xy_WriteReg(u8Group,l_au8RegBuf,l_au8DataBuf);
 
 #endif
@@ -316,7 +597,8 @@ static void Tle941xy_SetFwOlReg(uint8 u8Group)
     uint8 l_au8DataBuf[TLE941XY_CHIP_MAX] = {0};
     uint8 l_u8ChipNum;
 
-    l_u8ChipNum = *cTle941xy_atGroupCfg[u8Group].pu8ChipNum;
+    l_u8ChipNum = sTle941xy_au8ChipNum[u8Group];
+    sTle941xy_abFwDirty[u8Group] = FALSE;
 
 #if((TLE941XY_TLE94106_CHIP_EN == STD_ON)||(TLE941XY_TLE94108_CHIP_EN == STD_ON)||(TLE941XY_TLE94110_CHIP_EN == STD_ON)||(TLE941XY_TLE94112_CHIP_EN == STD_ON))
     /***OUT5-OUT8**/
@@ -325,14 +607,17 @@ static void Tle941xy_SetFwOlReg(uint8 u8Group)
         l_au8RegBuf[j] = TLE941XY_FW_OL_CTRL;
         l_au8DataBuf[j] = (cTle941xy_abChipHS1And2LedModeCfg[u8Group][j][0] 
                         | (uint8)(cTle941xy_abChipHS1And2LedModeCfg[u8Group][j][1] << 1u)
-                        | (uint8)(cTle941xy_abChipFreeWheelingCfg[u8Group][j][0] << 2u)
-                        | (uint8)(cTle941xy_abChipFreeWheelingCfg[u8Group][j][1] << 3u)
-                        | (uint8)(cTle941xy_abChipFreeWheelingCfg[u8Group][j][2] << 4u)
-                        | (uint8)(cTle941xy_abChipFreeWheelingCfg[u8Group][j][3] << 5u)
-                        | (uint8)(cTle941xy_abChipFreeWheelingCfg[u8Group][j][4] << 6u)
-                        | (uint8)(cTle941xy_abChipFreeWheelingCfg[u8Group][j][5] << 7u));
-    }
-    sTle941xy_atRegData[u8Group][j].FW_OL_CTRL = l_au8DataBuf[j];
+                        | (uint8)(sTle941xy_abFwSel[u8Group][j][0] << 2u)
+                        | (uint8)(sTle941xy_abFwSel[u8Group][j][1] << 3u)
+                        | (uint8)(sTle941xy_abFwSel[u8Group][j][2] << 4u)
+                        | (uint8)(sTle941xy_abFwSel[u8Group][j][3] << 5u)
+                        | (uint8)(sTle941xy_abFwSel[u8Group][j][4] << 6u)
+                        | (uint8)(sTle941xy_abFwSel[u8Group][j][5] << 7u));
+    }
+    for(j = 0u;j < l_u8ChipNum;j++)
+    {
+        sTle941xy_atRegData[u8Group][j].FW_OL_CTRL = l_au8DataBuf[j];
+    }
     Tle941xy_WriteReg(u8Group,l_au8RegBuf,l_au8DataBuf);
 #endif
 #if((TLE941XY_TLE94103_CHIP_EN == STD_ON)||(TLE941XY_TLE94104_CHIP_EN == STD_ON)||(TLE941XY_TLE94108_CHIP_EN == STD_ON)||(TLE941XY_TLE94110_CHIP_EN == STD_ON)||(TLE941XY_TLE94112_CHIP_EN == STD_ON))
@@ -340,16 +625,19 @@ static void Tle941xy_SetFwOlReg(uint8 u8Group)
     for(j = 0u;j < l_u8ChipNum;j++)
     {
         l_au8RegBuf[j] = TLE941XY_FW_CTRL;
-        l_au8DataBuf[j] = (cTle941xy_abChipFreeWheelingCfg[u8Group][j][6] 
-                        | (uint8)(cTle941xy_abChipFreeWheelingCfg[u8Group][j][7] << 1u)
-                        | (uint8)(cTle941xy_abChipFreeWheelingCfg[u8Group][j][8] << 2u)
-                        | (uint8)(cTle941xy_abChipFreeWheelingCfg[u8Group][j][9] << 3u)
-                        | (uint8)(cTle941xy_abChipFreeWheelingCfg[u8Group][j][10] << 4u)
-                        | (uint8)(cTle941xy_abChipFreeWheelingCfg[u8Group][j][11] << 5u)
-                        | (uint8)(cTle941xy_abChipFreeWheelingCfg[u8Group][j][0] << 6u)
-                        | (uint8)(cTle941xy_abChipFreeWheelingCfg[u8Group][j][0] << 7u));
-    }
-    sTle941xy_atRegData[u8Group][j].FW_CTRL = l_au8DataBuf[j];
+        l_au8DataBuf[j] = (sTle941xy_abFwSel[u8Group][j][6] 
+                        | (uint8)(sTle941xy_abFwSel[u8Group][j][7] << 1u)
+                        | (uint8)(sTle941xy_abFwSel[u8Group][j][8] << 2u)
+                        | (uint8)(sTle941xy_abFwSel[u8Group][j][9] << 3u)
+                        | (uint8)(sTle941xy_abFwSel[u8Group][j][10] << 4u)
+                        | (uint8)(sTle941xy_abFwSel[u8Group][j][11] << 5u)
+                        | (uint8)(sTle941xy_abFwSel[u8Group][j][0] << 6u)
+                        | (uint8)(sTle941xy_abFwSel[u8Group][j][0] << 7u));
+    }
+    for(j = 0u;j < l_u8ChipNum;j++)
+    {
+        sTle941xy_atRegData[u8Group][j].FW_CTRL = l_au8DataBuf[j];
+    }
     Tle941xy_WriteReg(u8Group,l_au8RegBuf,l_au8DataBuf);
 #endif
 }
@@ -370,41 +658,44 @@ static void Tle941xy_ShortDiagnostic(uint8 u8Group)
     uint8 l_au8DataBuf[TLE941XY_CHIP_MAX] = {0};
     uint8 l_u8ChipNum;
     uint8 l_u8DisplacementLen;
-    uint8 l_u8ChipShortFlag;
+    uint8 l_u8ChipShortFlag = 0u;
 
-    l_u8ChipNum = *cTle941xy_atGroupCfg[u8Group].pu8ChipNum;
+    l_u8ChipNum = sTle941xy_au8ChipNum[u8Group];
     /***OUT1-OUT4**/
     for(j = 0u;j < l_u8ChipNum;j++)
     {
         l_au8RegBuf[j] = TLE941XY_SYS_DIAG_2;
     }
     Tle941xy_ReadReg(u8Group,l_au8RegBuf,l_au8DataBuf);
-    sTle941xy_atRegData[u8Group][j].SYS_DIAG_2 = l_au8DataBuf[j];
     for(j = 0u;j < l_u8ChipNum;j++)
     {
-        for(j = 0u;k < 4u;k++)
+        sTle941xy_atRegData[u8Group][j].SYS_DIAG_2 = l_au8DataBuf[j];
+    }
+    for(j = 0u;j < l_u8ChipNum;j++)
+    {
+        for(k = 0u;k < 4u;k++)
         {
             l_u8DisplacementLen = (uint8)(k * 2u);
-            if((l_au8RegBuf[j] && (0x03u << l_u8DisplacementLen)) != 0x00u)
+            if((l_au8DataBuf[j] & (uint8)(0x03u << l_u8DisplacementLen)) != 0x00u)
             {
                 l_u8ChipShortFlag++;
                 if(sTle941xy_u8HbOutSts[u8Group][j][k] == TLE941XY_OUT_STATUS_LS)
                 {
-                    sTle941xy_atDiagResult[u8Group][j][k].eShort2Vcc = PFM_DDS_POS;
+                    sTle941xy_atDiagResult[u8Group][j][k].Short2Vcc = PFM_DDS_POS;
                 }
                 else
                 {
-                    sTle941xy_atDiagResult[u8Group][j][k].eShort2Gnd = PFM_DDS_POS;
+                    sTle941xy_atDiagResult[u8Group][j][k].Short2Gnd = PFM_DDS_POS;
                 }
             }
             else
             {
-                sTle941xy_atDiagResult[u8Group][j][k].eShort2Vcc = PFM_DDS_NEG;
-                sTle941xy_atDiagResult[u8Group][j][k].eShort2Gnd = PFM_DDS_NEG;
+                sTle941xy_atDiagResult[u8Group][j][k].Short2Vcc = PFM_DDS_NEG;
+                sTle941xy_atDiagResult[u8Group][j][k].Short2Gnd = PFM_DDS_NEG;
             }
         }
     }
-    if(l_u8ChipShortFlag > 0u)
+    if((l_u8ChipShortFlag > 0u) && (sTle941xy_abFrameLost[u8Group] == FALSE))
     {
         Tle941xy_Recovery(u8Group,l_au8RegBuf);
     }
@@ -421,32 +712,35 @@ static void Tle941xy_ShortDiagnostic(uint8 u8Group)
         l_au8RegBuf[j] = TLE941XY_SYS_DIAG_3;
     }
     Tle941xy_ReadReg(u8Group,l_au8RegBuf,l_au8DataBuf);
-    sTle941xy_atRegData[u8Group][j].SYS_DIAG_3 = l_au8DataBuf[j];
     for(j = 0u;j < l_u8ChipNum;j++)
     {
-        for(j = 0u;k < 4u;k++)
+        sTle941xy_atRegData[u8Group][j].SYS_DIAG_3 = l_au8DataBuf[j];
+    }
+    for(j = 0u;j < l_u8ChipNum;j++)
+    {
+        for(k = 0u;k < 4u;k++)
         {
             l_u8DisplacementLen = (uint8)(k * 2u);
-            if((l_au8RegBuf[j] && (0x03u << l_u8DisplacementLen)) != 0x00u)
+            if((l_au8DataBuf[j] & (uint8)(0x03u << l_u8DisplacementLen)) != 0x00u)
             {
                 l_u8ChipShortFlag++;
                 if(sTle941xy_u8HbOutSts[u8Group][j][k + 4u] == TLE941XY_OUT_STATUS_LS)
                 {
-                    sTle941xy_atDiagResult[u8Group][j][k + 4u].eShort2Vcc = PFM_DDS_POS;
+                    sTle941xy_atDiagResult[u8Group][j][k + 4u].Short2Vcc = PFM_DDS_POS;
                 }
                 else
                 {
-                    sTle941xy_atDiagResult[u8Group][j][k + 4u].eShort2Gnd = PFM_DDS_POS;
+                    sTle941xy_atDiagResult[u8Group][j][k + 4u].Short2Gnd = PFM_DDS_POS;
                 }
             }
             else
             {
-                sTle941xy_atDiagResult[u8Group][j][k + 4u].eShort2Vcc = PFM_DDS_NEG;
-                sTle941xy_atDiagResult[u8Group][j][k + 4u].eShort2Gnd = PFM_DDS_NEG;
+                sTle941xy_atDiagResult[u8Group][j][k + 4u].Short2Vcc = PFM_DDS_NEG;
+                sTle941xy_atDiagResult[u8Group][j][k + 4u].Short2Gnd = PFM_DDS_NEG;
             }
         }
     }
-    if(l_u8ChipShortFlag > 0u)
+    if((l_u8ChipShortFlag > 0u) && (sTle941xy_abFrameLost[u8Group] == FALSE))
     {
         Tle941xy_Recovery(u8Group,l_au8RegBuf);
     }
@@ -463,38 +757,41 @@ static void Tle941xy_ShortDiagnostic(uint8 u8Group)
         l_au8RegBuf[j] = TLE941XY_SYS_DIAG_4;
     }
     Tle941xy_ReadReg(u8Group,l_au8RegBuf,l_au8DataBuf);
-    sTle941xy_atRegData[u8Group][j].SYS_DIAG_4 = l_au8DataBuf[j];
     for(j = 0u;j < l_u8ChipNum;j++)
     {
-        for(j = 0u;k < 4u;k++)
+        sTle941xy_atRegData[u8Group][j].SYS_DIAG_4 = l_au8DataBuf[j];
+    }
+    for(j = 0u;j < l_u8ChipNum;j++)
+    {
+        for(k = 0u;k < 4u;k++)
         {
             l_u8DisplacementLen = (uint8)(k * 2u);
-            if((l_au8RegBuf[j] && (0x03u << l_u8DisplacementLen)) != 0x00u)
+            if((l_au8DataBuf[j] & (uint8)(0x03u << l_u8DisplacementLen)) != 0x00u)
             {
                 l_u8ChipShortFlag++;
                 if(sTle941xy_u8HbOutSts[u8Group][j][k + 8u] == TLE941XY_OUT_STATUS_LS)
                 {
-                    sTle941xy_atDiagResult[u8Group][j][k + 8u].eShort2Vcc = PFM_DDS_POS;
+                    sTle941xy_atDiagResult[u8Group][j][k + 8u].Short2Vcc = PFM_DDS_POS;
                 }
                 else
                 {
-                    sTle941xy_atDiagResult[u8Group][j][k + 8u].eShort2Gnd = PFM_DDS_POS;
+                    sTle941xy_atDiagResult[u8Group][j][k + 8u].Short2Gnd = PFM_DDS_POS;
                 }
             }
             else
             {
-                sTle941xy_atDiagResult[u8Group][j][k + 8u].eShort2Vcc = PFM_DDS_NEG;
-                sTle941xy_atDiagResult[u8Group][j][k + 8u].eShort2Gnd = PFM_DDS_NEG;
+                sTle941xy_atDiagResult[u8Group][j][k + 8u].Short2Vcc = PFM_DDS_NEG;
+                sTle941xy_atDiagResult[u8Group][j][k + 8u].Short2Gnd = PFM_DDS_NEG;
             }
         }
-        if(l_u8ChipShortFlag > 0u)
-        {
-            Tle941xy_Recovery(u8Group,l_au8RegBuf);
-        }
-        else
-        {
-            
-        }
+    }
+    if((l_u8ChipShortFlag > 0u) && (sTle941xy_abFrameLost[u8Group] == FALSE))
+    {
+        Tle941xy_Recovery(u8Group,l_au8RegBuf);
+    }
+    else
+    {
+        
     }
 #endif
 }
@@ -508,6 +805,163 @@ static void Tle941xy_Recovery(uint8 u8GroupId,uint8* pu8RegBuf)
     Tle941xy_WriteReg(u8GroupId,pu8RegBuf,l_au8DataBuf);
 }
 
+#if(TLE941XY_DERATE_EN == STD_ON)
+/****************************************************************************************
+| NAME:    Tle941xy_GlobalDiagnostic
+| CALLED BY:     Tle941xy_DiagJob
+| PRECONDITIONS:     NA
+| INPUT PARAMETERS:    uint8 u8Group
+| RETURN VALUE:     TRUE: the thermal latches of SYS_DIAG_1 have to be cleared
+| DESCRIPTION:      read SYS_DIAG_1 of all chips in one frame and update the thermal
+|                   derating. The warning bits are latched; the caller clears them
+|                   after the diagnostic job, see Tle941xy_UpdateDerate for when.
+****************************************************************************************/
+static boolean Tle941xy_GlobalDiagnostic(uint8 u8Group)
+{
+    uint8 j;
+    uint8 l_au8RegBuf[TLE941XY_CHIP_MAX] = {0};
+    uint8 l_au8DataBuf[TLE941XY_CHIP_MAX] = {0};
+    uint8 l_u8ChipNum;
+    boolean l_bClear = FALSE;
+
+    l_u8ChipNum = sTle941xy_au8ChipNum[u8Group];
+    for(j = 0u;j < l_u8ChipNum;j++)
+    {
+        l_au8RegBuf[j] = TLE941XY_SYS_DIAG_1;
+    }
+    Tle941xy_ReadReg(u8Group,l_au8RegBuf,l_au8DataBuf);
+    if(sTle941xy_abFrameLost[u8Group] == FALSE)
+    {
+        for(j = 0u;j < l_u8ChipNum;j++)
+        {
+            sTle941xy_atRegData[u8Group][j].SYS_DIAG_1 = l_au8DataBuf[j];
+            if(Tle941xy_UpdateDerate(u8Group,j,l_au8DataBuf[j]) == TRUE)
+            {
+                l_bClear = TRUE;
+            }
+            else
+            {
+                /* nothing to do */
+            }
+        }
+    }
+    else
+    {
+        /* status unknown: keep the derating level */
+    }
+    return l_bClear;
+}
+
+/****************************************************************************************
+| NAME:    Tle941xy_ClearGlobalDiag
+| CALLED BY:     Tle941xy_DiagJob
+| PRECONDITIONS:     SYS_DIAG_1..7 of the cycle evaluated
+| INPUT PARAMETERS:    uint8 u8Group
+| RETURN VALUE:     void
+| DESCRIPTION:      clear SYS_DIAG_1 of all chips. The clear resets all latches of the
+|                   register (NPOR, VS_UV, VS_OV, SPI_ERR too), their value of the
+|                   cycle is kept in the register image.
+****************************************************************************************/
+static void Tle941xy_ClearGlobalDiag(uint8 u8Group)
+{
+    uint8 j;
+    uint8 l_au8RegBuf[TLE941XY_CHIP_MAX] = {0};
+
+    for(j = 0u;j < sTle941xy_au8ChipNum[u8Group];j++)
+    {
+        l_au8RegBuf[j] = TLE941XY_SYS_DIAG_1;
+    }
+    Tle941xy_Recovery(u8Group,l_au8RegBuf);
+}
+
+/****************************************************************************************
+| NAME:    Tle941xy_UpdateDerate
+| CALLED BY:     Tle941xy_GlobalDiagnostic
+| PRECONDITIONS:     NA
+| INPUT PARAMETERS:    uint8 u8Group, uint8 u8Chip, uint8 u8SysDiag1
+| RETURN VALUE:     TRUE: the warning latches have to be cleared
+| DESCRIPTION:      a pre-warning for TLE941XY_DERATE_QUAL_CNT cycles raises the level by
+|                   one, TLE941XY_DERATE_HEAL_CNT cycles without it lower it by one.
+|                   A thermal shutdown goes to the highest level at once, so the
+|                   outputs restart derated when the chip has cooled down.
+|                   The latches are cleared when a warning raised the level, so the
+|                   next qualification sees whether it is still present. At the
+|                   highest level every completed qualification clears them, else
+|                   a latched warning would block the healing.
+****************************************************************************************/
+static boolean Tle941xy_UpdateDerate(uint8 u8Group, uint8 u8Chip, uint8 u8SysDiag1)
+{
+    uint8 l_u8Lvl;
+    boolean l_bClear = FALSE;
+
+    l_u8Lvl = sTle941xy_au8DerateLvl[u8Group][u8Chip];
+    if(((u8SysDiag1 & TLE941XY_SYS_DIAG_1_TSD) != 0u) && (l_u8Lvl < (uint8)(TLE941XY_DERATE_LVL_MAX - 1u)))
+    {
+        l_u8Lvl = (uint8)(TLE941XY_DERATE_LVL_MAX - 1u);
+        sTle941xy_au8DerateQualCnt[u8Group][u8Chip] = 0u;
+        sTle941xy_au8DerateHealCnt[u8Group][u8Chip] = 0u;
+    }
+    else if((u8SysDiag1 & (TLE941XY_SYS_DIAG_1_TPW | TLE941XY_SYS_DIAG_1_TSD)) != 0u)
+    {
+        sTle941xy_au8DerateHealCnt[u8Group][u8Chip] = 0u;
+        sTle941xy_au8DerateQualCnt[u8Group][u8Chip]++;
+        if(sTle941xy_au8DerateQualCnt[u8Group][u8Chip] >= TLE941XY_DERATE_QUAL_CNT)
+        {
+            sTle941xy_au8DerateQualCnt[u8Group][u8Chip] = 0u;
+            if(l_u8Lvl < (uint8)(TLE941XY_DERATE_LVL_MAX - 1u))
+            {
+                l_u8Lvl++;
+            }
+            else
+            {
+                l_bClear = TRUE;
+            }
+        }
+        else
+        {
+            /* nothing to do */
+        }
+    }
+    else if(l_u8Lvl > TLE941XY_DERATE_LVL_0)
+    {
+        sTle941xy_au8DerateQualCnt[u8Group][u8Chip] = 0u;
+        sTle941xy_au8DerateHealCnt[u8Group][u8Chip]++;
+        if(sTle941xy_au8DerateHealCnt[u8Group][u8Chip] >= TLE941XY_DERATE_HEAL_CNT)
+        {
+            sTle941xy_au8DerateHealCnt[u8Group][u8Chip] = 0u;
+            l_u8Lvl--;
+        }
+        else
+        {
+            /* nothing to do */
+        }
+    }
+    else
+    {
+        sTle941xy_au8DerateQualCnt[u8Group][u8Chip] = 0u;
+    }
+
+    if(l_u8Lvl != sTle941xy_au8DerateLvl[u8Group][u8Chip])
+    {
+        if(l_u8Lvl > sTle941xy_au8DerateLvl[u8Group][u8Chip])
+        {
+            l_bClear = TRUE;
+        }
+        else
+        {
+            /* healed: no warning latched */
+        }
+        sTle941xy_au8DerateLvl[u8Group][u8Chip] = l_u8Lvl;
+        sTle941xy_abOutDirty[u8Group] = TRUE;
+    }
+    else
+    {
+        /* nothing to do */
+    }
+    return l_bClear;
+}
+#endif
+
 /****************************************************************************************
 | NAME:    Tle941xy_OLDiagnostic
 | CALLED BY:
@@ -526,26 +980,29 @@ static void Tle941xy_OLDiagnostic(uint8 u8Group)
     uint8 l_u8ChipNum;
     uint8 l_u8DisplacementLen;
 
-    l_u8ChipNum = *cTle941xy_atGroupCfg[u8Group].pu8ChipNum;
+    l_u8ChipNum = sTle941xy_au8ChipNum[u8Group];
     /***OUT1-OUT4**/
     for(j = 0u;j < l_u8ChipNum;j++)
     {
         l_au8RegBuf[j] = TLE941XY_SYS_DIAG_5;
     }
     Tle941xy_ReadReg(u8Group,l_au8RegBuf,l_au8DataBuf);
-    sTle941xy_atRegData[u8Group][j].SYS_DIAG_5 = l_au8DataBuf[j];
     for(j = 0u;j < l_u8ChipNum;j++)
     {
-        for(j = 0u;k < 4u;k++)
+        sTle941xy_atRegData[u8Group][j].SYS_DIAG_5 = l_au8DataBuf[j];
+    }
+    for(j = 0u;j < l_u8ChipNum;j++)
+    {
+        for(k = 0u;k < 4u;k++)
         {
             l_u8DisplacementLen = (uint8)(k * 2u);
-            if((l_au8RegBuf[j] && (0x03u << l_u8DisplacementLen)) != 0x00u)
+            if((l_au8DataBuf[j] & (uint8)(0x03u << l_u8DisplacementLen)) != 0x00u)
             { 
-                sTle941xy_atDiagResult[u8Group][j][k].eOpenLoad = PFM_DDS_POS; 
+                sTle941xy_atDiagResult[u8Group][j][k].OpenLoad = PFM_DDS_POS; 
             }
             else
             {
-                sTle941xy_atDiagResult[u8Group][j][k].eOpenLoad = PFM_DDS_NEG;
+                sTle941xy_atDiagResult[u8Group][j][k].OpenLoad = PFM_DDS_NEG;
             }
         }
     }
@@ -557,19 +1014,22 @@ static void Tle941xy_OLDiagnostic(uint8 u8Group)
         l_au8RegBuf[j] = TLE941XY_SYS_DIAG_6;
     }
     Tle941xy_ReadReg(u8Group,l_au8RegBuf,l_au8DataBuf);
-    sTle941xy_atRegData[u8Group][j].SYS_DIAG_6 = l_au8DataBuf[j];
     for(j = 0u;j < l_u8ChipNum;j++)
     {
-        for(j = 0u;k < 4u;k++)
-        {
-            l_u8DisplacementLen = (uint8)(k * 2u);
-            if((l_au8RegBuf[j] && (0x03u << l_u8DisplacementLen)) != 0x00u)
+        sTle941xy_atRegData[u8Group][j].SYS_DIAG_6 = l_au8DataBuf[j];
+    }
+    for(j = 0u;j < l_u8ChipNum;j++)
+    {
+        for(k = 0u;k < 4u;k++)
+        {
+            l_u8DisplacementLen = (uint8)(k * 2u);
+            if((l_au8DataBuf[j] & (uint8)(0x03u << l_u8DisplacementLen)) != 0x00u)
             { 
-                sTle941xy_atDiagResult[u8Group][j][k + 4u].eOpenLoad = PFM_DDS_POS; 
+                sTle941xy_atDiagResult[u8Group][j][k + 4u].OpenLoad = PFM_DDS_POS; 
             }
             else
             {
-                sTle941xy_atDiagResult[u8Group][j][k + 4u].eOpenLoad = PFM_DDS_NEG;
+                sTle941xy_atDiagResult[u8Group][j][k + 4u].OpenLoad = PFM_DDS_NEG;
             }
         }
     }
@@ -581,56 +1041,530 @@ static void Tle941xy_OLDiagnostic(uint8 u8Group)
         l_au8RegBuf[j] = TLE941XY_SYS_DIAG_7;
     }
     Tle941xy_ReadReg(u8Group,l_au8RegBuf,l_au8DataBuf);
-    sTle941xy_atRegData[u8Group][j].SYS_DIAG_7 = l_au8DataBuf[j];
     for(j = 0u;j < l_u8ChipNum;j++)
     {
-        for(j = 0u;k < 4u;k++)
+        sTle941xy_atRegData[u8Group][j].SYS_DIAG_7 = l_au8DataBuf[j];
+    }
+    for(j = 0u;j < l_u8ChipNum;j++)
+    {
+        for(k = 0u;k < 4u;k++)
         {
             l_u8DisplacementLen = (uint8)(k * 2u);
-            if((l_au8RegBuf[j] && (0x03u << l_u8DisplacementLen)) != 0x00u)
+            if((l_au8DataBuf[j] & (uint8)(0x03u << l_u8DisplacementLen)) != 0x00u)
             { 
-                sTle941xy_atDiagResult[u8Group][j][k + 8u].eOpenLoad = PFM_DDS_POS; 
+                sTle941xy_atDiagResult[u8Group][j][k + 8u].OpenLoad = PFM_DDS_POS; 
             }
             else
             {
-                sTle941xy_atDiagResult[u8Group][j][k + 8u].eOpenLoad = PFM_DDS_NEG;
+                sTle941xy_atDiagResult[u8Group][j][k + 8u].OpenLoad = PFM_DDS_NEG;
             }
         }
     }
 #endif
 }
 
-void Tle941xy_Init(void)
+/****************************************************************************************
+| NAME:    Tle941xy_ReportDiag
+| CALLED BY:     Tle941xy_MainFunction
+| PRECONDITIONS:     diagnostic registers of the group read in this cycle
+| INPUT PARAMETERS:    uint8 u8Group
+| RETURN VALUE:     void
+| DESCRIPTION:      report the diagnostic result of every channel to Pfm, the PID comes
+|                   from the IO channel registry, channels without a PID are skipped
+****************************************************************************************/
+static void Tle941xy_ReportDiag(uint8 u8Group)
 {
-    uint8 i;
     uint8 j;
+    uint8 k;
+    uint8 l_u8ChipNum;
+    PFM_PhysicalId_e l_ePid;
+
+    l_u8ChipNum = sTle941xy_au8ChipNum[u8Group];
+    for(j = 0u;j < l_u8ChipNum;j++)
+    {
+        for(k = 0u;k < TLE941XY_CHANNEL_MAX;k++)
+        {
+            l_ePid = IoChnReg_Tle941xyPid(u8Group, j, k);
+            if(l_ePid != PFM_PID_DUMMTY)
+            {
+                Pfm_DefectReport(l_ePid, sTle941xy_atDiagResult[u8Group][j][k].OpenLoad,
+                    sTle941xy_atDiagResult[u8Group][j][k].Short2Vcc, sTle941xy_atDiagResult[u8Group][j][k].Short2Gnd);
+            }
+            else
+            {
+                /* nothing to do */
+            }
+        }
+    }
+}
+
+/****************************************************************************************
+| NAME:    Tle941xy_DiagJob
+| CALLED BY:     Tle941xy_Submit, diagnostic class
+| PRECONDITIONS:     NA
+| INPUT PARAMETERS:    uint8 u8Group
+| RETURN VALUE:     void
+| DESCRIPTION:      read the diagnostic registers of the group, report them when no frame was lost
+****************************************************************************************/
+static void Tle941xy_DiagJob(uint8 u8Group)
+{
+#if(TLE941XY_DERATE_EN == STD_ON)
+    boolean l_bClear;
+#endif
+
+    if((sTle941xy_aeInitStep[u8Group] == TLE941XY_INIT_DONE) && (sTle941xy_ePwrState == OBDPWR_STATE_RUN))
+    {
+        sTle941xy_abFrameLost[u8Group] = FALSE;
+#if(TLE941XY_DERATE_EN == STD_ON)
+        l_bClear = Tle941xy_GlobalDiagnostic(u8Group);
+#endif
+        Tle941xy_ShortDiagnostic(u8Group);
+        Tle941xy_OLDiagnostic(u8Group);
+        if(sTle941xy_abFrameLost[u8Group] == FALSE)
+        {
+            Tle941xy_ReportDiag(u8Group);
+        }
+        else
+        {
+            /* diagnostic frame lost: no report, Pfm keeps the last qualification */
+        }
+#if(TLE941XY_DERATE_EN == STD_ON)
+        /* the load error bit of SYS_DIAG_1 mirrors SYS_DIAG_2..7, clear after they are read */
+        if(l_bClear == TRUE)
+        {
+            Tle941xy_ClearGlobalDiag(u8Group);
+        }
+        else
+        {
+            /* nothing to do */
+        }
+#endif
+    }
+    else
+    {
+        /* power state changed since the request */
+    }
+}
+
+/****************************************************************************************
+| NAME:    Tle941xy_OutputJob
+| CALLED BY:     Tle941xy_Submit, output class
+| PRECONDITIONS:     NA
+| INPUT PARAMETERS:    uint8 u8Group
+| RETURN VALUE:     void
+| DESCRIPTION:      write the output image of the group, the freewheeling selection
+|                   before the outputs when it changed
+****************************************************************************************/
+static void Tle941xy_OutputJob(uint8 u8Group)
+{
+    if((sTle941xy_aeInitStep[u8Group] == TLE941XY_INIT_DONE) && (sTle941xy_ePwrState != OBDPWR_STATE_SLEEP))
+    {
+        /* cleared first: a change written while the job runs is not lost */
+        sTle941xy_abOutDirty[u8Group] = FALSE;
+        if(sTle941xy_abFwDirty[u8Group] == TRUE)
+        {
+            Tle941xy_SetFwOlReg(u8Group);
+        }
+        else
+        {
+            /* nothing to do */
+        }
+        Tle941xy_SetHbPwmDutyReg(u8Group);
+        Tle941xy_SetHbOutputReg(u8Group);
+    }
+    else
+    {
+        /* power state changed since the request */
+    }
+}
+
+/****************************************************************************************
+| NAME:    Tle941xy_ShutdownJob
+| CALLED BY:     Tle941xy_Submit, safety class
+| PRECONDITIONS:     output image of the group cleared
+| INPUT PARAMETERS:    uint8 u8Group
+| RETURN VALUE:     void
+| DESCRIPTION:      switch the outputs of the group off and put the chips to sleep
+****************************************************************************************/
+static void Tle941xy_ShutdownJob(uint8 u8Group)
+{
+    Tle941xy_SetHbOutputReg(u8Group);
+    Tle941xy_SetChipEnable(u8Group, STD_OFF);
+}
+
+/****************************************************************************************
+| NAME:    Tle941xy_OffJob
+| CALLED BY:     Tle941xy_Submit, safety class
+| PRECONDITIONS:     output image of the group cleared
+| INPUT PARAMETERS:    uint8 u8Group
+| RETURN VALUE:     void
+| DESCRIPTION:      switch the outputs of the group off, the chips stay enabled
+****************************************************************************************/
+static void Tle941xy_OffJob(uint8 u8Group)
+{
+    Tle941xy_SetHbOutputReg(u8Group);
+}
+
+/****************************************************************************************
+| NAME:    Tle941xy_RestoreJob
+| CALLED BY:     Tle941xy_Submit, output class
+| PRECONDITIONS:     chips enabled for at least one main cycle after sleep
+| INPUT PARAMETERS:    uint8 u8Group
+| RETURN VALUE:     void
+| DESCRIPTION:      restore the cached registers of a woken group and release it to the
+|                   cyclic jobs
+****************************************************************************************/
+static void Tle941xy_RestoreJob(uint8 u8Group)
+{
+    if((sTle941xy_aeInitStep[u8Group] == TLE941XY_INIT_RESTORE) && (sTle941xy_ePwrState != OBDPWR_STATE_SLEEP))
+    {
+        Tle941xy_RestoreReg(u8Group);
+        sTle941xy_abWakeRestore[u8Group] = FALSE;
+        sTle941xy_aeInitStep[u8Group] = TLE941XY_INIT_DONE;
+    }
+    else
+    {
+        /* power state changed since the request */
+    }
+}
+
+/****************************************************************************************
+| NAME:    Tle941xy_Submit
+| CALLED BY:     Tle941xy_MainFunction, Tle941xy_InitMainFunction, Tle941xy_SetPowerState,
+|                Tle941xy_InitGroupStep, Tle941xy_DeInit, output interface
+| PRECONDITIONS:     NA
+| INPUT PARAMETERS:    uint8 u8Group, priority class, job
+| RETURN VALUE:     void
+| DESCRIPTION:      hand the job to the arbiter of the group's SPI unit, without arbitration
+|                   the job is run at once
+****************************************************************************************/
+static void Tle941xy_Submit(uint8 u8Group, SpiArb_PrioType ePrio, SpiArb_JobFuncType pfJob)
+{
+#if(TLE941XY_SPIARB_EN == STD_ON)
+    (void)SpiArb_Request(cTle941xy_atGroupCfg[u8Group].u8SpiBus, ePrio, pfJob, u8Group);
+#else
+    (void)ePrio;
+    pfJob(u8Group);
+#endif
+}
+
+/****************************************************************************************
+| NAME:    Tle941xy_SelectVariant
+| CALLED BY:     Tle941xy_Init
+| PRECONDITIONS:     IoChnReg_Init done
+| INPUT PARAMETERS:    void
+| RETURN VALUE:     void
+| DESCRIPTION:      take the active group and chip numbers from the variant record,
+|                   limited to the chips the board configuration provides
+****************************************************************************************/
+static void Tle941xy_SelectVariant(void)
+{
+    uint8 i;
     uint8 l_u8ChipNum;
 
+    sTle941xy_u8GroupNum = IoChnReg_GetGroupNum(IOCHNREG_DRV_TLE941XY);
+    if(sTle941xy_u8GroupNum > (uint8)TLE941XY_GROUP_MAX)
+    {
+        sTle941xy_u8GroupNum = (uint8)TLE941XY_GROUP_MAX;
+    }
+    else
+    {
+        /* nothing to do */
+    }
+    for(i = 0u;i < TLE941XY_GROUP_MAX;i++)
+    {
+        l_u8ChipNum = 0u;
+        if(i < sTle941xy_u8GroupNum)
+        {
+            l_u8ChipNum = IoChnReg_GetChipNum(IOCHNREG_DRV_TLE941XY, i);
+            if(l_u8ChipNum > *cTle941xy_atGroupCfg[i].pu8ChipNum)
+            {
+                l_u8ChipNum = *cTle941xy_atGroupCfg[i].pu8ChipNum;
+            }
+            else
+            {
+                /* nothing to do */
+            }
+        }
+        else
+        {
+            /* group not present in this variant */
+        }
+        sTle941xy_au8ChipNum[i] = l_u8ChipNum;
+    }
+}
+
+/****************************************************************************************
+| NAME:    Tle941xy_InitGroupStep
+| CALLED BY:     Tle941xy_Init, Tle941xy_InitJob
+| PRECONDITIONS:     NA
+| INPUT PARAMETERS:    uint8 u8Group
+| RETURN VALUE:     void
+| DESCRIPTION:      run the current init step of a group and advance to the next one.
+|                   After a wake up the chips are not configured again, the step after
+|                   the enable queues the restore of the cached registers instead.
+****************************************************************************************/
+static void Tle941xy_InitGroupStep(uint8 u8Group)
+{
+    switch(sTle941xy_aeInitStep[u8Group])
+    {
+        case TLE941XY_INIT_ENABLE:
+            /* EN high, the chips get one call period to wake up */
+            Tle941xy_SetChipEnable(u8Group, STD_ON);
+            break;
+        case TLE941XY_INIT_READ_ID:
+            if(sTle941xy_abWakeRestore[u8Group] == TRUE)
+            {
+                sTle941xy_aeInitStep[u8Group] = TLE941XY_INIT_RESTORE;
+                Tle941xy_Submit(u8Group, SPIARB_PRIO_OUTPUT, &Tle941xy_RestoreJob);
+            }
+            else
+            {
+                Tle941xy_ReadDeviceIdReg(u8Group);
+            }
+            break;
+        case TLE941XY_INIT_HB_MODE:
+            Tle941xy_SetHbModeReg(u8Group);
+            break;
+        case TLE941XY_INIT_FW_OL:
+            Tle941xy_SetFwOlReg(u8Group);
+            break;
+        case TLE941XY_INIT_PWM_FREQ:
+            Tle941xy_SetFmPwmFreqReg(u8Group);
+            break;
+        case TLE941XY_INIT_HB_OUTPUT:
+            Tle941xy_SetHbOutputReg(u8Group);
+            break;
+        case TLE941XY_INIT_RESTORE:
+            /* job still queued or dropped by a full queue, the arbiter drops duplicates */
+            Tle941xy_Submit(u8Group, SPIARB_PRIO_OUTPUT, &Tle941xy_RestoreJob);
+            break;
+        default:
+            /* TLE941XY_INIT_DONE, nothing to do */
+            break;
+    }
+    if(sTle941xy_aeInitStep[u8Group] < TLE941XY_INIT_DONE)
+    {
+        sTle941xy_aeInitStep[u8Group] = (Tle941xy_InitStepType)((uint8)sTle941xy_aeInitStep[u8Group] + 1u);
+    }
+    else
+    {
+        /* nothing to do */
+    }
+}
+
+/****************************************************************************************
+| NAME:    Tle941xy_InitJob
+| CALLED BY:     Tle941xy_Submit, output class
+| PRECONDITIONS:     NA
+| INPUT PARAMETERS:    uint8 u8Group
+| RETURN VALUE:     void
+| DESCRIPTION:      run TLE941XY_INIT_STEPS_PER_CALL init steps of the group. A woken group
+|                   runs one step per job: EN high, then the restore is queued by the
+|                   next job once the chips had a cycle to wake up.
+****************************************************************************************/
+static void Tle941xy_InitJob(uint8 u8Group)
+{
+    uint8 n;
+
+    if(sTle941xy_ePwrState == OBDPWR_STATE_SLEEP)
+    {
+        /* power state changed since the request */
+    }
+    else if(sTle941xy_abWakeRestore[u8Group] == TRUE)
+    {
+        Tle941xy_InitGroupStep(u8Group);
+    }
+    else
+    {
+        for(n = 0u;(n < TLE941XY_INIT_STEPS_PER_CALL) && (sTle941xy_aeInitStep[u8Group] != TLE941XY_INIT_DONE);n++)
+        {
+            Tle941xy_InitGroupStep(u8Group);
+        }
+    }
+}
+
+void Tle941xy_Init(void)
+{
+    uint8 i;
+
+    Tle941xy_SelectVariant();
     (void)memset(sTle941xy_u8HbOutSts,0u,sizeof(sTle941xy_u8HbOutSts));
+    (void)memcpy(sTle941xy_abFwSel,cTle941xy_abChipFreeWheelingCfg,sizeof(sTle941xy_abFwSel));
+    (void)memset(sTle941xy_abFwDirty,0u,sizeof(sTle941xy_abFwDirty));
+#if(TLE941XY_DERATE_EN == STD_ON)
+    (void)memset(sTle941xy_au8DerateLvl,0u,sizeof(sTle941xy_au8DerateLvl));
+    (void)memset(sTle941xy_au8DerateQualCnt,0u,sizeof(sTle941xy_au8DerateQualCnt));
+    (void)memset(sTle941xy_au8DerateHealCnt,0u,sizeof(sTle941xy_au8DerateHealCnt));
+#endif
     for(i = 0u;i < TLE941XY_GROUP_MAX;i++)
     {
-        l_u8ChipNum = *cTle941xy_atGroupCfg[i].pu8ChipNum;
-        for(j = 0u;j < l_u8ChipNum;j++)
+        sTle941xy_aeInitStep[i] = TLE941XY_INIT_ENABLE;
+        sTle941xy_abWakeRestore[i] = FALSE;
+    }
+#if(TLE941XY_INCREMENTAL_INIT == STD_OFF)
+    for(i = 0u;i < sTle941xy_u8GroupNum;i++)
+    {
+        while(sTle941xy_aeInitStep[i] != TLE941XY_INIT_DONE)
+        {
+            Tle941xy_InitGroupStep(i);
+        }
+    }
+#endif
+}
+
+/****************************************************************************************
+| NAME:    Tle941xy_InitMainFunction
+| CALLED BY:     1ms or background task, until all groups are ready
+| PRECONDITIONS:     Tle941xy_Init done
+| INPUT PARAMETERS:    void
+| RETURN VALUE:     void
+| DESCRIPTION:      queue the init job of every group still in init, each job advances its
+|                   group by TLE941XY_INIT_STEPS_PER_CALL steps, so no group waits for the
+|                   others to finish. The groups share one SPI bus (u8SpiBus, all on
+|                   SPIARB_BUS_0 on this board), the arbiter sends their frames one after
+|                   the other between the output jobs of the ready groups.
+****************************************************************************************/
+void Tle941xy_InitMainFunction(void)
+{
+    uint8 i;
+
+    if(sTle941xy_ePwrState != OBDPWR_STATE_SLEEP)
+    {
+        for(i = 0u;i < sTle941xy_u8GroupNum;i++)
+        {
+            if((sTle941xy_aeInitStep[i] != TLE941XY_INIT_DONE) && (sTle941xy_abWakeRestore[i] == FALSE))
+            {
+                /* the arbiter drops the request while the job of the group is still queued */
+                Tle941xy_Submit(i, SPIARB_PRIO_OUTPUT, &Tle941xy_InitJob);
+            }
+            else
+            {
+                /* nothing to do */
+            }
+        }
+    }
+    else
+    {
+        /* chips are off, init continues after wake up */
+    }
+}
+
+boolean Tle941xy_IsGroupReady(uint8 u8Group)
+{
+    boolean l_bReady = FALSE;
+
+    if((u8Group < sTle941xy_u8GroupNum) && (sTle941xy_aeInitStep[u8Group] == TLE941XY_INIT_DONE))
+    {
+        l_bReady = TRUE;
+    }
+    else
+    {
+        /* nothing to do */
+    }
+    return l_bReady;
+}
+
+/****************************************************************************************
+| NAME:    Tle941xy_IsOutputDue
+| CALLED BY:     Tle941xy_MainFunction
+| PRECONDITIONS:     NA
+| INPUT PARAMETERS:    uint8 u8Group
+| RETURN VALUE:     TRUE: queue the output job of the group in this cycle
+| DESCRIPTION:      without event mode the output image is written every cycle. In event
+|                   mode only a changed image is written, the write interface has queued
+|                   it already, plus a slow refresh of the output registers.
+****************************************************************************************/
+static boolean Tle941xy_IsOutputDue(uint8 u8Group)
+{
+    boolean l_bDue = TRUE;
+
+#if(TLE941XY_EVENT_OUTPUT_EN == STD_ON)
+    l_bDue = sTle941xy_abOutDirty[u8Group];
+    sTle941xy_au8OutRefreshCnt[u8Group]++;
+    if(sTle941xy_au8OutRefreshCnt[u8Group] >= TLE941XY_OUTPUT_REFRESH_CYCLES)
+    {
+        sTle941xy_au8OutRefreshCnt[u8Group] = 0u;
+        l_bDue = TRUE;
+    }
+    else
+    {
+        /* nothing to do */
+    }
+#else
+    (void)u8Group;
+#endif
+    return l_bDue;
+}
+
+#if((TLE941XY_EVENT_OUTPUT_EN == STD_ON) && (TLE941XY_SPIARB_EN == STD_OFF))
+/****************************************************************************************
+| NAME:    Tle941xy_OutputMainFunction
+| CALLED BY:     output task activated through TLE941XY_OUTPUT_TRIGGER, same priority
+|                as Tle941xy_MainFunction
+| PRECONDITIONS:     Tle941xy_Init done
+| INPUT PARAMETERS:    void
+| RETURN VALUE:     void
+| DESCRIPTION:      without the arbiter the write interface cannot run SPI jobs in the
+|                   caller, the changed output images are written here instead.
+|                   Tle941xy_MainFunction keeps writing them as fallback.
+****************************************************************************************/
+void Tle941xy_OutputMainFunction(void)
+{
+    uint8 i;
+
+    for(i = 0u;i < sTle941xy_u8GroupNum;i++)
+    {
+        if(sTle941xy_abOutDirty[i] == TRUE)
+        {
+            Tle941xy_OutputJob(i);
+        }
+        else
         {
-            Dio_WriteChannel(cTle941xy_atChipCfg[i][j].u8ChipEnPin, STD_ON);
+            /* nothing changed */
         }
-        Tle941xy_ReadDeviceIdReg(i);
-        Tle941xy_SetHbModeReg(i);
-        Tle941xy_SetFwOlReg(i);
-        Tle941xy_SetFmPwmFreqReg(i);
-        Tle941xy_SetHbOutputReg(i);
     }
 }
+#endif
 
 void Tle941xy_MainFunction(void)
 {
     uint8 i;
-    for(i = 0u;i < TLE941XY_GROUP_MAX;i++)
+    for(i = 0u;i < sTle941xy_u8GroupNum;i++)
     {
-        Tle941xy_ShortDiagnostic(i);
-        Tle941xy_OLDiagnostic(i);
-        Tle941xy_SetHbPwmDutyReg(i);
-        Tle941xy_SetHbOutputReg(i);
+        if(sTle941xy_aeInitStep[i] != TLE941XY_INIT_DONE)
+        {
+            if((sTle941xy_abWakeRestore[i] == TRUE) && (sTle941xy_ePwrState != OBDPWR_STATE_SLEEP))
+            {
+                /* one step per job: EN high, the chips wake up until the next job queues the restore */
+                Tle941xy_Submit(i, SPIARB_PRIO_OUTPUT, &Tle941xy_InitJob);
+            }
+            else
+            {
+                /* group still in init, see Tle941xy_InitMainFunction */
+            }
+        }
+        else if(sTle941xy_ePwrState == OBDPWR_STATE_RUN)
+        {
+            Tle941xy_Submit(i, SPIARB_PRIO_DIAG, &Tle941xy_DiagJob);
+            if(Tle941xy_IsOutputDue(i) == TRUE)
+            {
+                Tle941xy_Submit(i, SPIARB_PRIO_OUTPUT, &Tle941xy_OutputJob);
+            }
+            else
+            {
+                /* output image unchanged, no SPI traffic for it */
+            }
+        }
+        else if((sTle941xy_ePwrState == OBDPWR_STATE_LOWPOWER) && (sTle941xy_abOutDirty[i] == TRUE))
+        {
+            /* no diagnostics in low power, only flush changed outputs */
+            Tle941xy_Submit(i, SPIARB_PRIO_OUTPUT, &Tle941xy_OutputJob);
+        }
+        else
+        {
+            /* sleep or nothing changed: no SPI traffic */
+        }
     }
 }
 
@@ -638,14 +1572,137 @@ void Tle941xy_DeInit(void)
 {
     uint8 i;
     (void)memset(sTle941xy_u8HbOutSts,0u,sizeof(sTle941xy_u8HbOutSts));
-    for(i = 0u;i < TLE941XY_GROUP_MAX;i++)
+    for(i = 0u;i < sTle941xy_u8GroupNum;i++)
+    {
+        Tle941xy_Submit(i, SPIARB_PRIO_SAFETY, &Tle941xy_OffJob);
+    }
+}
+
+/****************************************************************************************
+| NAME:    Tle941xy_SetChipEnable
+| CALLED BY:     Tle941xy_InitGroupStep, Tle941xy_ShutdownJob
+| PRECONDITIONS:     NA
+| INPUT PARAMETERS:    uint8 u8Group, uint8 u8Level
+| RETURN VALUE:     void
+| DESCRIPTION:      drive the EN pin of all chips in a group, EN low puts the chip to sleep
+****************************************************************************************/
+static void Tle941xy_SetChipEnable(uint8 u8Group, uint8 u8Level)
+{
+    uint8 j;
+    uint8 l_u8ChipNum;
+
+    l_u8ChipNum = sTle941xy_au8ChipNum[u8Group];
+    for(j = 0u;j < l_u8ChipNum;j++)
+    {
+        Dio_WriteChannel(cTle941xy_atChipCfg[u8Group][j].u8ChipEnPin, u8Level);
+        /* the registers are reset across sleep, nothing to echo until written again */
+        sTle941xy_au32EchoValid[u8Group][j] = 0u;
+    }
+}
+
+/****************************************************************************************
+| NAME:    Tle941xy_WriteCacheReg
+| CALLED BY:     Tle941xy_RestoreReg
+| PRECONDITIONS:     register image sTle941xy_atRegData is up to date
+| INPUT PARAMETERS:    uint8 u8Group, uint8 u8Reg, uint8 u8Offset (offset in Tle941xy_RegDataType)
+| RETURN VALUE:     void
+| DESCRIPTION:      write one control register of all chips from the cached image
+****************************************************************************************/
+static void Tle941xy_WriteCacheReg(uint8 u8Group, uint8 u8Reg, uint8 u8Offset)
+{
+    uint8 j;
+    uint8 l_au8RegBuf[TLE941XY_CHIP_MAX] = {0};
+    uint8 l_au8DataBuf[TLE941XY_CHIP_MAX] = {0};
+    uint8 l_u8ChipNum;
+
+    l_u8ChipNum = sTle941xy_au8ChipNum[u8Group];
+    for(j = 0u;j < l_u8ChipNum;j++)
+    {
+        l_au8RegBuf[j] = u8Reg;
+        l_au8DataBuf[j] = ((const uint8*)&sTle941xy_atRegData[u8Group][j])[u8Offset];
+    }
+    Tle941xy_WriteReg(u8Group,l_au8RegBuf,l_au8DataBuf);
+}
+
+/****************************************************************************************
+| NAME:    Tle941xy_RestoreReg
+| CALLED BY:     Tle941xy_RestoreJob
+| PRECONDITIONS:     chips enabled after sleep, register content lost
+| INPUT PARAMETERS:    uint8 u8Group
+| RETURN VALUE:     void
+| DESCRIPTION:      restore all control registers from the cached image without
+|                   re-reading the chips or re-evaluating the configuration
+****************************************************************************************/
+static void Tle941xy_RestoreReg(uint8 u8Group)
+{
+    Tle941xy_WriteCacheReg(u8Group, TLE941XY_HB_MODE_1_CTRL, (uint8)offsetof(Tle941xy_RegDataType, HB_MODE_1_CTRL));
+#if((TLE941XY_TLE94106_CHIP_EN == STD_ON)||(TLE941XY_TLE94108_CHIP_EN == STD_ON)||(TLE941XY_TLE94110_CHIP_EN == STD_ON)||(TLE941XY_TLE94112_CHIP_EN == STD_ON))
+    Tle941xy_WriteCacheReg(u8Group, TLE941XY_HB_MODE_2_CTRL, (uint8)offsetof(Tle941xy_RegDataType, HB_MODE_2_CTRL));
+#endif
+#if((TLE941XY_TLE94110_CHIP_EN == STD_ON)||(TLE941XY_TLE94112_CHIP_EN == STD_ON))
+    Tle941xy_WriteCacheReg(u8Group, TLE941XY_HB_MODE_3_CTRL, (uint8)offsetof(Tle941xy_RegDataType, HB_MODE_3_CTRL));
+#endif
+    /* FW_OL_CTRL/FW_CTRL from the freewheeling selection, it may have changed in sleep */
+    Tle941xy_SetFwOlReg(u8Group);
+    /* FM_CLK_CTRL and PWM_CH_FREQ_CTRL share the address */
+    Tle941xy_WriteCacheReg(u8Group, TLE941XY_PWM_CH_FREQ_CTRL, (uint8)offsetof(Tle941xy_RegDataType, PWM_CH_FREQ_CTRL));
+    /* duty cycles and outputs come from the current output image */
+    Tle941xy_SetHbPwmDutyReg(u8Group);
+    Tle941xy_SetHbOutputReg(u8Group);
+}
+
+/****************************************************************************************
+| NAME:    Tle941xy_SetPowerState
+| CALLED BY:     ObdPwr
+| PRECONDITIONS:     Tle941xy_Init done
+| INPUT PARAMETERS:    ObdPwr_StateType eState
+| RETURN VALUE:     void
+| DESCRIPTION:      RUN/LOWPOWER keep the chips enabled, SLEEP switches all outputs
+|                   off and drives EN low. Leaving SLEEP restarts the init sequence of the
+|                   group in restore mode, Tle941xy_MainFunction enables the chips and
+|                   restores the cached registers one cycle later through the arbiter.
+****************************************************************************************/
+void Tle941xy_SetPowerState(ObdPwr_StateType eState)
+{
+    uint8 i;
+
+    if(eState != sTle941xy_ePwrState)
     {
-        Tle941xy_SetHbOutputReg(i);
+        for(i = 0u;i < sTle941xy_u8GroupNum;i++)
+        {
+            if(eState == OBDPWR_STATE_SLEEP)
+            {
+                (void)memset(sTle941xy_u8HbOutSts[i],0u,sizeof(sTle941xy_u8HbOutSts[i]));
+                Tle941xy_Submit(i, SPIARB_PRIO_SAFETY, &Tle941xy_ShutdownJob);
+            }
+            else if((sTle941xy_ePwrState == OBDPWR_STATE_SLEEP) && (sTle941xy_aeInitStep[i] == TLE941XY_INIT_DONE))
+            {
+                sTle941xy_abWakeRestore[i] = TRUE;
+                sTle941xy_aeInitStep[i] = TLE941XY_INIT_ENABLE;
+            }
+            else if(sTle941xy_ePwrState == OBDPWR_STATE_SLEEP)
+            {
+                /* init or restore was interrupted by sleep, start it over */
+                sTle941xy_aeInitStep[i] = TLE941XY_INIT_ENABLE;
+            }
+            else
+            {
+                /* RUN <-> LOWPOWER: chips stay configured */
+            }
+            sTle941xy_abOutDirty[i] = FALSE;
+        }
+
+        if(eState != OBDPWR_STATE_RUN)
+        {
+            /* diagnostics are suspended, results are unknown */
+            (void)memset(sTle941xy_atDiagResult,0u,sizeof(sTle941xy_atDiagResult));
+        }
+        sTle941xy_ePwrState = eState;
     }
 }
 
 /****************************************************************************************
-| NAME:    Tle941xy_WriteOhbChn
+| NAME:    Tle941xy_WriteHbChn
 | CALLED BY:     output layer
 | PRECONDITIONS:     NA
 | INPUT PARAMETERS:    uint8 channel, uint16 Value
@@ -654,20 +1711,159 @@ void Tle941xy_DeInit(void)
  ****************************************************************************************/
 void Tle941xy_WriteHbChn(uint8 u8GroupId, uint8 u8ChipId,uint8 u8ChnId, uint8 u8Val)
 {
-    if((u8GroupId < (uint8)TLE941XY_GROUP_MAX)
-    &&(u8ChipId < (uint8)TLE941XY_CHIP_MAX)
+    if((u8GroupId < sTle941xy_u8GroupNum)
+    &&(u8ChipId < sTle941xy_au8ChipNum[u8GroupId])
     &&(u8ChnId < (uint8)TLE941XY_CHANNEL_MAX))
     {
-        sTle941xy_u8HbOutSts[u8GroupId][u8ChipId][u8ChnId] = u8Val;
+        if(sTle941xy_u8HbOutSts[u8GroupId][u8ChipId][u8ChnId] != u8Val)
+        {
+            sTle941xy_u8HbOutSts[u8GroupId][u8ChipId][u8ChnId] = u8Val;
+            sTle941xy_abOutDirty[u8GroupId] = TRUE;
+#if((TLE941XY_SPIARB_EN == STD_ON) || (TLE941XY_EVENT_OUTPUT_EN == STD_ON))
+            if((sTle941xy_aeInitStep[u8GroupId] == TLE941XY_INIT_DONE) && (sTle941xy_ePwrState != OBDPWR_STATE_SLEEP))
+            {
+#if(TLE941XY_SPIARB_EN == STD_ON)
+                /* flush on the next arbiter call instead of the next driver cycle */
+                Tle941xy_Submit(u8GroupId, SPIARB_PRIO_OUTPUT, &Tle941xy_OutputJob);
+#endif
+#if(TLE941XY_EVENT_OUTPUT_EN == STD_ON)
+                TLE941XY_OUTPUT_TRIGGER();
+#endif
+            }
+            else
+            {
+                /* written with the init or wake up sequence */
+            }
+#endif
+        }
     }
 }
 
 void Tle941xy_WritePwmChn(uint8 u8GroupId, uint8 u8ChipId,uint8 u8PwmChn, uint8 u8Val)
 {
-    if((u8GroupId < (uint8)TLE941XY_GROUP_MAX)
-    &&(u8ChipId < (uint8)TLE941XY_CHIP_MAX)
+    if((u8GroupId < sTle941xy_u8GroupNum)
+    &&(u8ChipId < sTle941xy_au8ChipNum[u8GroupId])
     &&(u8PwmChn < (uint8)TLE941XY_PWM_CHN_MAX))
     {
-        sTle941xy_u8PwmDuty[u8GroupId][u8ChipId][u8PwmChn] = u8Val;
+        if(sTle941xy_u8PwmDuty[u8GroupId][u8ChipId][u8PwmChn] != u8Val)
+        {
+            sTle941xy_u8PwmDuty[u8GroupId][u8ChipId][u8PwmChn] = u8Val;
+            sTle941xy_abOutDirty[u8GroupId] = TRUE;
+#if((TLE941XY_SPIARB_EN == STD_ON) || (TLE941XY_EVENT_OUTPUT_EN == STD_ON))
+            if((sTle941xy_aeInitStep[u8GroupId] == TLE941XY_INIT_DONE) && (sTle941xy_ePwrState != OBDPWR_STATE_SLEEP))
+            {
+#if(TLE941XY_SPIARB_EN == STD_ON)
+                /* flush on the next arbiter call instead of the next driver cycle */
+                Tle941xy_Submit(u8GroupId, SPIARB_PRIO_OUTPUT, &Tle941xy_OutputJob);
+#endif
+#if(TLE941XY_EVENT_OUTPUT_EN == STD_ON)
+                TLE941XY_OUTPUT_TRIGGER();
+#endif
+            }
+            else
+            {
+                /* written with the init or wake up sequence */
+            }
+#endif
+        }
+    }
+}
+
+/****************************************************************************************
+| NAME:    Tle941xy_WriteFwChn
+| CALLED BY:     HBridge
+| PRECONDITIONS:     NA
+| INPUT PARAMETERS:    uint8 u8GroupId, uint8 u8ChipId, uint8 u8ChnId, boolean bActive
+| RETURN VALUE:     void
+| DESCRIPTION:      select active (TRUE) or passive freewheeling of a PWM output. The
+|                   FW_OL_CTRL/FW_CTRL frames are sent with the next output job, before the
+|                   init sequence is done they are written by its freewheeling step.
+****************************************************************************************/
+void Tle941xy_WriteFwChn(uint8 u8GroupId, uint8 u8ChipId, uint8 u8ChnId, boolean bActive)
+{
+    if((u8GroupId < sTle941xy_u8GroupNum)
+    &&(u8ChipId < sTle941xy_au8ChipNum[u8GroupId])
+    &&(u8ChnId < (uint8)TLE941XY_CHANNEL_MAX))
+    {
+        if(sTle941xy_abFwSel[u8GroupId][u8ChipId][u8ChnId] != bActive)
+        {
+            sTle941xy_abFwSel[u8GroupId][u8ChipId][u8ChnId] = bActive;
+            sTle941xy_abFwDirty[u8GroupId] = TRUE;
+            sTle941xy_abOutDirty[u8GroupId] = TRUE;
+#if((TLE941XY_SPIARB_EN == STD_ON) || (TLE941XY_EVENT_OUTPUT_EN == STD_ON))
+            if((sTle941xy_aeInitStep[u8GroupId] == TLE941XY_INIT_DONE) && (sTle941xy_ePwrState != OBDPWR_STATE_SLEEP))
+            {
+#if(TLE941XY_SPIARB_EN == STD_ON)
+                Tle941xy_Submit(u8GroupId, SPIARB_PRIO_OUTPUT, &Tle941xy_OutputJob);
+#endif
+#if(TLE941XY_EVENT_OUTPUT_EN == STD_ON)
+                TLE941XY_OUTPUT_TRIGGER();
+#endif
+            }
+            else
+            {
+                /* written with the init or wake up sequence */
+            }
+#endif
+        }
+    }
+}
+
+/****************************************************************************************
+| NAME:    Tle941xy_GetFrameErrCnt
+| CALLED BY:     diagnostic service / application
+| PRECONDITIONS:     NA
+| INPUT PARAMETERS:    uint8 u8Group
+| RETURN VALUE:     rejected frames of the group, retries included, saturated
+| DESCRIPTION:      SPI frame error counter
+****************************************************************************************/
+uint16 Tle941xy_GetFrameErrCnt(uint8 u8Group)
+{
+    uint16 l_u16Cnt = 0u;
+
+    if(u8Group < TLE941XY_GROUP_MAX)
+    {
+        l_u16Cnt = sTle941xy_au16FrameErrCnt[u8Group];
+    }
+    return l_u16Cnt;
+}
+
+/****************************************************************************************
+| NAME:    Tle941xy_GetFrameLostCnt
+| CALLED BY:     diagnostic service / application
+| PRECONDITIONS:     NA
+| INPUT PARAMETERS:    uint8 u8Group
+| RETURN VALUE:     frames of the group still rejected after all retries, saturated
+| DESCRIPTION:      SPI frame lost counter
+****************************************************************************************/
+uint16 Tle941xy_GetFrameLostCnt(uint8 u8Group)
+{
+    uint16 l_u16Cnt = 0u;
+
+    if(u8Group < TLE941XY_GROUP_MAX)
+    {
+        l_u16Cnt = sTle941xy_au16FrameLostCnt[u8Group];
+    }
+    return l_u16Cnt;
+}
+
+#if(TLE941XY_DERATE_EN == STD_ON)
+/****************************************************************************************
+| NAME:    Tle941xy_GetDerateLevel
+| CALLED BY:     application / diagnostic service
+| PRECONDITIONS:     NA
+| INPUT PARAMETERS:    uint8 u8Group, uint8 u8Chip
+| RETURN VALUE:     thermal derating level of the chip, TLE941XY_DERATE_LVL_0 is full output
+| DESCRIPTION:      lets the application see why outputs are reduced or shed
+****************************************************************************************/
+uint8 Tle941xy_GetDerateLevel(uint8 u8Group, uint8 u8Chip)
+{
+    uint8 l_u8Lvl = TLE941XY_DERATE_LVL_0;
+
+    if((u8Group < TLE941XY_GROUP_MAX) && (u8Chip < TLE941XY_CHIP_MAX))
+    {
+        l_u8Lvl = sTle941xy_au8DerateLvl[u8Group][u8Chip];
     }
+    return l_u8Lvl;
 }
+#endif
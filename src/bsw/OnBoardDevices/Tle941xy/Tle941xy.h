@@ -19,11 +19,24 @@
 
 #include "Tle941xy_Types.h"
 #include "Tle941xy_HwCfg.h"
+#include "ObdPwr_Types.h"
 
 extern void Tle941xy_Init(void);
+extern void Tle941xy_InitMainFunction(void);
+extern boolean Tle941xy_IsGroupReady(uint8 u8Group);
 extern void Tle941xy_MainFunction(void);
+#if((TLE941XY_EVENT_OUTPUT_EN == STD_ON) && (TLE941XY_SPIARB_EN == STD_OFF))
+extern void Tle941xy_OutputMainFunction(void);
+#endif
 extern void Tle941xy_DeInit(void);
-extern void Tle941xy_WriteOhbChn(uint8 u8GroupId, uint8 u8ChipId,uint8 u8ChnId, uint8 u8Val);
+extern void Tle941xy_SetPowerState(ObdPwr_StateType eState);
+extern void Tle941xy_WriteHbChn(uint8 u8GroupId, uint8 u8ChipId,uint8 u8ChnId, uint8 u8Val);
 extern void Tle941xy_WritePwmChn(uint8 u8GroupId, uint8 u8ChipId,uint8 u8PwmChn, uint8 u8Val);
+extern void Tle941xy_WriteFwChn(uint8 u8GroupId, uint8 u8ChipId, uint8 u8ChnId, boolean bActive);
+extern uint16 Tle941xy_GetFrameErrCnt(uint8 u8Group);
+extern uint16 Tle941xy_GetFrameLostCnt(uint8 u8Group);
+#if(TLE941XY_DERATE_EN == STD_ON)
+extern uint8 Tle941xy_GetDerateLevel(uint8 u8Group, uint8 u8Chip);
+#endif
 
 #endif
@@ -25,12 +25,14 @@ const Tle941xy_GroupType cTle941xy_atGroupCfg[TLE941XY_GROUP_MAX] =
         SpiConf_SpiSequence_SpiSequence_TLE94112_0,
         TLE941XY_DAISY_CHAIN_NO_USER,
         &gTle941xy_u8Group0ChipNum,
+        SPIARB_BUS_0,
     },
     {
         SpiConf_SpiChannel_SpiChannel_TLE94112_1, 
         SpiConf_SpiSequence_SpiSequence_TLE94112_1,
         TLE941XY_DAISY_CHAIN_NO_USER,
         &gTle941xy_u8Group0ChipNum,
+        SPIARB_BUS_0,
     },
 };
 
@@ -169,4 +171,55 @@ const boolean cTle941xy_abChipHS1And2LedModeCfg[TLE941XY_GROUP_MAX][TLE941XY_CHI
             TLE941XY_CHN_LED_OFF,
         },
     },
-};
\ No newline at end of file
+};
+#if(TLE941XY_DERATE_EN == STD_ON)
+/* PWM duty in percent of the requested duty per derating level */
+const uint8 cTle941xy_au8DerateDutyCfg[TLE941XY_DERATE_LVL_MAX] =
+{
+    100u,
+    75u,
+    50u,
+};
+
+const uint8 cTle941xy_au8ChnPrioCfg[TLE941XY_GROUP_MAX][TLE941XY_CHIP_MAX][TLE941XY_CHANNEL_MAX] =
+{
+    {
+        {
+            /* TLE94112*/
+            TLE941XY_CHN_PRIO_HIGH,
+            TLE941XY_CHN_PRIO_HIGH,
+            TLE941XY_CHN_PRIO_MID,
+            TLE941XY_CHN_PRIO_MID,
+
+            TLE941XY_CHN_PRIO_MID,
+            TLE941XY_CHN_PRIO_MID,
+            TLE941XY_CHN_PRIO_LOW,
+            TLE941XY_CHN_PRIO_LOW,
+
+            TLE941XY_CHN_PRIO_LOW,
+            TLE941XY_CHN_PRIO_LOW,
+            TLE941XY_CHN_PRIO_LOW,
+            TLE941XY_CHN_PRIO_LOW,
+        },
+    },
+    {
+        {
+            /* TLE94112*/
+            TLE941XY_CHN_PRIO_HIGH,
+            TLE941XY_CHN_PRIO_HIGH,
+            TLE941XY_CHN_PRIO_HIGH,
+            TLE941XY_CHN_PRIO_HIGH,
+
+            TLE941XY_CHN_PRIO_MID,
+            TLE941XY_CHN_PRIO_MID,
+            TLE941XY_CHN_PRIO_MID,
+            TLE941XY_CHN_PRIO_MID,
+
+            TLE941XY_CHN_PRIO_LOW,
+            TLE941XY_CHN_PRIO_LOW,
+            TLE941XY_CHN_PRIO_LOW,
+            TLE941XY_CHN_PRIO_LOW,
+        },
+    },
+};
+#endif
@@ -20,6 +20,7 @@
 #include "Tle941xy_Types.h"
 #include "Spi.h"
 #include "Dio.h"
+#include "SpiArb.h"
 
 #define TLE941XY_TLE94103_CHIP_EN STD_OFF
 #define TLE941XY_TLE94104_CHIP_EN STD_OFF
@@ -28,6 +29,33 @@
 #define TLE941XY_TLE94110_CHIP_EN STD_OFF
 #define TLE941XY_TLE94112_CHIP_EN STD_ON
 
+/* STD_ON: Tle941xy_Init only arms the group init, the register sequence is run by
+   Tle941xy_InitMainFunction. STD_OFF: Tle941xy_Init runs the whole sequence blocking. */
+#define TLE941XY_INCREMENTAL_INIT STD_ON
+/* init steps per group and Tle941xy_InitMainFunction call, each step is one register access sequence */
+#define TLE941XY_INIT_STEPS_PER_CALL 1u
+/* STD_ON: the cyclic SPI work is queued as jobs on the arbiter of the group's SPI unit
+   (SpiArb_MainFunction runs them by priority). STD_OFF: jobs run at once in the caller. */
+#define TLE941XY_SPIARB_EN STD_ON
+/* repetitions of a rejected frame, only the failed group's last transaction is sent again */
+#define TLE941XY_SPI_RETRY_MAX 2u
+/* STD_ON: the cyclic output job is only queued for a changed output image, and every
+   TLE941XY_OUTPUT_REFRESH_CYCLES main cycles against lost register content (1u: every cycle).
+   Diagnostics stay on the main cycle. */
+#define TLE941XY_EVENT_OUTPUT_EN STD_ON
+#define TLE941XY_OUTPUT_REFRESH_CYCLES 10u
+/* callout after the write interface changed the output image, e.g. activation of the task
+   running SpiArb_MainFunction, or Tle941xy_OutputMainFunction when the arbiter is off,
+   so the change is applied before the next raster */
+#define TLE941XY_OUTPUT_TRIGGER() ((void)0)
+/* STD_ON: SYS_DIAG_1 is read in the diagnostic job and a temperature pre-warning
+   derates the chip step by step: PWM duties scaled, low priority channels shed */
+#define TLE941XY_DERATE_EN STD_ON
+/* diagnostic cycles with pre-warning before the next derating level */
+#define TLE941XY_DERATE_QUAL_CNT 3u
+/* diagnostic cycles without pre-warning before one level is given back */
+#define TLE941XY_DERATE_HEAL_CNT 50u
+
 
 typedef enum
 {
@@ -48,5 +76,9 @@ extern const uint8 cTle941xy_au8ChnModeCfg[TLE941XY_GROUP_MAX][TLE941XY_CHIP_MAX
 extern const Tle941xy_PwmType cTle941xy_atChipFmPwmFreqCfg[TLE941XY_GROUP_MAX][TLE941XY_CHIP_MAX];
 extern const boolean cTle941xy_abChipFreeWheelingCfg[TLE941XY_GROUP_MAX][TLE941XY_CHIP_MAX][TLE941XY_CHANNEL_MAX];
 extern const boolean cTle941xy_abChipHS1And2LedModeCfg[TLE941XY_GROUP_MAX][TLE941XY_CHIP_MAX][2];
+#if(TLE941XY_DERATE_EN == STD_ON)
+extern const uint8 cTle941xy_au8DerateDutyCfg[TLE941XY_DERATE_LVL_MAX];
+extern const uint8 cTle941xy_au8ChnPrioCfg[TLE941XY_GROUP_MAX][TLE941XY_CHIP_MAX][TLE941XY_CHANNEL_MAX];
+#endif
 
 #endif
\ No newline at end of file
@@ -62,6 +62,18 @@
 #define TLE941XY_LABT_OFF 0u
 #define TLE941XY_LABT_ON 1u
 
+/*****Global status byte, first byte of every chip in the response frame, mirrors SYS_DIAG_1******/
+#define TLE941XY_GSB_SPI_ERR TLE941XY_SYS_DIAG_1_SPI_ERR   /* SPI frame error: clock count or LABT framing wrong */
+
+/*****control registers whose write response is checked against the expected echo******/
+#define TLE941XY_REG_ADDR_MASK 0x1Fu
+#define TLE941XY_ECHO_REG_MASK ((uint32)((1uL << TLE941XY_HB_ACT_1_CTRL) | (1uL << TLE941XY_HB_ACT_2_CTRL) \
+                                | (1uL << TLE941XY_HB_ACT_3_CTRL) | (1uL << TLE941XY_HB_MODE_1_CTRL) \
+                                | (1uL << TLE941XY_HB_MODE_2_CTRL) | (1uL << TLE941XY_HB_MODE_3_CTRL) \
+                                | (1uL << TLE941XY_PWM_CH_FREQ_CTRL) | (1uL << TLE941XY_PWM1_DC_CTRL) \
+                                | (1uL << TLE941XY_PWM2_DC_CTRL) | (1uL << TLE941XY_PWM3_DC_CTRL) \
+                                | (1uL << TLE941XY_FW_OL_CTRL) | (1uL << TLE941XY_FW_CTRL)))
+
 #define TLE941XY_READ 0u
 #define TLE941XY_WRITE 1u
 
@@ -88,6 +100,14 @@
 #define TLE941XY_SYS_DIAG_5 0x01u
 #define TLE941XY_SYS_DIAG_6 0x11u
 #define TLE941XY_SYS_DIAG_7 0x09u
+/*****SYS_DIAG_1 global status bits******/
+#define TLE941XY_SYS_DIAG_1_TPW     0x02u   /* temperature pre-warning */
+#define TLE941XY_SYS_DIAG_1_TSD     0x04u   /* thermal shutdown, all outputs off */
+#define TLE941XY_SYS_DIAG_1_NPOR    0x08u   /* not power on reset */
+#define TLE941XY_SYS_DIAG_1_VS_OV   0x10u   /* VS overvoltage */
+#define TLE941XY_SYS_DIAG_1_VS_UV   0x20u   /* VS undervoltage */
+#define TLE941XY_SYS_DIAG_1_LE      0x40u   /* load error in SYS_DIAG_2..7 */
+#define TLE941XY_SYS_DIAG_1_SPI_ERR 0x80u   /* SPI frame error */
 
 #define TLE941XY_CHN_DUMMY     0u
 #define TLE941XY_CHN_CTRL_DO   0U
@@ -118,6 +138,17 @@
 #define TLE941XY_CHN_LED_ON  1u
 #define TLE941XY_CHN_LED_OFF  0u
 
+/*****thermal derating, level 0 is full output******/
+#define TLE941XY_DERATE_LVL_0   0u
+#define TLE941XY_DERATE_LVL_1   1u
+#define TLE941XY_DERATE_LVL_2   2u
+#define TLE941XY_DERATE_LVL_MAX 3u
+
+/* a channel is shed when its priority is below the derating level of the chip */
+#define TLE941XY_CHN_PRIO_LOW  0u
+#define TLE941XY_CHN_PRIO_MID  1u
+#define TLE941XY_CHN_PRIO_HIGH 2u
+
 
 typedef struct 
 {
@@ -133,6 +164,7 @@ typedef struct
     Spi_SequenceType SpiSequence;
     uint8 u8DaisyChainEn;
     uint8* pu8ChipNum;
+    uint8 u8SpiBus;
 }Tle941xy_GroupType;
 
 typedef struct
@@ -170,6 +202,20 @@ typedef struct
     uint8 SYS_DIAG_7;
 }Tle941xy_RegDataType;
 
+/* steps of the group init sequence, see Tle941xy_InitMainFunction */
+typedef enum
+{
+    TLE941XY_INIT_ENABLE = 0u,
+    TLE941XY_INIT_READ_ID,
+    TLE941XY_INIT_HB_MODE,
+    TLE941XY_INIT_FW_OL,
+    TLE941XY_INIT_PWM_FREQ,
+    TLE941XY_INIT_HB_OUTPUT,
+    TLE941XY_INIT_DONE,
+    /* wake up: register restore job queued, the job sets DONE */
+    TLE941XY_INIT_RESTORE
+}Tle941xy_InitStepType;
+
 #endif
 
 
@@ -18,8 +18,9 @@
 #include "Vn7x_Types.h"
 #include "Vn7x_HwCfg.h"
 
-#include "AdcIf.h"
 #include "Pfm.h"
+#include "IoChnReg.h"
+#include "AdcCls.h"
 #include <string.h>
 #include "LiBool.h"
 /* PRQA S 0314 EOF*/
@@ -31,6 +32,9 @@
 /* the fault status of all channels*/
 static PFM_DefectReportState_t sVn7x_atDiagResult[VN7X_ID_MAX];
 
+/* channels present in the selected variant, the loops only run over these */
+static uint8 sVn7x_u8ChnNum;
+
 /* record of current diagnostic channel selection */
 static uint8 sVn7x_u8ChnSel = VN7X_DAIG_SEL_CHN_ZERO;
 
@@ -42,7 +46,19 @@ static boolean sVn7x_abDoValue[VN7X_ID_MAX];
 /* the record of ON/OFF status of all channels */
 static uint32 sVn7x_u32ChnSts;
 /* ADC value of feedback diagnostic signals of all channels */
-static uint16 gVn7x_au16DiagAdcV[VN7X_ID_MAX];
+static Adc_ValueGroupType gVn7x_au16DiagAdcV[VN7X_ID_MAX];
+/* result buffer the ADC driver writes the group conversion to */
+static Adc_ValueGroupType sVn7x_au16AdcResult[VN7X_ID_MAX];
+/* open load / short thresholds of all channels as arrays for the batch classification */
+static uint16 sVn7x_au16OlThr[VN7X_ID_MAX];
+static uint16 sVn7x_au16ShortThr[VN7X_ID_MAX];
+/* power state requested by ObdPwr */
+static ObdPwr_StateType sVn7x_ePwrState = OBDPWR_STATE_RUN;
+#if(VN7X_EVENT_OUTPUT_EN == STD_ON)
+/* channels changed since the last output write, and the summary flag over them */
+static boolean sVn7x_abOutPending[VN7X_ID_MAX];
+static boolean sVn7x_bOutPending;
+#endif
 
 #define VN7X_GETCHANSTATE(port)    GETBIT_U32(sVn7x_u32ChnSts, port)
 /*******************************************************************************
@@ -53,6 +69,11 @@ static void Vn7x_GetDiagAdVal(void);
 static void Vn7x_DiagHandle(void);
 static boolean Vn7x_JudgePwmDuty(uint16 u16NominalValue);
 static void Vn7x_WriteOutput(void);
+static void Vn7x_WriteChnOutput(uint8 u8Chn);
+#if(VN7X_EVENT_OUTPUT_EN == STD_ON)
+static boolean Vn7x_IsChnChanged(uint8 u8Chn, uint16 u16Val);
+#endif
+static void Vn7x_SetSenseEnable(uint8 u8Level);
 /*******************************************************************************
 **  Global  Function definitions
 *******************************************************************************/
@@ -69,15 +90,20 @@ static void Vn7x_DiagHandle(void)
     boolean l_bChanState;
     uint8   l_u8Port;
     uint8   l_u8DiagMode;
-    uint8   l_u8DiagChn;
+    uint8   l_u8DiagChn = VN7X_DAIG_SEL_CHN_ZERO;
     uint16  l_u16DiagRaw;
     PFM_PhysicalId_e l_eFid; 
+    uint32  l_au32OlMask[ADCCLS_MASK_WORDS(VN7X_ID_MAX)];
+    uint32  l_au32ShortMask[ADCCLS_MASK_WORDS(VN7X_ID_MAX)];
     
+    /* Classify all channels against their thresholds in one pass */
+    AdcCls_Classify(gVn7x_au16DiagAdcV, sVn7x_au16OlThr, sVn7x_au16ShortThr, sVn7x_u8ChnNum, l_au32OlMask, l_au32ShortMask);
     /* Go through all channels and perform diagnostic operation.
        Report diagnosing result to Pfm. */
-    for( l_u8Port = 0u; l_u8Port < (uint8)VN7X_ID_MAX; l_u8Port++ )
+    for( l_u8Port = 0u; l_u8Port < sVn7x_u8ChnNum; l_u8Port++ )
     {
         /* Get the index of current channel in Pfm module*/
+        l_eFid = IoChnReg_Vn7xPid(l_u8Port);
         l_bChanState = (boolean)(VN7X_GETCHANSTATE(l_u8Port) ? TRUE : FALSE);
         /* if diagnosing channel selection equals this channel (channel 0 or channel 1),
            which means the ADC sample value belongs to this channel, diagnosing can be 
@@ -86,28 +112,17 @@ static void Vn7x_DiagHandle(void)
             && (GETBIT_U32(sVn7x_u32ChnSts,l_u8Port)
             || (l_bChanState == (boolean)FALSE)))
         {
-            if(gVn7x_au16DiagAdcV[l_u8Port] <= cVn7x_atChannelInputCfg[l_u8Port].u16OLDiagAdcVal)
-            {
-                sVn7x_atDiagResult[l_u8Port].eOpenLoad  = PFM_DDS_POS;
-            }
-            else if(gVn7x_au16DiagAdcV[l_u8Port] >= cVn7x_atChannelInputCfg[l_u8Port].u16ShortDiagAdcVal)
-            {
-                sVn7x_atDiagResult[l_u8Port].eShort2Gnd  = PFM_DDS_POS;
-            }
-            else
-            {
-                sVn7x_atDiagResult[l_u8Port].eOpenLoad  = PFM_DDS_ING;
-                sVn7x_atDiagResult[l_u8Port].eShort2Vcc = PFM_DDS_ING;
-            }
-            sVn7x_atDiagResult[l_u8Port].eShort2Gnd = PFM_DDS_ING;
+            sVn7x_atDiagResult[l_u8Port].OpenLoad  = GETBIT_U32(l_au32OlMask[l_u8Port / ADCCLS_MASK_BITS], l_u8Port % ADCCLS_MASK_BITS) ? PFM_DDS_POS : PFM_DDS_NEG;
+            sVn7x_atDiagResult[l_u8Port].Short2Gnd = GETBIT_U32(l_au32ShortMask[l_u8Port / ADCCLS_MASK_BITS], l_u8Port % ADCCLS_MASK_BITS) ? PFM_DDS_POS : PFM_DDS_NEG;
+            sVn7x_atDiagResult[l_u8Port].Short2Vcc = PFM_DDS_ING;
         }
         else   /* If this channel is not selected as feedback source, wait for next cycle */
         {
-            sVn7x_atDiagResult[l_u8Port].eOpenLoad  = PFM_DDS_ING;
-            sVn7x_atDiagResult[l_u8Port].eShort2Vcc = PFM_DDS_ING;
-            sVn7x_atDiagResult[l_u8Port].eShort2Gnd = PFM_DDS_ING;
+            sVn7x_atDiagResult[l_u8Port].OpenLoad  = PFM_DDS_ING;
+            sVn7x_atDiagResult[l_u8Port].Short2Vcc = PFM_DDS_ING;
+            sVn7x_atDiagResult[l_u8Port].Short2Gnd = PFM_DDS_ING;
         }
-        Pfm_DefectReport(l_eFid, sVn7x_atDiagResult[l_u8Port].eOpenLoad, sVn7x_atDiagResult[l_u8Port].eShort2Vcc, sVn7x_atDiagResult[l_u8Port].eShort2Gnd);
+        Pfm_DefectReport(l_eFid, sVn7x_atDiagResult[l_u8Port].OpenLoad, sVn7x_atDiagResult[l_u8Port].Short2Vcc, sVn7x_atDiagResult[l_u8Port].Short2Gnd);
     }
 }
 
@@ -148,22 +163,18 @@ static void Vn7x_DiagChanSw(void)
  ****************************************************************/
 static void Vn7x_GetDiagAdVal(void)
 {
-    uint8 l_u8Port;
-    uint8 l_u8DiagChan;
-
-    for (l_u8Port = 0u; l_u8Port < (uint8)VN7X_ID_MAX; l_u8Port ++)
+    /* If selected channel is being diagnosed, the ADC values of all feedback diagnostic channels
+        are taken from the last group conversion in one copy, all sampled at the same instant */
+    if (VN7X_DAIG_SEL_CHN_ZERO == sVn7x_u8ChnSel)
     {
-        /* If selected channel is being diagnosed, the ADC value of feedback diagnostic channel and
-            external hardwired control signal detection(if not applicable, set to 0) should be retrieved*/
-        if (l_u8DiagChan == sVn7x_u8ChnSel)
-        {
-            /* Get the AD value of diagnostic feedback */
-            gVn7x_au16DiagAdcV[l_u8Port] = AdcIf_GetAdcValue(cVn7x_au8AdcEidMap[l_u8Port]);
-        }
-        else
+        if (Adc_ReadGroup(VN7X_ADC_GROUP, gVn7x_au16DiagAdcV) != E_OK)
         {
+            /* no new conversion, keep the last values */
         }
     }
+    else
+    {
+    }
 }
 
 /****************************************************************
@@ -174,7 +185,7 @@ static void Vn7x_GetDiagAdVal(void)
 void Vn7x_TurnOffAll(void)
 {
     uint8 l_u8Port;
-    for(l_u8Port = 0u; l_u8Port < (uint8)VN7X_ID_MAX; l_u8Port++)
+    for(l_u8Port = 0u; l_u8Port < sVn7x_u8ChnNum; l_u8Port++)
     {
         Vn7x_WriteDoChn(l_u8Port, 0u);
     }
@@ -183,26 +194,85 @@ void Vn7x_TurnOffAll(void)
     Vn7x_WriteOutput();
 }
 
+static void Vn7x_WriteChnOutput(uint8 u8Chn)
+{
+    if(VN7X_PWM == cVn7x_atChannelInputCfg[u8Chn].eVn7x_Type)
+    {
+        Pwm_SetDutyCycle(cVn7x_atChannelInputCfg[u8Chn].u8Vn7xPwmCntrl, sVn7x_au16PwmOutDuty[u8Chn]);
+    }
+    else if( VN7X_DIO == cVn7x_atChannelInputCfg[u8Chn].eVn7x_Type)
+    {
+        Dio_WriteChannel(cVn7x_atChannelInputCfg[u8Chn].u8Vn7xDioInput, sVn7x_abDoValue[u8Chn]);
+    }
+    else
+    {
+        /*do nothing*/
+    }
+}
+
 static void Vn7x_WriteOutput(void)
 {
     uint8 i;
-    for(i = 0;i < (uint8)VN7X_ID_MAX;i++)
+    for(i = 0;i < sVn7x_u8ChnNum;i++)
     {
-        if(VN7X_PWM == cVn7x_atChannelInputCfg[i].eVn7x_Type)
-        {
-            Pwm_SetDutyCycle(cVn7x_atChannelInputCfg[i].u8Vn7xPwmCntrl, sVn7x_au16PwmOutDuty[i]);
-        }
-        else if( VN7X_DIO == cVn7x_atChannelInputCfg[i].eVn7x_Type)
-        {
-            Dio_WriteChannel(cVn7x_atChannelInputCfg[i].u8Vn7xDioInput, sVn7x_abDoValue[i]);
-        }
-        else
+        Vn7x_WriteChnOutput(i);
+    }
+}
+
+#if(VN7X_EVENT_OUTPUT_EN == STD_ON)
+/****************************************************************
+ process: Vn7x_OutputMainFunction
+ purpose: Write the channels changed since the last call. Called
+          by the output task activated through VN7X_OUTPUT_TRIGGER
+          and by Vn7x_MainFunction as fallback, nothing is written
+          while no command changes.
+ ****************************************************************/
+void Vn7x_OutputMainFunction(void)
+{
+    uint8 i;
+
+    if((sVn7x_bOutPending == TRUE) && (sVn7x_ePwrState != OBDPWR_STATE_SLEEP))
+    {
+        /* cleared before the scan, a change during the scan is taken by the next call */
+        sVn7x_bOutPending = FALSE;
+        for(i = 0u;i < sVn7x_u8ChnNum;i++)
         {
-            /*do nothing*/
+            if(sVn7x_abOutPending[i] == TRUE)
+            {
+                sVn7x_abOutPending[i] = FALSE;
+                Vn7x_WriteChnOutput(i);
+            }
+            else
+            {
+                /* nothing to do */
+            }
         }
     }
+    else
+    {
+        /* nothing changed or sleep */
+    }
+}
+
+static boolean Vn7x_IsChnChanged(uint8 u8Chn, uint16 u16Val)
+{
+    boolean l_bChanged = FALSE;
 
+    if(VN7X_PWM == cVn7x_atChannelInputCfg[u8Chn].eVn7x_Type)
+    {
+        l_bChanged = (boolean)(sVn7x_au16PwmOutDuty[u8Chn] != u16Val);
+    }
+    else if(VN7X_DIO == cVn7x_atChannelInputCfg[u8Chn].eVn7x_Type)
+    {
+        l_bChanged = (boolean)(sVn7x_abDoValue[u8Chn] != (boolean)u16Val);
+    }
+    else
+    {
+        /*do nothing*/
+    }
+    return l_bChanged;
 }
+#endif
 
 /****************************************************************
  process: Vn7x_v10ms
@@ -210,10 +280,77 @@ static void Vn7x_WriteOutput(void)
  ****************************************************************/
 void Vn7x_MainFunction(void)
 {
-    Vn7x_GetDiagAdVal();
-    Vn7x_DiagHandle();
-    Vn7x_WriteOutput();
-    Vn7x_DiagChanSw();
+    if(sVn7x_ePwrState == OBDPWR_STATE_RUN)
+    {
+        Vn7x_GetDiagAdVal();
+        Vn7x_DiagHandle();
+#if(VN7X_EVENT_OUTPUT_EN == STD_ON)
+        Vn7x_OutputMainFunction();
+#else
+        Vn7x_WriteOutput();
+#endif
+        Vn7x_DiagChanSw();
+    }
+    else if(sVn7x_ePwrState == OBDPWR_STATE_LOWPOWER)
+    {
+        /* outputs follow the application, diagnostics are suspended */
+#if(VN7X_EVENT_OUTPUT_EN == STD_ON)
+        Vn7x_OutputMainFunction();
+#else
+        Vn7x_WriteOutput();
+#endif
+    }
+    else
+    {
+        /* sleep: outputs are off, nothing to do */
+    }
+}
+
+/****************************************************************
+ process: Vn7x_SetSenseEnable
+ purpose: Current sense of all chips is only needed for diagnosis.
+ ****************************************************************/
+static void Vn7x_SetSenseEnable(uint8 u8Level)
+{
+    uint8 i;
+    for(i = 0u;i < sVn7x_u8ChnNum;i++)
+    {
+        Dio_WriteChannel(cVn7x_atChannelInputCfg[i].u8Vn7xDioSEn, u8Level);
+    }
+}
+
+/****************************************************************
+ process: Vn7x_SetPowerState
+ purpose: LOWPOWER keeps the outputs but stops the diagnosis,
+          SLEEP turns all outputs off as well. The diagnostic
+          results are unknown outside RUN.
+ ****************************************************************/
+void Vn7x_SetPowerState(ObdPwr_StateType eState)
+{
+    if(eState != sVn7x_ePwrState)
+    {
+        if(eState == OBDPWR_STATE_SLEEP)
+        {
+            Vn7x_TurnOffAll();
+        }
+        else
+        {
+            /* outputs are restored by the application */
+        }
+
+        if(eState == OBDPWR_STATE_RUN)
+        {
+            Vn7x_SetSenseEnable(STD_ON);
+            sVn7x_u8ChnSel = VN7X_DAIG_SEL_CHN_ZERO;
+            (void)memset((void *)gVn7x_au16DiagAdcV, 0, sizeof(gVn7x_au16DiagAdcV));
+        }
+        else
+        {
+            Vn7x_SetSenseEnable(STD_OFF);
+            (void)memset((void *)sVn7x_atDiagResult, 0, sizeof(PFM_DefectReportState_t) * (uint8)VN7X_ID_MAX); /* all diagnostic result = PFM_DDS_ING(0) */
+        }
+        sVn7x_ePwrState = eState;
+    }
 }
 
 /****************************************************************
@@ -222,12 +359,29 @@ void Vn7x_MainFunction(void)
  ****************************************************************/
 void Vn7x_Init(void)
 {
+    uint8 l_u8Port;
     uint8 i;
+
+    sVn7x_u8ChnNum = IoChnReg_GetChnNum(IOCHNREG_DRV_VN7X);
+    if(sVn7x_u8ChnNum > (uint8)VN7X_ID_MAX)
+    {
+        sVn7x_u8ChnNum = (uint8)VN7X_ID_MAX;
+    }
+    else
+    {
+        /* nothing to do */
+    }
     /* initialize the global diagnostic variables */
-    (void)memset((void *)gVn7x_au16DiagAdcV, 0, sizeof(uint16) * (uint8)VN7X_ID_MAX);                /* initialize AD values of all diagnostic channels */
+    (void)memset((void *)gVn7x_au16DiagAdcV, 0, sizeof(gVn7x_au16DiagAdcV));                /* initialize AD values of all diagnostic channels */
+    (void)Adc_SetupResultBuffer(VN7X_ADC_GROUP, sVn7x_au16AdcResult);
+    for(l_u8Port = 0u;l_u8Port < sVn7x_u8ChnNum;l_u8Port++)
+    {
+        sVn7x_au16OlThr[l_u8Port] = cVn7x_atChannelInputCfg[l_u8Port].u16OLDiagAdcVal;
+        sVn7x_au16ShortThr[l_u8Port] = cVn7x_atChannelInputCfg[l_u8Port].u16ShortDiagAdcVal;
+    }
     (void)memset((void *)sVn7x_atDiagResult,0,sizeof(PFM_DefectReportState_t) * (uint8)VN7X_ID_MAX); /* all diagnostic result = PFM_DDS_ING(0) */
     /* Select output 0 as feedback source at first place */
-    for(i = 0u;i < VN7X_ID_MAX;i++)
+    for(i = 0u;i < sVn7x_u8ChnNum;i++)
     {
         Dio_WriteChannel(cVn7x_atChannelInputCfg[i].u8Vn7xDioSEn, sVn7x_abDoValue[i]);
     }
@@ -248,7 +402,7 @@ void Vn7x_DeInit(void)
     /* turn off all outputs and initialize state record to all-off */
     Vn7x_TurnOffAll();
     /* initialize the global diagnostic variables */
-    (void)memset((void *)gVn7x_au16DiagAdcV, 0, sizeof(uint16) * (uint8)VN7X_ID_MAX);                  /* zero all diagnostic signal AD value */
+    (void)memset((void *)gVn7x_au16DiagAdcV, 0, sizeof(gVn7x_au16DiagAdcV));                  /* zero all diagnostic signal AD value */
 
     (void)memset((void *)sVn7x_atDiagResult, 0, sizeof(PFM_DefectReportState_t)*  (uint8)VN7X_ID_MAX); /* all diagnostic result = PFM_DDS_ING(0) */
     /* Switch feedback source to channel 0 */
@@ -261,25 +415,51 @@ void Vn7x_DeInit(void)
  ****************************************************************/
 void Vn7x_WriteDoChn(uint8 u8Chn, uint16 u16Val)
 {
-    if(VN7X_PWM == cVn7x_atChannelInputCfg[u8Chn].eVn7x_Type)
-    {
-        sVn7x_au16PwmOutDuty[u8Chn] = u16Val;
-    }
-    else if( VN7X_DIO== cVn7x_atChannelInputCfg[u8Chn].eVn7x_Type)
+#if(VN7X_EVENT_OUTPUT_EN == STD_ON)
+    boolean l_bChanged;
+#endif
+    if(u8Chn < sVn7x_u8ChnNum)
     {
-        sVn7x_abDoValue[u8Chn] = (boolean)u16Val;
-    }
-    else
-    {
-        /*do nothing*/
-    }
+#if(VN7X_EVENT_OUTPUT_EN == STD_ON)
+        l_bChanged = Vn7x_IsChnChanged(u8Chn, u16Val);
+#endif
+        if(VN7X_PWM == cVn7x_atChannelInputCfg[u8Chn].eVn7x_Type)
+        {
+            sVn7x_au16PwmOutDuty[u8Chn] = u16Val;
+        }
+        else if( VN7X_DIO== cVn7x_atChannelInputCfg[u8Chn].eVn7x_Type)
+        {
+            sVn7x_abDoValue[u8Chn] = (boolean)u16Val;
+        }
+        else
+        {
+            /*do nothing*/
+        }
 
-    if (u16Val > 0u)
-    {
-        sVn7x_u32ChnSts |= (uint32)1u << u8Chn;
+        if (u16Val > 0u)
+        {
+            sVn7x_u32ChnSts |= (uint32)1u << u8Chn;
+        }
+        else
+        {
+            sVn7x_u32ChnSts &= 0xFFFFFFFFul - ((uint32)1u << u8Chn);
+        }
+#if(VN7X_EVENT_OUTPUT_EN == STD_ON)
+        if(l_bChanged == TRUE)
+        {
+            /* value first, then the flags, then the trigger: the output task may preempt here */
+            sVn7x_abOutPending[u8Chn] = TRUE;
+            sVn7x_bOutPending = TRUE;
+            VN7X_OUTPUT_TRIGGER();
+        }
+        else
+        {
+            /* nothing to do */
+        }
+#endif
     }
     else
     {
-        sVn7x_u32ChnSts &= 0xFFFFFFFFul - ((uint32)1u << u8Chn);
+        /* channel not present in this variant */
     }
 }
@@ -5,12 +5,18 @@
 
 #include "Vn7x_Types.h"
 #include "Vn7x_HwCfg.h"
+#include "ObdPwr_Types.h"
 
 
 extern void Vn7x_Init(void);
 extern void Vn7x_DeInit(void);
 extern void Vn7x_MainFunction(void);
 extern void Vn7x_WriteDoChn(uint8 u8Chn, uint16 u16Val);
+extern void Vn7x_TurnOffAll(void);
+extern void Vn7x_SetPowerState(ObdPwr_StateType eState);
+#if(VN7X_EVENT_OUTPUT_EN == STD_ON)
+extern void Vn7x_OutputMainFunction(void);
+#endif
 
 
 #endif
\ No newline at end of file
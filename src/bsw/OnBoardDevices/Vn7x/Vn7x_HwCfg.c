@@ -89,8 +89,4 @@ const Vn7x_ChnCfgType cVn7x_atChannelInputCfg[VN7X_ID_MAX] =
     },
 };
 
-const uint8 cVn7x_au8AdcEidMap[VN7X_ID_MAX] =
-{
-    1,2,3,4,5,6
-};
 
@@ -6,6 +6,7 @@
 #include "Vn7x_Types.h"
 #include "Pwm.h"
 #include "Dio.h"
+#include "Adc.h"
 
 
 typedef enum
@@ -41,7 +42,17 @@ typedef struct
 #define VN7X_ENABLE_PWM_TRIGGER_ADC
 #define VN7X_DISABLE_PEM_TRIGGER_ADC
 
+/* diagnostic feedback of all channels is converted as one ADC group,
+   group channel n is the feedback of VN7X_ID n */
+/* STD_ON: outputs are written only for channels whose command changed, by
+   Vn7x_OutputMainFunction. Vn7x_MainFunction keeps the diagnosis on its raster. */
+#define VN7X_EVENT_OUTPUT_EN STD_ON
+/* callout of Vn7x_WriteDoChn on a change, e.g. activation of the output task or
+   software interrupt that calls Vn7x_OutputMainFunction */
+#define VN7X_OUTPUT_TRIGGER() ((void)0)
+
+#define VN7X_ADC_GROUP AdcConf_AdcGroup_AdcGroup_Vn7xDiag
+
 
 extern const Vn7x_ChnCfgType cVn7x_atChannelInputCfg[VN7X_ID_MAX];
-extern const uint8 cVn7x_au8AdcEidMap[VN7X_ID_MAX];
 #endif
@@ -18,7 +18,10 @@
 /* ===================                                                  */
 #include "Pfm.h"
 #include "Pfm_Cfg.h"
+#include "Pfm_Nv.h"
+#include "IoChnReg.h"
 #include "dem.h"
+#include <string.h>
 
 /* Module: Pfm - Power/Fault Management
    Abbreviations used:
@@ -37,6 +40,11 @@
 #define PFM_CLRBIT(basis, bitpos)   ((basis) &= (uint8)PFM_BIT_MASK_ALL - ((uint8)1u << (bitpos)))
 #define PFM_GETBIT(basis, bitpos)   (((basis) & ((uint8)1u << (bitpos))) != 0u)
 
+/* DEM staging: one bit per DTC id, 32 ids per word */
+#define PFM_DTC_WORD_SIZE           (((uint16)DTC_MAX + 31u) / 32u)
+#define PFM_DTC_WORD(dtcId)         ((uint16)(dtcId) >> 5u)
+#define PFM_DTC_MASK(dtcId)         ((uint32)1u << ((uint16)(dtcId) & 0x1Fu))
+
 
 /* Local Module RAM-Definitions (attribute static)                      */
 /* Definition of variables only local to this module. That is, not to   */
@@ -44,9 +52,28 @@
 /* ===========================================                          */
 static boolean Pfm_FaultUpdateEnable[PFM_PID_SIZE];
 static boolean Pfm_FaultUpdateEnableGlobal;
+static uint8 Pfm_EnableCondition;
+static uint8 Pfm_SettleTimer;
+/* chattering: leaky bucket per PID, filled by fault state transitions */
+static uint8 Pfm_ChatterLevel[PFM_PID_SIZE];
+static uint8 Pfm_ChatterTick;
+static boolean Pfm_Intermittent[PFM_PID_SIZE];
+/* double buffered snapshot, Pfm_SnapshotGen selects the published buffer */
+static PFM_Snapshot_t Pfm_SnapshotBuf[2];
+static volatile uint32 Pfm_SnapshotGen;
+/* fault state or intercept latch changed since the last snapshot and NV packing */
+static boolean Pfm_StateChanged;
+/* packed fault and intercept latches, see Pfm_Nv.h */
+static uint32 Pfm_NvPayload[PFM_NV_PAYLOAD_SIZE];
 static uint8 Pfm_DefectFilterCount[PFM_PID_SIZE][PFM_DDT_SIZE][PFM_DFC_SIZE];
 static uint8 Pfm_FaultState[PFM_PID_SIZE];
 static PFM_DefectDetectState_e Pfm_DefectDetectState[PFM_PID_SIZE][PFM_DDT_SIZE];
+/* DTCs touched in the current cycle and their last requested status (1: failed) */
+static uint32 Pfm_DemStaged[PFM_DTC_WORD_SIZE];
+static uint32 Pfm_DemFailed[PFM_DTC_WORD_SIZE];
+/* PIDs present in the selected variant, the cyclic loops only run over these */
+static const uint8* Pfm_ActivePid;
+static uint8 Pfm_ActivePidNum;
 
 /* Exported Variables Definitions */
 /* ============================================================         */
@@ -55,6 +82,15 @@ boolean Pfm_InterceptEnable[PFM_PID_SIZE];
 
 static void Pfm_ReportError2DEM(const uint16 dtcId);
 static void Pfm_ClearError2DEM(const uint16 dtcId);
+static void Pfm_FlushDEM(void);
+static void Pfm_UpdateEnableCondition(void);
+static void Pfm_SetFault(uint8 pid, uint8 ddt);
+static void Pfm_ClrFault(uint8 pid, uint8 ddt);
+static void Pfm_ChatterTransition(uint8 pid);
+static void Pfm_ChatterLeak(void);
+static void Pfm_PublishSnapshot(void);
+static void Pfm_PackNv(void);
+static void Pfm_RestoreNv(void);
 /************************************************************************/
 /*                 Global Definitions                                   */
 /************************************************************************/
@@ -68,7 +104,26 @@ void Pfm_Init(void)
         Pfm_FaultUpdateEnable[i] = TRUE;
     }
 
+    Pfm_ActivePid = IoChnReg_GetVariant()->au8Pid;
+    Pfm_ActivePidNum = IoChnReg_GetVariant()->u8PidNum;
+
     Pfm_FaultUpdateEnableGlobal = TRUE;
+    Pfm_EnableCondition = 0u;
+    Pfm_SettleTimer = 0u;
+
+    (void)memset((void *)Pfm_ChatterLevel, 0, sizeof(Pfm_ChatterLevel));
+    (void)memset((void *)Pfm_Intermittent, 0, sizeof(Pfm_Intermittent));
+    Pfm_ChatterTick = 0u;
+
+    (void)memset((void *)Pfm_SnapshotBuf, 0, sizeof(Pfm_SnapshotBuf));
+    Pfm_SnapshotGen = 0u;
+
+    /* latches of the last power cycle, outputs stay intercepted until the fault is cleared */
+    Pfm_RestoreNv();
+    Pfm_StateChanged = TRUE;
+
+    (void)memset((void *)Pfm_DemStaged, 0, sizeof(Pfm_DemStaged));
+    (void)memset((void *)Pfm_DemFailed, 0, sizeof(Pfm_DemFailed));
 }
 
 /****************************************************************
@@ -77,15 +132,21 @@ void Pfm_Init(void)
  ****************************************************************/
 void Pfm_10ms(void)
 {
+    uint8 i;
     uint8 pid;  /* Physical ID - local variable */
     uint8 ddt;  /* Defect Detect Type - local variable */
     uint8* filterCountPtr;
 
+    Pfm_UpdateEnableCondition();
+    Pfm_ChatterLeak();
+
     if( Pfm_FaultUpdateEnableGlobal != (boolean)FALSE )
     {
-        for( pid = 1u; pid < (uint8)PFM_PID_SIZE; pid++ )
+        for( i = 0u; i < Pfm_ActivePidNum; i++ )
         {
-            if( Pfm_FaultUpdateEnable[pid] != (boolean)FALSE )
+            pid = Pfm_ActivePid[i];
+            if( (Pfm_FaultUpdateEnable[pid] != (boolean)FALSE)
+             && ((uint8)(Pfm_EnableConditionMask[pid] & (uint8)~Pfm_EnableCondition) == 0u) )
             {
                 for( ddt = 0u; ddt < (uint8)PFM_DDT_SIZE; ddt++ )
                 {
@@ -102,8 +163,7 @@ void Pfm_10ms(void)
                             {
                                 Pfm_DefectFilterCount[pid][ddt][PFM_DFC_SET] = 0u;
                                 Pfm_DefectFilterCount[pid][ddt][PFM_DFC_CLR] = 0u;
-                                PFM_SETBIT(Pfm_FaultState[pid], ddt);
-                                Pfm_ReportError2DEM(Pfm_DefectDtcId[pid][ddt]);
+                                Pfm_SetFault(pid, ddt);
                             }
                         }
                         break;
@@ -119,8 +179,7 @@ void Pfm_10ms(void)
                             {
                                 Pfm_DefectFilterCount[pid][ddt][PFM_DFC_SET] = 0u;
                                 Pfm_DefectFilterCount[pid][ddt][PFM_DFC_CLR] = 0u;
-                                PFM_CLRBIT(Pfm_FaultState[pid], ddt);
-                                Pfm_ClearError2DEM(Pfm_DefectDtcId[pid][ddt]);
+                                Pfm_ClrFault(pid, ddt);
                             }
                         }
                         break;
@@ -129,8 +188,7 @@ void Pfm_10ms(void)
                         {
                             Pfm_DefectFilterCount[pid][ddt][PFM_DFC_SET] = 0u;
                             Pfm_DefectFilterCount[pid][ddt][PFM_DFC_CLR] = 0u;
-                            (void)PFM_SETBIT(Pfm_FaultState[pid], ddt);
-                            Pfm_ReportError2DEM(Pfm_DefectDtcId[pid][ddt]);
+                            Pfm_SetFault(pid, ddt);
                         }
                         break;
 
@@ -138,8 +196,7 @@ void Pfm_10ms(void)
                         {
                             Pfm_DefectFilterCount[pid][ddt][PFM_DFC_SET] = 0u;
                             Pfm_DefectFilterCount[pid][ddt][PFM_DFC_CLR] = 0u;
-                            PFM_CLRBIT(Pfm_FaultState[pid], ddt);
-                            Pfm_ClearError2DEM(Pfm_DefectDtcId[pid][ddt]);
+                            Pfm_ClrFault(pid, ddt);
                         }
                         break;
 
@@ -151,9 +208,11 @@ void Pfm_10ms(void)
                     }
                  }
                 
-                if ((Pfm_FaultState[pid] & Pfm_InterceptEnableMask[pid]) != 0u)
+                if (((Pfm_FaultState[pid] & Pfm_InterceptEnableMask[pid]) != 0u)
+                 && (Pfm_InterceptEnable[pid] == (boolean)FALSE))
                 {
                     Pfm_InterceptEnable[pid] = TRUE;
+                    Pfm_StateChanged = TRUE;
                 }
                 else
                 {
@@ -170,7 +229,386 @@ void Pfm_10ms(void)
     {
         /* nothing to do */
     }
+
+    /* DEM is called once per touched DTC, outside the filter loop */
+    Pfm_FlushDEM();
+
+    /* snapshot and NV image only follow a change, readers keep the generation */
+    if( Pfm_StateChanged != (boolean)FALSE )
+    {
+        Pfm_StateChanged = FALSE;
+        Pfm_PublishSnapshot();
+        Pfm_PackNv();
+    }
+    else
+    {
+        /* nothing to do */
+    }
+    Pfm_NvUpdate(Pfm_NvPayload);
+}
+
+/****************************************************************
+ process: Pfm_PackNv
+ purpose: Pack fault state and intercept latch, 4 bits per PID
+ ****************************************************************/
+static void Pfm_PackNv(void)
+{
+    uint8 pid;
+    uint32 nibble;
+
+    (void)memset((void *)Pfm_NvPayload, 0, sizeof(Pfm_NvPayload));
+    for( pid = 0u; pid < (uint8)PFM_PID_SIZE; pid++ )
+    {
+        nibble = (uint32)Pfm_FaultState[pid] & 0x07u;
+        if( Pfm_InterceptEnable[pid] != (boolean)FALSE )
+        {
+            nibble |= PFM_NV_INTERCEPT_BIT;
+        }
+        else
+        {
+            /* nothing to do */
+        }
+        Pfm_NvPayload[PFM_NV_PID_WORD(pid)] |= nibble << PFM_NV_PID_SHIFT(pid);
+    }
+}
+
+/****************************************************************
+ process: Pfm_RestoreNv
+ purpose: Restore fault state and intercept latches at start up,
+          DEM keeps its own event memory and is not reported to
+ ****************************************************************/
+static void Pfm_RestoreNv(void)
+{
+    uint8 pid;
+    uint32 nibble;
+
+    if( Pfm_NvRestore(Pfm_NvPayload) == E_OK )
+    {
+        for( pid = 1u; pid < (uint8)PFM_PID_SIZE; pid++ )
+        {
+            nibble = (Pfm_NvPayload[PFM_NV_PID_WORD(pid)] >> PFM_NV_PID_SHIFT(pid)) & 0x0Fu;
+            Pfm_FaultState[pid] = (uint8)(nibble & 0x07u);
+            Pfm_InterceptEnable[pid] = ((nibble & PFM_NV_INTERCEPT_BIT) != 0u) ? TRUE : FALSE;
+        }
+    }
+    else
+    {
+        /* nothing to do */
+    }
+}
+
+/****************************************************************
+ process: Pfm_Shutdown
+ purpose: Write pending fault state changes before power down
+ ****************************************************************/
+void Pfm_Shutdown(void)
+{
+    Pfm_PackNv();
+    Pfm_NvFlush(Pfm_NvPayload);
+}
+
+/****************************************************************
+ process: Pfm_PublishSnapshot
+ purpose: Pack fault and intercept states into the buffer readers
+          are not using, then publish it by bumping the generation.
+          Pfm_10ms is the only writer.
+ ****************************************************************/
+static void Pfm_PublishSnapshot(void)
+{
+    uint8 pid;
+    uint8 ddt;
+    uint32 gen = Pfm_SnapshotGen + 1u;
+    PFM_Snapshot_t* snap = &Pfm_SnapshotBuf[gen & 1u];
+
+    /* the previous generation is visible before its older buffer is reused */
+    COMPILER_MEMORY_BARRIER();
+    (void)memset((void *)snap->FaultState, 0, sizeof(snap->FaultState));
+    (void)memset((void *)snap->Intercept, 0, sizeof(snap->Intercept));
+    for( pid = 0u; pid < (uint8)PFM_PID_SIZE; pid++ )
+    {
+        for( ddt = 0u; ddt < (uint8)PFM_DDT_SIZE; ddt++ )
+        {
+            if( PFM_GETBIT(Pfm_FaultState[pid], ddt) )
+            {
+                snap->FaultState[ddt][pid >> 5u] |= (uint32)1u << (pid & 0x1Fu);
+            }
+            else
+            {
+                /* nothing to do */
+            }
+        }
+        if( Pfm_InterceptEnable[pid] != (boolean)FALSE )
+        {
+            snap->Intercept[pid >> 5u] |= (uint32)1u << (pid & 0x1Fu);
+        }
+        else
+        {
+            /* nothing to do */
+        }
+    }
+    snap->Generation = gen;
+    /* payload complete before the generation publishes it */
+    COMPILER_MEMORY_BARRIER();
+    Pfm_SnapshotGen = gen;
+}
+
+/****************************************************************
+ process: Pfm_GetSnapshotGeneration
+ purpose: Generation of the latest published snapshot, readers can
+          skip the copy when it did not change
+ ****************************************************************/
+uint32 Pfm_GetSnapshotGeneration(void)
+{
+    return Pfm_SnapshotGen;
+}
+
+/****************************************************************
+ process: Pfm_GetSnapshot
+ purpose: Copy out a coherent image of all fault states without
+          locking Pfm. The copy is retried if Pfm_10ms published
+          again meanwhile, as the next cycle reuses the buffer.
+ ****************************************************************/
+void Pfm_GetSnapshot( PFM_Snapshot_t* Snapshot )
+{
+    uint32 gen;
+
+    if( Snapshot != NULL_PTR )
+    {
+        do
+        {
+            gen = Pfm_SnapshotGen;
+            /* the copy is neither started before the generation is read nor
+               finished after it is checked again */
+            COMPILER_MEMORY_BARRIER();
+            *Snapshot = Pfm_SnapshotBuf[gen & 1u];
+            COMPILER_MEMORY_BARRIER();
+        } while( gen != Pfm_SnapshotGen );
+    }
+    else
+    {
+        /* nothing to do */
+    }
+}
+/****************************************************************
+ process: Pfm_ChatterTransition
+ purpose: Count a fault state transition of a PID. A PID whose
+          bucket reaches PFM_CHATTER_ON_LEVEL is intermittent.
+ ****************************************************************/
+static void Pfm_ChatterTransition(uint8 pid)
+{
+    if( Pfm_ChatterLevel[pid] < (uint8)(0xFFu - PFM_CHATTER_STEP) )
+    {
+        Pfm_ChatterLevel[pid] += PFM_CHATTER_STEP;
+    }
+    else
+    {
+        Pfm_ChatterLevel[pid] = 0xFFu;
+    }
+
+    if( Pfm_ChatterLevel[pid] >= PFM_CHATTER_ON_LEVEL )
+    {
+        Pfm_Intermittent[pid] = TRUE;
+    }
+    else
+    {
+        /* nothing to do */
+    }
+}
+
+/****************************************************************
+ process: Pfm_ChatterLeak
+ purpose: Drain all buckets by one every PFM_CHATTER_LEAK_TIME.
+          A PID leaves the intermittent state at PFM_CHATTER_OFF_LEVEL.
+ ****************************************************************/
+static void Pfm_ChatterLeak(void)
+{
+    uint8 i;
+    uint8 pid;
+
+    Pfm_ChatterTick++;
+    if( Pfm_ChatterTick >= PFM_CHATTER_LEAK_TIME )
+    {
+        Pfm_ChatterTick = 0u;
+        for( i = 0u; i < Pfm_ActivePidNum; i++ )
+        {
+            pid = Pfm_ActivePid[i];
+            if( Pfm_ChatterLevel[pid] > 0u )
+            {
+                Pfm_ChatterLevel[pid]--;
+            }
+            else
+            {
+                /* nothing to do */
+            }
+
+            if( Pfm_ChatterLevel[pid] <= PFM_CHATTER_OFF_LEVEL )
+            {
+                Pfm_Intermittent[pid] = FALSE;
+            }
+            else
+            {
+                /* nothing to do */
+            }
+        }
+    }
+    else
+    {
+        /* nothing to do */
+    }
+}
+
+/****************************************************************
+ process: Pfm_SetFault
+ purpose: Confirm a defect. An intermittent PID reports to DEM only
+          on the transition, not on every confirmation.
+ ****************************************************************/
+static void Pfm_SetFault(uint8 pid, uint8 ddt)
+{
+    if( !PFM_GETBIT(Pfm_FaultState[pid], ddt) )
+    {
+        Pfm_ChatterTransition(pid);
+        PFM_SETBIT(Pfm_FaultState[pid], ddt);
+        Pfm_StateChanged = TRUE;
+        Pfm_ReportError2DEM(Pfm_DefectDtcId[pid][ddt]);
+    }
+    else if( Pfm_Intermittent[pid] == (boolean)FALSE )
+    {
+        Pfm_ReportError2DEM(Pfm_DefectDtcId[pid][ddt]);
+    }
+    else
+    {
+        /* intermittent, state held */
+    }
 }
+
+/****************************************************************
+ process: Pfm_ClrFault
+ purpose: Heal a defect. An intermittent PID holds its fault state
+          until the bucket has drained, so a flapping input gives
+          one FAILED report instead of a FAILED/PASSED sequence.
+ ****************************************************************/
+static void Pfm_ClrFault(uint8 pid, uint8 ddt)
+{
+    if( Pfm_Intermittent[pid] != (boolean)FALSE )
+    {
+        /* intermittent, state held */
+    }
+    else if( PFM_GETBIT(Pfm_FaultState[pid], ddt) )
+    {
+        Pfm_ChatterTransition(pid);
+        if( Pfm_Intermittent[pid] == (boolean)FALSE )
+        {
+            PFM_CLRBIT(Pfm_FaultState[pid], ddt);
+            Pfm_StateChanged = TRUE;
+            Pfm_ClearError2DEM(Pfm_DefectDtcId[pid][ddt]);
+        }
+        else
+        {
+            /* just became intermittent, keep the fault */
+        }
+    }
+    else
+    {
+        Pfm_ClearError2DEM(Pfm_DefectDtcId[pid][ddt]);
+    }
+}
+
+/****************************************************************
+ process: Pfm_GetIntermittent
+ purpose: Acquire the chattering classification of a channel
+ ****************************************************************/
+boolean Pfm_GetIntermittent( PFM_PhysicalId_e Pid )
+{
+    boolean retval = FALSE;
+
+    if( Pid < PFM_PID_SIZE )
+    {
+        retval = Pfm_Intermittent[Pid];
+    }
+    return retval;
+}
+
+/****************************************************************
+ process: Pfm_UpdateEnableCondition
+ purpose: Evaluate the enable conditions once per cycle into a
+          bitmask. Voltage windows use a hysteresis, the settle
+          time restarts on switch off and during cranking.
+ ****************************************************************/
+static void Pfm_UpdateEnableCondition(void)
+{
+    uint16 vbat = (uint16)PFM_ENC_GET_VBAT_MV();
+    uint8 cond = Pfm_EnableCondition;
+
+    if( vbat < PFM_ENC_VBAT_LOW_MV )
+    {
+        cond &= (uint8)~PFM_ENC_MASK(PFM_ENC_NO_UNDERVOLT);
+    }
+    else if( vbat >= (PFM_ENC_VBAT_LOW_MV + PFM_ENC_VBAT_HYST_MV) )
+    {
+        cond |= PFM_ENC_MASK(PFM_ENC_NO_UNDERVOLT);
+    }
+    else
+    {
+        /* hysteresis band, keep state */
+    }
+
+    if( vbat > PFM_ENC_VBAT_HIGH_MV )
+    {
+        cond &= (uint8)~PFM_ENC_MASK(PFM_ENC_NO_OVERVOLT);
+    }
+    else if( vbat <= (PFM_ENC_VBAT_HIGH_MV - PFM_ENC_VBAT_HYST_MV) )
+    {
+        cond |= PFM_ENC_MASK(PFM_ENC_NO_OVERVOLT);
+    }
+    else
+    {
+        /* hysteresis band, keep state */
+    }
+
+    if( PFM_ENC_GET_CRANK() != (boolean)FALSE )
+    {
+        cond &= (uint8)~PFM_ENC_MASK(PFM_ENC_NO_CRANK);
+        Pfm_SettleTimer = 0u;
+    }
+    else
+    {
+        cond |= PFM_ENC_MASK(PFM_ENC_NO_CRANK);
+        if( PFM_ENC_GET_IGN_ON() == (boolean)FALSE )
+        {
+            Pfm_SettleTimer = 0u;
+        }
+        else if( Pfm_SettleTimer < PFM_ENC_SETTLE_TIME )
+        {
+            Pfm_SettleTimer++;
+        }
+        else
+        {
+            /* settled */
+        }
+    }
+
+    if( Pfm_SettleTimer >= PFM_ENC_SETTLE_TIME )
+    {
+        cond |= PFM_ENC_MASK(PFM_ENC_SETTLED);
+    }
+    else
+    {
+        cond &= (uint8)~PFM_ENC_MASK(PFM_ENC_SETTLED);
+    }
+
+    Pfm_EnableCondition = cond;
+}
+
+/****************************************************************
+ process: Pfm_GetEnableCondition
+ purpose: Enable conditions of the current cycle, drivers can use
+          them instead of their own voltage window checks
+ ****************************************************************/
+uint8 Pfm_GetEnableCondition(void)
+{
+    return Pfm_EnableCondition;
+}
+
 /****************************************************************
  process: Pfm_EnableDiagnostic
  purpose: Enable/Disable diagnostic for a specific fault device
@@ -197,6 +635,9 @@ void Pfm_ClearFault(uint8 Id)
     }
     Pfm_InterceptEnable[Id] = FALSE;
     Pfm_FaultState[Id] = 0u;
+    Pfm_ChatterLevel[Id] = 0u;
+    Pfm_Intermittent[Id] = FALSE;
+    Pfm_StateChanged = TRUE;
 }
 
 /****************************************************************
@@ -212,10 +653,13 @@ void Pfm_ClearFaultAll(void)
     {
         Pfm_InterceptEnable[pid] = FALSE;
         Pfm_FaultState[pid] = 0u;
+        Pfm_ChatterLevel[pid] = 0u;
+        Pfm_Intermittent[pid] = FALSE;
         Pfm_DefectDetectState[pid][PFM_DDT_VCC] = PFM_DDS_CLR;
         Pfm_DefectDetectState[pid][PFM_DDT_GND] = PFM_DDS_CLR;
         Pfm_DefectDetectState[pid][PFM_DDT_OL]  = PFM_DDS_CLR;
     }
+    Pfm_StateChanged = TRUE;
 }
 
 /****************************************************************
@@ -260,6 +704,10 @@ boolean Pfm_GetFaultState( PFM_PhysicalId_e Pid, uint8 Ddt)
     return retval;
 }
 
+/****************************************************************
+ process: Pfm_ReportError2DEM
+ purpose: Stage a FAILED status, submitted by Pfm_FlushDEM
+ ****************************************************************/
 static void Pfm_ReportError2DEM(const uint16 dtcId)
 {
 #if (PFM_DEM_ERROR_ENABLE_FLG == TRUE)
@@ -269,11 +717,16 @@ static void Pfm_ReportError2DEM(const uint16 dtcId)
     }
     else
     {
-        (void)Dem_SetEventStatus(dtcId, DEM_EVENT_STATUS_FAILED); 
+        Pfm_DemStaged[PFM_DTC_WORD(dtcId)] |= PFM_DTC_MASK(dtcId);
+        Pfm_DemFailed[PFM_DTC_WORD(dtcId)] |= PFM_DTC_MASK(dtcId);
     }
 #endif
 }
 
+/****************************************************************
+ process: Pfm_ClearError2DEM
+ purpose: Stage a PASSED status, submitted by Pfm_FlushDEM
+ ****************************************************************/
 static void Pfm_ClearError2DEM(const uint16 dtcId)
 {
 #if (PFM_DEM_ERROR_ENABLE_FLG == TRUE)
@@ -283,7 +736,55 @@ static void Pfm_ClearError2DEM(const uint16 dtcId)
     }
     else
     {
-        (void)Dem_SetEventStatus(dtcId, DEM_EVENT_STATUS_PASSED); 
+        Pfm_DemStaged[PFM_DTC_WORD(dtcId)] |= PFM_DTC_MASK(dtcId);
+        Pfm_DemFailed[PFM_DTC_WORD(dtcId)] &= ~PFM_DTC_MASK(dtcId);
+    }
+#endif
+}
+
+/****************************************************************
+ process: Pfm_FlushDEM
+ purpose: Submit the staged DTCs to DEM in ascending id order.
+          A DTC reported several times in one cycle (several PIDs
+          sharing a DTC, or SET/CLR states) is submitted once with
+          its last status.
+ ****************************************************************/
+static void Pfm_FlushDEM(void)
+{
+#if (PFM_DEM_ERROR_ENABLE_FLG == TRUE)
+    uint16 word;
+    uint16 dtcId;
+    uint32 staged;
+
+    for( word = 0u; word < (uint16)PFM_DTC_WORD_SIZE; word++ )
+    {
+        staged = Pfm_DemStaged[word];
+        if( staged != 0u )
+        {
+            Pfm_DemStaged[word] = 0u;
+            for( dtcId = (uint16)(word << 5u); staged != 0u; dtcId++, staged >>= 1u )
+            {
+                if( (staged & 1u) != 0u )
+                {
+                    if( (Pfm_DemFailed[word] & PFM_DTC_MASK(dtcId)) != 0u )
+                    {
+                        (void)Dem_SetEventStatus(dtcId, DEM_EVENT_STATUS_FAILED);
+                    }
+                    else
+                    {
+                        (void)Dem_SetEventStatus(dtcId, DEM_EVENT_STATUS_PASSED);
+                    }
+                }
+                else
+                {
+                    /* nothing to do */
+                }
+            }
+        }
+        else
+        {
+            /* nothing to do */
+        }
     }
 #endif
 }
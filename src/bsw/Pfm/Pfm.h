@@ -29,11 +29,23 @@
    DDS: Defect Detect State - current state of defect detection
 */
 
+/* Snapshot of all fault and intercept states, one bit per PID */
+#define PFM_PID_WORD_SIZE           (((uint16)PFM_PID_SIZE + 31u) / 32u)
+
+typedef struct
+{
+    uint32 Generation;                                  /* Pfm_10ms cycle that produced the image */
+    uint32 FaultState[PFM_DDT_SIZE][PFM_PID_WORD_SIZE]; /* bit pid of word pid/32, per DDT */
+    uint32 Intercept[PFM_PID_WORD_SIZE];
+} PFM_Snapshot_t;
+
 extern boolean Pfm_InterceptEnable[PFM_PID_SIZE];
 
 extern void Pfm_Init(void);
 extern void Pfm_10ms(void);
+extern void Pfm_Shutdown(void);
 extern void Pfm_EnableDiagnostic(uint8 Id, boolean Enable);
+extern uint8 Pfm_GetEnableCondition(void);
 
 extern void Pfm_DefectReport(  PFM_PhysicalId_e Pid, 
                               PFM_DefectDetectState_e OpenLoad, 
@@ -43,6 +55,9 @@ extern void Pfm_DefectReport(  PFM_PhysicalId_e Pid,
 extern void Pfm_ClearFault(uint8 Id);
 extern void Pfm_ClearFaultAll(void);
 extern boolean Pfm_GetFaultState( PFM_PhysicalId_e Pid, uint8 Ddt);
+extern boolean Pfm_GetIntermittent( PFM_PhysicalId_e Pid );
+extern uint32 Pfm_GetSnapshotGeneration(void);
+extern void Pfm_GetSnapshot( PFM_Snapshot_t* Snapshot );
 
 #endif
 
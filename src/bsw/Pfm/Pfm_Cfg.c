@@ -1,16 +1,16 @@
 /*****************************************************************************************************************
 ******************************************************************************************************************
-*  Copyright (C) .                                                                            
-*  All rights reserved.                                                                                           
+*  Copyright (C) .
+*  All rights reserved.
 ******************************************************************************************************************
-*  FileName: Pfm                                                                                             
+*  FileName: Pfm
 *  Content:  Power device fault management module source file.
-*  Category: 
+*  Category: generated by script/chnreggen/csv2chnreg.py from IoChnReg.csv, do not edit
 ******************************************************************************************************************
-*  Revision Management                                                                                            
-*  yyyy.mm.dd    name              version      description                                                       
-*  ----------    --------          -------      -----------------------------------                               
-*  2025.12.30    clipping            v0001        Frist edit                                                        
+*  Revision Management
+*  yyyy.mm.dd    name              version      description
+*  ----------    --------          -------      -----------------------------------
+*  2026.01.09    clipping            v0001        Frist edit
 ******************************************************************************************************************
 ******************************************************************************************************************/
 
@@ -27,28 +27,155 @@
 
 const uint8 Pfm_DefectFilterTime[PFM_PID_SIZE][PFM_DDT_SIZE][PFM_DFC_SIZE] = 
 {
-    {{0,0},{0,0},{0,0}},        /* PFM_PID_DUMMTY*/
+    {{0,0},{0,0},{0,0}},    /* PFM_PID_DUMMTY */
+    {{10,10},{10,10},{10,10}},    /* PFM_PID_HSDC_OUT0 */
+    {{10,10},{10,10},{10,10}},    /* PFM_PID_HSDC_OUT1 */
+    {{10,10},{10,10},{10,10}},    /* PFM_PID_HSDC_OUT2 */
+    {{10,10},{10,10},{10,10}},    /* PFM_PID_HSDC_OUT3 */
+    {{10,10},{10,10},{10,10}},    /* PFM_PID_HSDC_OUT4 */
+    {{10,10},{10,10},{10,10}},    /* PFM_PID_HSDC_OUT5 */
+    {{10,10},{10,10},{10,10}},    /* PFM_PID_HSDC_OUT6 */
+    {{10,10},{10,10},{10,10}},    /* PFM_PID_HSDC_OUT7 */
+    {{10,10},{10,10},{10,10}},    /* PFM_PID_OPH02 */
+    {{10,10},{10,10},{10,10}},    /* PFM_PID_OPH01 */
+    {{5,20},{5,20},{5,20}},    /* PFM_PID_HBD0_OUT1 */
+    {{5,20},{5,20},{5,20}},    /* PFM_PID_HBD0_OUT2 */
+    {{5,20},{5,20},{5,20}},    /* PFM_PID_HBD0_OUT3 */
+    {{5,20},{5,20},{5,20}},    /* PFM_PID_HBD0_OUT4 */
+    {{5,20},{5,20},{5,20}},    /* PFM_PID_HBD1_OUT1 */
+    {{5,20},{5,20},{5,20}},    /* PFM_PID_HBD1_OUT2 */
+    {{5,20},{5,20},{5,20}},    /* PFM_PID_HBD1_OUT3 */
+    {{5,20},{5,20},{5,20}},    /* PFM_PID_HBD1_OUT4 */
+    {{5,20},{5,20},{5,20}},    /* PFM_PID_GDU0_HB1 */
+    {{5,20},{5,20},{5,20}},    /* PFM_PID_GDU0_HB2 */
+    {{5,20},{5,20},{5,20}},    /* PFM_PID_GDU1_HB1 */
+    {{5,20},{5,20},{5,20}},    /* PFM_PID_GDU1_HB2 */
+    {{5,20},{5,20},{5,20}},    /* PFM_PID_GDU2_HB1 */
+    {{5,20},{5,20},{5,20}},    /* PFM_PID_GDU2_HB2 */
 };
 
 
 /* bit0: short to VCC, bit 1: short to GND, bit 2: Open load */
 const uint8 Pfm_InterceptEnableMask[PFM_PID_SIZE] = 
 {
-    0,        /* PFM_PID_DUMMTY */
+    0,    /* PFM_PID_DUMMTY */
+    0x01,    /* PFM_PID_HSDC_OUT0 */
+    0x01,    /* PFM_PID_HSDC_OUT1 */
+    0x01,    /* PFM_PID_HSDC_OUT2 */
+    0x01,    /* PFM_PID_HSDC_OUT3 */
+    0x01,    /* PFM_PID_HSDC_OUT4 */
+    0x01,    /* PFM_PID_HSDC_OUT5 */
+    0x01,    /* PFM_PID_HSDC_OUT6 */
+    0x01,    /* PFM_PID_HSDC_OUT7 */
+    0x01,    /* PFM_PID_OPH02 */
+    0x01,    /* PFM_PID_OPH01 */
+    0x03,    /* PFM_PID_HBD0_OUT1 */
+    0x03,    /* PFM_PID_HBD0_OUT2 */
+    0x03,    /* PFM_PID_HBD0_OUT3 */
+    0x03,    /* PFM_PID_HBD0_OUT4 */
+    0x03,    /* PFM_PID_HBD1_OUT1 */
+    0x03,    /* PFM_PID_HBD1_OUT2 */
+    0x03,    /* PFM_PID_HBD1_OUT3 */
+    0x03,    /* PFM_PID_HBD1_OUT4 */
+    0x01,    /* PFM_PID_GDU0_HB1 */
+    0x01,    /* PFM_PID_GDU0_HB2 */
+    0x01,    /* PFM_PID_GDU1_HB1 */
+    0x01,    /* PFM_PID_GDU1_HB2 */
+    0x01,    /* PFM_PID_GDU2_HB1 */
+    0x01,    /* PFM_PID_GDU2_HB2 */
 };
 
 
 const boolean Pfm_InterceptState[PFM_PID_SIZE] = 
 {
-    FALSE,    /* PFM_PID_DUMMTY*/
+    FALSE,    /* PFM_PID_DUMMTY */
+    FALSE,    /* PFM_PID_HSDC_OUT0 */
+    FALSE,    /* PFM_PID_HSDC_OUT1 */
+    FALSE,    /* PFM_PID_HSDC_OUT2 */
+    FALSE,    /* PFM_PID_HSDC_OUT3 */
+    FALSE,    /* PFM_PID_HSDC_OUT4 */
+    FALSE,    /* PFM_PID_HSDC_OUT5 */
+    FALSE,    /* PFM_PID_HSDC_OUT6 */
+    FALSE,    /* PFM_PID_HSDC_OUT7 */
+    FALSE,    /* PFM_PID_OPH02 */
+    FALSE,    /* PFM_PID_OPH01 */
+    FALSE,    /* PFM_PID_HBD0_OUT1 */
+    FALSE,    /* PFM_PID_HBD0_OUT2 */
+    FALSE,    /* PFM_PID_HBD0_OUT3 */
+    FALSE,    /* PFM_PID_HBD0_OUT4 */
+    FALSE,    /* PFM_PID_HBD1_OUT1 */
+    FALSE,    /* PFM_PID_HBD1_OUT2 */
+    FALSE,    /* PFM_PID_HBD1_OUT3 */
+    FALSE,    /* PFM_PID_HBD1_OUT4 */
+    FALSE,    /* PFM_PID_GDU0_HB1 */
+    FALSE,    /* PFM_PID_GDU0_HB2 */
+    FALSE,    /* PFM_PID_GDU1_HB1 */
+    FALSE,    /* PFM_PID_GDU1_HB2 */
+    FALSE,    /* PFM_PID_GDU2_HB1 */
+    FALSE,    /* PFM_PID_GDU2_HB2 */
 };
 
 
 /* configuatre the DTC-ID, need mapping to DEM module and DTC description */
-const uint16 Pfm_DefectDtcId[PFM_PID_SIZE][PFM_DDT_SIZE] =
+const uint16 Pfm_DefectDtcId[PFM_PID_SIZE][PFM_DDT_SIZE] = 
 {
     /* short to battery */    /* short to ground */     /* open load */
-    {DTC_MAX,                 DTC_MAX,                  DTC_MAX},                 /* DUMMY */
+    {DTC_MAX,                 DTC_MAX,                  DTC_MAX},    /* PFM_PID_DUMMTY */
+    {DTC_MAX,                 DTC_MAX,                  DTC_MAX},    /* PFM_PID_HSDC_OUT0 */
+    {DTC_MAX,                 DTC_MAX,                  DTC_MAX},    /* PFM_PID_HSDC_OUT1 */
+    {DTC_MAX,                 DTC_MAX,                  DTC_MAX},    /* PFM_PID_HSDC_OUT2 */
+    {DTC_MAX,                 DTC_MAX,                  DTC_MAX},    /* PFM_PID_HSDC_OUT3 */
+    {DTC_MAX,                 DTC_MAX,                  DTC_MAX},    /* PFM_PID_HSDC_OUT4 */
+    {DTC_MAX,                 DTC_MAX,                  DTC_MAX},    /* PFM_PID_HSDC_OUT5 */
+    {DTC_MAX,                 DTC_MAX,                  DTC_MAX},    /* PFM_PID_HSDC_OUT6 */
+    {DTC_MAX,                 DTC_MAX,                  DTC_MAX},    /* PFM_PID_HSDC_OUT7 */
+    {DTC_MAX,                 DTC_MAX,                  DTC_MAX},    /* PFM_PID_OPH02 */
+    {DTC_MAX,                 DTC_MAX,                  DTC_MAX},    /* PFM_PID_OPH01 */
+    {DTC_MAX,                 DTC_MAX,                  DTC_MAX},    /* PFM_PID_HBD0_OUT1 */
+    {DTC_MAX,                 DTC_MAX,                  DTC_MAX},    /* PFM_PID_HBD0_OUT2 */
+    {DTC_MAX,                 DTC_MAX,                  DTC_MAX},    /* PFM_PID_HBD0_OUT3 */
+    {DTC_MAX,                 DTC_MAX,                  DTC_MAX},    /* PFM_PID_HBD0_OUT4 */
+    {DTC_MAX,                 DTC_MAX,                  DTC_MAX},    /* PFM_PID_HBD1_OUT1 */
+    {DTC_MAX,                 DTC_MAX,                  DTC_MAX},    /* PFM_PID_HBD1_OUT2 */
+    {DTC_MAX,                 DTC_MAX,                  DTC_MAX},    /* PFM_PID_HBD1_OUT3 */
+    {DTC_MAX,                 DTC_MAX,                  DTC_MAX},    /* PFM_PID_HBD1_OUT4 */
+    {DTC_MAX,                 DTC_MAX,                  DTC_MAX},    /* PFM_PID_GDU0_HB1 */
+    {DTC_MAX,                 DTC_MAX,                  DTC_MAX},    /* PFM_PID_GDU0_HB2 */
+    {DTC_MAX,                 DTC_MAX,                  DTC_MAX},    /* PFM_PID_GDU1_HB1 */
+    {DTC_MAX,                 DTC_MAX,                  DTC_MAX},    /* PFM_PID_GDU1_HB2 */
+    {DTC_MAX,                 DTC_MAX,                  DTC_MAX},    /* PFM_PID_GDU2_HB1 */
+    {DTC_MAX,                 DTC_MAX,                  DTC_MAX},    /* PFM_PID_GDU2_HB2 */
+};
+
+
+/* enable conditions a PID needs before its defects are filtered, see PFM_EnableCondition_e */
+const uint8 Pfm_EnableConditionMask[PFM_PID_SIZE] = 
+{
+    PFM_ENC_ALL,    /* PFM_PID_DUMMTY */
+    PFM_ENC_ALL,    /* PFM_PID_HSDC_OUT0 */
+    PFM_ENC_ALL,    /* PFM_PID_HSDC_OUT1 */
+    PFM_ENC_ALL,    /* PFM_PID_HSDC_OUT2 */
+    PFM_ENC_ALL,    /* PFM_PID_HSDC_OUT3 */
+    PFM_ENC_ALL,    /* PFM_PID_HSDC_OUT4 */
+    PFM_ENC_ALL,    /* PFM_PID_HSDC_OUT5 */
+    PFM_ENC_ALL,    /* PFM_PID_HSDC_OUT6 */
+    PFM_ENC_ALL,    /* PFM_PID_HSDC_OUT7 */
+    PFM_ENC_ALL,    /* PFM_PID_OPH02 */
+    PFM_ENC_ALL,    /* PFM_PID_OPH01 */
+    PFM_ENC_ALL,    /* PFM_PID_HBD0_OUT1 */
+    PFM_ENC_ALL,    /* PFM_PID_HBD0_OUT2 */
+    PFM_ENC_ALL,    /* PFM_PID_HBD0_OUT3 */
+    PFM_ENC_ALL,    /* PFM_PID_HBD0_OUT4 */
+    PFM_ENC_ALL,    /* PFM_PID_HBD1_OUT1 */
+    PFM_ENC_ALL,    /* PFM_PID_HBD1_OUT2 */
+    PFM_ENC_ALL,    /* PFM_PID_HBD1_OUT3 */
+    PFM_ENC_ALL,    /* PFM_PID_HBD1_OUT4 */
+    PFM_ENC_ALL,    /* PFM_PID_GDU0_HB1 */
+    PFM_ENC_ALL,    /* PFM_PID_GDU0_HB2 */
+    PFM_ENC_ALL,    /* PFM_PID_GDU1_HB1 */
+    PFM_ENC_ALL,    /* PFM_PID_GDU1_HB2 */
+    PFM_ENC_ALL,    /* PFM_PID_GDU2_HB1 */
+    PFM_ENC_ALL,    /* PFM_PID_GDU2_HB2 */
 };
 
 
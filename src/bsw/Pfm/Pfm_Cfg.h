@@ -19,6 +19,7 @@
 #ifndef _PFM_CFG_H
 #define _PFM_CFG_H
 #include "Pfm_Types.h"
+#include "IoChnReg_Pid.h"
 
 /***********************    Global Type Definition    ************************/
 
@@ -32,13 +33,7 @@
 
 /***********************    Global Type Definition    ************************/
 
-/*chip of group list order: from left to right, from top to dowm */
-typedef enum
-{
-    PFM_PID_DUMMTY,
-
-    PFM_PID_SIZE
-} PFM_PhysicalId_e;
+/* PFM_PhysicalId_e is generated into IoChnReg_Pid.h by script/chnreggen/csv2chnreg.py */
 
 
 /* Match with the index of Dem_Cfg_DtcTable[] in Dem_Lcfg.c*/
@@ -54,6 +49,38 @@ enum
 #define PFM_DEM_ERROR_ENABLE_FLG    1U   //gDEM_bDiagErrorEnableFlg
 
 
+/* Enable conditions, evaluated once per Pfm_10ms */
+#define PFM_ENC_MASK(enc)           ((uint8)1u << (enc))
+#define PFM_ENC_ALL                 (PFM_ENC_MASK(PFM_ENC_NO_UNDERVOLT) | PFM_ENC_MASK(PFM_ENC_NO_OVERVOLT) \
+                                    | PFM_ENC_MASK(PFM_ENC_NO_CRANK) | PFM_ENC_MASK(PFM_ENC_SETTLED))
+
+#define PFM_ENC_VBAT_LOW_MV         9000u   /* under voltage below this */
+#define PFM_ENC_VBAT_HIGH_MV        16000u  /* over voltage above this */
+#define PFM_ENC_VBAT_HYST_MV        300u    /* hysteresis to leave under/over voltage */
+#define PFM_ENC_SETTLE_TIME         50u     /* 10ms ticks after switch on or cranking */
+
+/* Callouts to the project signals */
+#define PFM_ENC_GET_VBAT_MV()       (12000u)
+#define PFM_ENC_GET_CRANK()         (FALSE)
+#define PFM_ENC_GET_IGN_ON()        (TRUE)
+
+
+/* Chattering classification, leaky bucket per PID */
+#define PFM_CHATTER_STEP            16u     /* bucket fill per confirmed fault state transition */
+#define PFM_CHATTER_LEAK_TIME       10u     /* 10ms ticks per bucket drain step */
+#define PFM_CHATTER_ON_LEVEL        64u     /* intermittent at or above, 4 transitions in a short time */
+#define PFM_CHATTER_OFF_LEVEL       0u      /* stable again at or below */
+
+
+/* Persistent fault state, see Pfm_Nv.h. Define PFM_NV_HOST_FILE to back the block by a file */
+#define PFM_NV_ENABLE_FLG           1U
+#define PFM_NV_WRITE_INTERVAL       100u    /* 10ms ticks between two writes, changes are coalesced */
+
+/* NvM block on target: PFM_NV_BLOCK_SIZE words, permanent RAM block Pfm_NvRamBlock,
+   read by NvM_ReadAll */
+#define PFM_NV_NVM_BLOCK_ID         NvMConf_NvMBlockDescriptor_NvMBlock_Pfm
+
+
 /**************************  Macro Definitions    **************************/
 
 /* Abbreviations used in macro names:
@@ -72,6 +99,7 @@ extern const uint8 Pfm_DefectFilterTime[PFM_PID_SIZE][PFM_DDT_SIZE][PFM_DFC_SIZE
 extern const uint16 Pfm_DefectDtcId[PFM_PID_SIZE][PFM_DDT_SIZE];
 extern const uint8 Pfm_InterceptEnableMask[PFM_PID_SIZE];
 extern const boolean Pfm_InterceptState[PFM_PID_SIZE];
+extern const uint8 Pfm_EnableConditionMask[PFM_PID_SIZE];
 
 #endif // _PFM_CFG_H
 
@@ -0,0 +1,330 @@
+/*****************************************************************************************************************
+******************************************************************************************************************
+*  Copyright (C) .                                                                            
+*  All rights reserved.                                                                                           
+******************************************************************************************************************
+*  FileName: Pfm_Nv                                                                                             
+*  Content:  Power device fault management persistent storage source file.
+*  Category: 
+******************************************************************************************************************
+*  Revision Management                                                                                            
+*  yyyy.mm.dd    name              version      description                                                       
+*  ----------    --------          -------      -----------------------------------                               
+*  2026.01.08    clipping            v0001        Frist edit                                                        
+******************************************************************************************************************
+******************************************************************************************************************/
+
+/* Include Headerfiles  */
+/* ===================                                                  */
+#include "Pfm_Nv.h"
+#include <string.h>
+#if defined(PFM_NV_HOST_FILE)
+#include <stdio.h>
+#else
+#include "NvM.h"
+#endif
+
+/* Local Module RAM-Definitions (attribute static)                      */
+/* ===========================================                          */
+#if (PFM_NV_ENABLE_FLG == TRUE)
+/* content of the block as last written to the storage */
+static uint32 Pfm_NvShadow[PFM_NV_BLOCK_SIZE];
+static uint16 Pfm_NvWriteTimer;
+#if !defined(PFM_NV_HOST_FILE)
+/* permanent RAM block of PFM_NV_NVM_BLOCK_ID, filled by NvM_ReadAll before Pfm_Init */
+uint32 Pfm_NvRamBlock[PFM_NV_BLOCK_SIZE];
+#endif
+#endif
+
+/*****************    Local Functions Declaration    ******************/
+#if (PFM_NV_ENABLE_FLG == TRUE)
+static uint32 Pfm_NvChecksum( const uint32* Payload );
+static Std_ReturnType Pfm_NvReadBlock( uint32* Block );
+static void Pfm_NvWriteWord( uint16 Index, uint32 Value );
+static void Pfm_NvCommit( void );
+static boolean Pfm_NvIsIdle( void );
+static void Pfm_NvWriteChanged( const uint32* Payload );
+#endif
+
+/************************************************************************/
+/*                 Storage backend                                      */
+/************************************************************************/
+#if (PFM_NV_ENABLE_FLG == TRUE)
+#if defined(PFM_NV_HOST_FILE)
+/****************************************************************
+ process: Pfm_NvReadBlock
+ purpose: Host build, the block is a file of native 32 bit words
+ ****************************************************************/
+static Std_ReturnType Pfm_NvReadBlock( uint32* Block )
+{
+    Std_ReturnType ret = E_NOT_OK;
+    FILE* fp = fopen(PFM_NV_HOST_FILE, "rb");
+
+    if( fp != NULL )
+    {
+        if( fread(Block, sizeof(uint32), PFM_NV_BLOCK_SIZE, fp) == (size_t)PFM_NV_BLOCK_SIZE )
+        {
+            ret = E_OK;
+        }
+        (void)fclose(fp);
+    }
+    return ret;
+}
+
+/****************************************************************
+ process: Pfm_NvWriteWord
+ purpose: Host build, overwrite one word of the block file
+ ****************************************************************/
+static void Pfm_NvWriteWord( uint16 Index, uint32 Value )
+{
+    FILE* fp = fopen(PFM_NV_HOST_FILE, "r+b");
+
+    if( fp == NULL )
+    {
+        fp = fopen(PFM_NV_HOST_FILE, "w+b");
+    }
+    if( fp != NULL )
+    {
+        if( fseek(fp, (long)Index * (long)sizeof(uint32), SEEK_SET) == 0 )
+        {
+            (void)fwrite(&Value, sizeof(uint32), 1u, fp);
+        }
+        (void)fclose(fp);
+    }
+}
+
+/****************************************************************
+ process: Pfm_NvCommit
+ purpose: Host build, every word is in the file already
+ ****************************************************************/
+static void Pfm_NvCommit( void )
+{
+    /* nothing to do */
+}
+
+/****************************************************************
+ process: Pfm_NvIsIdle
+ purpose: Host build, the file is written synchronously
+ ****************************************************************/
+static boolean Pfm_NvIsIdle( void )
+{
+    return TRUE;
+}
+#else
+/****************************************************************
+ process: Pfm_NvReadBlock
+ purpose: Target build, take the RAM block read by NvM_ReadAll.
+          A block NvM could not read (never written, CRC error)
+          is not restored.
+ ****************************************************************/
+static Std_ReturnType Pfm_NvReadBlock( uint32* Block )
+{
+    Std_ReturnType ret = E_NOT_OK;
+    NvM_RequestResultType result = NVM_REQ_NOT_OK;
+
+    if( (NvM_GetErrorStatus(PFM_NV_NVM_BLOCK_ID, &result) == E_OK) && (result == NVM_REQ_OK) )
+    {
+        (void)memcpy((void *)Block, (const void *)Pfm_NvRamBlock, sizeof(Pfm_NvRamBlock));
+        ret = E_OK;
+    }
+    else
+    {
+        /* nothing to do */
+    }
+    return ret;
+}
+
+/****************************************************************
+ process: Pfm_NvWriteWord
+ purpose: Target build, update one word of the RAM block
+ ****************************************************************/
+static void Pfm_NvWriteWord( uint16 Index, uint32 Value )
+{
+    Pfm_NvRamBlock[Index] = Value;
+}
+
+/****************************************************************
+ process: Pfm_NvCommit
+ purpose: Target build, queue the write of the RAM block. The block
+          is marked changed first, a request NvM rejects because the
+          previous one is still pending is written by NvM_WriteAll.
+ ****************************************************************/
+static void Pfm_NvCommit( void )
+{
+    (void)NvM_SetRamBlockStatus(PFM_NV_NVM_BLOCK_ID, TRUE);
+    (void)NvM_WriteBlock(PFM_NV_NVM_BLOCK_ID, NULL_PTR);
+}
+
+/****************************************************************
+ process: Pfm_NvIsIdle
+ purpose: Target build, FALSE while a job of the block is pending:
+          NvM may still be copying the RAM block, it must not be
+          changed until the job is finished.
+ ****************************************************************/
+static boolean Pfm_NvIsIdle( void )
+{
+    boolean idle = TRUE;
+    NvM_RequestResultType result = NVM_REQ_OK;
+
+    if( (NvM_GetErrorStatus(PFM_NV_NVM_BLOCK_ID, &result) == E_OK) && (result == NVM_REQ_PENDING) )
+    {
+        idle = FALSE;
+    }
+    else
+    {
+        /* nothing to do */
+    }
+    return idle;
+}
+#endif
+
+/************************************************************************/
+/*                 Local Definitions                                    */
+/************************************************************************/
+static uint32 Pfm_NvChecksum( const uint32* Payload )
+{
+    uint16 i;
+    uint32 sum = PFM_NV_MAGIC;
+
+    for( i = 0u; i < (uint16)PFM_NV_PAYLOAD_SIZE; i++ )
+    {
+        sum = (((sum << 1u) | (sum >> 31u)) + Payload[i]) & 0xFFFFFFFFuL;
+    }
+    return (~sum) & 0xFFFFFFFFuL;
+}
+
+/****************************************************************
+ process: Pfm_NvWriteChanged
+ purpose: Write only the payload words that differ from the shadow,
+          then the checksum and, on the first write, the magic.
+ ****************************************************************/
+static void Pfm_NvWriteChanged( const uint32* Payload )
+{
+    uint16 i;
+    boolean changed = FALSE;
+    uint32 checksum;
+
+    for( i = 0u; i < (uint16)PFM_NV_PAYLOAD_SIZE; i++ )
+    {
+        if( Pfm_NvShadow[PFM_NV_HEADER_SIZE + i] != Payload[i] )
+        {
+            Pfm_NvShadow[PFM_NV_HEADER_SIZE + i] = Payload[i];
+            Pfm_NvWriteWord((uint16)(PFM_NV_HEADER_SIZE + i), Payload[i]);
+            changed = TRUE;
+        }
+        else
+        {
+            /* nothing to do */
+        }
+    }
+
+    if( changed != (boolean)FALSE )
+    {
+        checksum = Pfm_NvChecksum(&Pfm_NvShadow[PFM_NV_HEADER_SIZE]);
+        Pfm_NvShadow[1] = checksum;
+        Pfm_NvWriteWord(1u, checksum);
+        if( Pfm_NvShadow[0] != PFM_NV_MAGIC )
+        {
+            Pfm_NvShadow[0] = PFM_NV_MAGIC;
+            Pfm_NvWriteWord(0u, PFM_NV_MAGIC);
+        }
+        else
+        {
+            /* nothing to do */
+        }
+        Pfm_NvCommit();
+        Pfm_NvWriteTimer = PFM_NV_WRITE_INTERVAL;
+    }
+    else
+    {
+        /* nothing to do */
+    }
+}
+#endif
+
+/************************************************************************/
+/*                 Global Definitions                                   */
+/************************************************************************/
+/****************************************************************
+ process: Pfm_NvRestore
+ purpose: Read the block once at start up. The payload is returned
+          only if magic and checksum match.
+ ****************************************************************/
+Std_ReturnType Pfm_NvRestore( uint32* Payload )
+{
+    Std_ReturnType ret = E_NOT_OK;
+#if (PFM_NV_ENABLE_FLG == TRUE)
+    (void)memset((void *)Pfm_NvShadow, 0, sizeof(Pfm_NvShadow));
+    Pfm_NvWriteTimer = 0u;
+
+    if( Pfm_NvReadBlock(Pfm_NvShadow) == E_OK )
+    {
+        if( (Pfm_NvShadow[0] == PFM_NV_MAGIC)
+         && (Pfm_NvShadow[1] == Pfm_NvChecksum(&Pfm_NvShadow[PFM_NV_HEADER_SIZE])) )
+        {
+            (void)memcpy((void *)Payload, (const void *)&Pfm_NvShadow[PFM_NV_HEADER_SIZE], sizeof(uint32) * (uint16)PFM_NV_PAYLOAD_SIZE);
+            ret = E_OK;
+        }
+        else
+        {
+            /* invalid block, rewritten completely on the next change */
+            (void)memset((void *)Pfm_NvShadow, 0xFF, sizeof(Pfm_NvShadow));
+        }
+    }
+    else
+    {
+        (void)memset((void *)Pfm_NvShadow, 0xFF, sizeof(Pfm_NvShadow));
+    }
+#else
+    (void)Payload;
+#endif
+    return ret;
+}
+
+/****************************************************************
+ process: Pfm_NvUpdate
+ purpose: Called every Pfm cycle. Changes are coalesced, the storage
+          is written at most once per PFM_NV_WRITE_INTERVAL and not
+          before the previous write of the block is finished.
+ ****************************************************************/
+void Pfm_NvUpdate( const uint32* Payload )
+{
+#if (PFM_NV_ENABLE_FLG == TRUE)
+    if( Pfm_NvWriteTimer > 0u )
+    {
+        Pfm_NvWriteTimer--;
+    }
+    else if( Pfm_NvIsIdle() != (boolean)FALSE )
+    {
+        Pfm_NvWriteChanged(Payload);
+    }
+    else
+    {
+        /* previous write pending, the changes are taken next cycle */
+    }
+#else
+    (void)Payload;
+#endif
+}
+
+/****************************************************************
+ process: Pfm_NvFlush
+ purpose: Write pending changes regardless of the rate limit,
+          e.g. before shut down. While the previous write of the
+          block is pending the changes stay for Pfm_NvUpdate.
+ ****************************************************************/
+void Pfm_NvFlush( const uint32* Payload )
+{
+#if (PFM_NV_ENABLE_FLG == TRUE)
+    if( Pfm_NvIsIdle() != (boolean)FALSE )
+    {
+        Pfm_NvWriteChanged(Payload);
+    }
+    else
+    {
+        /* nothing to do */
+    }
+#else
+    (void)Payload;
+#endif
+}
@@ -0,0 +1,49 @@
+/*****************************************************************************************************************
+******************************************************************************************************************
+*  Copyright (C) .                                                                            
+*  All rights reserved.                                                                                           
+******************************************************************************************************************
+*  FileName: Pfm_Nv                                                                                             
+*  Content:  Power device fault management persistent storage header file.
+*  Category: 
+******************************************************************************************************************
+*  Revision Management                                                                                            
+*  yyyy.mm.dd    name              version      description                                                       
+*  ----------    --------          -------      -----------------------------------                               
+*  2026.01.08    clipping            v0001        Frist edit                                                        
+******************************************************************************************************************
+******************************************************************************************************************/
+
+/* Include Headerfiles  */
+
+#ifndef _PFM_NV_H
+#define _PFM_NV_H
+#include "Std_Types.h"
+#include "Pfm_Cfg.h"
+
+/* Block layout in 32 bit words:
+   [0] magic/version, [1] checksum of the payload, [2..] payload.
+   Payload: 4 bits per PID, 8 PIDs per word,
+   bit0..2 fault state (VCC, GND, OL), bit3 intercept latch.
+   The checksum is written after the payload, a block torn by a reset
+   fails the check and nothing is restored.
+*/
+#define PFM_NV_MAGIC                0x50464D01uL
+#define PFM_NV_HEADER_SIZE          2u
+#define PFM_NV_PAYLOAD_SIZE         (((uint16)PFM_PID_SIZE + 7u) / 8u)
+#define PFM_NV_BLOCK_SIZE           (PFM_NV_HEADER_SIZE + PFM_NV_PAYLOAD_SIZE)
+
+#define PFM_NV_PID_WORD(pid)        ((uint16)(pid) >> 3u)
+#define PFM_NV_PID_SHIFT(pid)       (((uint8)(pid) & 0x07u) << 2u)
+#define PFM_NV_INTERCEPT_BIT        0x08u
+
+#if (PFM_NV_ENABLE_FLG == TRUE) && !defined(PFM_NV_HOST_FILE)
+/* RAM block of the NvM block descriptor PFM_NV_NVM_BLOCK_ID */
+extern uint32 Pfm_NvRamBlock[PFM_NV_BLOCK_SIZE];
+#endif
+
+extern Std_ReturnType Pfm_NvRestore( uint32* Payload );
+extern void Pfm_NvUpdate( const uint32* Payload );
+extern void Pfm_NvFlush( const uint32* Payload );
+
+#endif // _PFM_NV_H
@@ -49,6 +49,17 @@ typedef enum
     PFM_DFC_SIZE
 } PFM_DefectFilterCount_e;
 
+/* Enable condition bit positions, a set bit means the condition is fulfilled */
+typedef enum
+{
+    PFM_ENC_NO_UNDERVOLT,
+    PFM_ENC_NO_OVERVOLT,
+    PFM_ENC_NO_CRANK,
+    PFM_ENC_SETTLED,
+
+    PFM_ENC_SIZE
+} PFM_EnableCondition_e;
+
 typedef struct
 {
     PFM_DefectDetectState_e Short2Vcc;
@@ -0,0 +1,117 @@
+/*****************************************************************************************************************
+******************************************************************************************************************
+*  Copyright (C) .
+*  All rights reserved.
+******************************************************************************************************************
+*  FileName: AdcCls
+*  Content:  ADC threshold classification library source file.
+*  Category: AdcCls
+******************************************************************************************************************
+*  Revision Management
+*  yyyy.mm.dd    name              version      description
+*  ----------    --------          -------      -----------------------------------
+*  2026.01.22    clipping            v0001        Frist edit
+******************************************************************************************************************
+******************************************************************************************************************/
+/* Include Headerfiles  */
+#include "AdcCls.h"
+
+#if (ADCCLS_SIMD_EN == STD_ON) && defined(__SSE2__)
+#include <emmintrin.h>
+#define ADCCLS_SSE2
+#elif (ADCCLS_SIMD_EN == STD_ON) && defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#define ADCCLS_NEON
+#endif
+
+/* high bit of each 16 bit lane, a lane compare leaves its result there */
+#define ADCCLS_SWAR_H   0x80008000uL
+
+/****************************************************************
+ process: AdcCls_Lane8
+ purpose: 8 channels from index i, bit k of the results is
+          channel i + k. Both masks are computed without a branch.
+ ****************************************************************/
+static void AdcCls_Lane8(const uint16* pu16Val, const uint16* pu16OlThr, const uint16* pu16ShortThr, uint32* pu32OlBits, uint32* pu32ShortBits)
+{
+#if defined(ADCCLS_SSE2)
+    __m128i l_tVal = _mm_loadu_si128((const __m128i*)(const void*)pu16Val);
+    __m128i l_tOlThr = _mm_loadu_si128((const __m128i*)(const void*)pu16OlThr);
+    __m128i l_tShortThr = _mm_loadu_si128((const __m128i*)(const void*)pu16ShortThr);
+    /* lanes are below 0x8000, so the signed compare is exact; value <= threshold is !(value > threshold) */
+    __m128i l_tOlMask = _mm_cmpgt_epi16(l_tVal, l_tOlThr);
+    __m128i l_tShortMask = _mm_cmpgt_epi16(l_tShortThr, l_tVal);
+
+    *pu32OlBits = (uint32)(~(uint32)_mm_movemask_epi8(_mm_packs_epi16(l_tOlMask, l_tOlMask)) & 0xFFu);
+    *pu32ShortBits = (uint32)(~(uint32)_mm_movemask_epi8(_mm_packs_epi16(l_tShortMask, l_tShortMask)) & 0xFFu);
+#elif defined(ADCCLS_NEON)
+    static const uint16_t l_au16Weight[8] = { 1u, 2u, 4u, 8u, 16u, 32u, 64u, 128u };
+    uint16x8_t l_tWeight = vld1q_u16(l_au16Weight);
+    uint16x8_t l_tVal = vld1q_u16(pu16Val);
+
+    *pu32OlBits = (uint32)vaddvq_u16(vandq_u16(vcleq_u16(l_tVal, vld1q_u16(pu16OlThr)), l_tWeight));
+    *pu32ShortBits = (uint32)vaddvq_u16(vandq_u16(vcgeq_u16(l_tVal, vld1q_u16(pu16ShortThr)), l_tWeight));
+#else
+    uint32 l_u32Val0 = (uint32)pu16Val[0] | ((uint32)pu16Val[1] << 16u);
+    uint32 l_u32Val1 = (uint32)pu16Val[2] | ((uint32)pu16Val[3] << 16u);
+    uint32 l_u32Val2 = (uint32)pu16Val[4] | ((uint32)pu16Val[5] << 16u);
+    uint32 l_u32Val3 = (uint32)pu16Val[6] | ((uint32)pu16Val[7] << 16u);
+    uint32 l_u32Tmp0;
+    uint32 l_u32Tmp1;
+    uint32 l_u32Tmp2;
+    uint32 l_u32Tmp3;
+
+    /* two channels per 32 bit word: (b | H) - a keeps the lane high bit set when a <= b,
+       the four words are then folded so lane bit 15/31 of word j lands on bit 2j/2j+1 */
+    l_u32Tmp0 = ((((uint32)pu16OlThr[0] | ((uint32)pu16OlThr[1] << 16u)) | ADCCLS_SWAR_H) - l_u32Val0) & ADCCLS_SWAR_H;
+    l_u32Tmp1 = ((((uint32)pu16OlThr[2] | ((uint32)pu16OlThr[3] << 16u)) | ADCCLS_SWAR_H) - l_u32Val1) & ADCCLS_SWAR_H;
+    l_u32Tmp2 = ((((uint32)pu16OlThr[4] | ((uint32)pu16OlThr[5] << 16u)) | ADCCLS_SWAR_H) - l_u32Val2) & ADCCLS_SWAR_H;
+    l_u32Tmp3 = ((((uint32)pu16OlThr[6] | ((uint32)pu16OlThr[7] << 16u)) | ADCCLS_SWAR_H) - l_u32Val3) & ADCCLS_SWAR_H;
+    l_u32Tmp0 = (l_u32Tmp0 >> 15u) | (l_u32Tmp1 >> 13u) | (l_u32Tmp2 >> 11u) | (l_u32Tmp3 >> 9u);
+    *pu32OlBits = (l_u32Tmp0 | (l_u32Tmp0 >> 15u)) & 0xFFu;
+
+    l_u32Tmp0 = ((l_u32Val0 | ADCCLS_SWAR_H) - ((uint32)pu16ShortThr[0] | ((uint32)pu16ShortThr[1] << 16u))) & ADCCLS_SWAR_H;
+    l_u32Tmp1 = ((l_u32Val1 | ADCCLS_SWAR_H) - ((uint32)pu16ShortThr[2] | ((uint32)pu16ShortThr[3] << 16u))) & ADCCLS_SWAR_H;
+    l_u32Tmp2 = ((l_u32Val2 | ADCCLS_SWAR_H) - ((uint32)pu16ShortThr[4] | ((uint32)pu16ShortThr[5] << 16u))) & ADCCLS_SWAR_H;
+    l_u32Tmp3 = ((l_u32Val3 | ADCCLS_SWAR_H) - ((uint32)pu16ShortThr[6] | ((uint32)pu16ShortThr[7] << 16u))) & ADCCLS_SWAR_H;
+    l_u32Tmp0 = (l_u32Tmp0 >> 15u) | (l_u32Tmp1 >> 13u) | (l_u32Tmp2 >> 11u) | (l_u32Tmp3 >> 9u);
+    *pu32ShortBits = (l_u32Tmp0 | (l_u32Tmp0 >> 15u)) & 0xFFu;
+#endif
+}
+
+/****************************************************************
+ process: AdcCls_Classify
+ purpose: Classify all channels into packed open load and short
+          masks. Blocks of 8 channels go through the vector/SWAR
+          kernel, the rest uses a branch free compare.
+ ****************************************************************/
+void AdcCls_Classify(const uint16* AdcCls_ValPtr, const uint16* AdcCls_OlThrPtr, const uint16* AdcCls_ShortThrPtr,
+                     uint16 AdcCls_Num, uint32* AdcCls_OlMaskPtr, uint32* AdcCls_ShortMaskPtr)
+{
+    uint16 i;
+    uint16 l_u16Word;
+    uint32 l_u32OlBits;
+    uint32 l_u32ShortBits;
+
+    for(l_u16Word = 0u; l_u16Word < ADCCLS_MASK_WORDS(AdcCls_Num); l_u16Word++)
+    {
+        AdcCls_OlMaskPtr[l_u16Word] = 0u;
+        AdcCls_ShortMaskPtr[l_u16Word] = 0u;
+    }
+
+    for(i = 0u; (uint16)(i + 8u) <= AdcCls_Num; i += 8u)
+    {
+        AdcCls_Lane8(&AdcCls_ValPtr[i], &AdcCls_OlThrPtr[i], &AdcCls_ShortThrPtr[i], &l_u32OlBits, &l_u32ShortBits);
+        AdcCls_OlMaskPtr[i / ADCCLS_MASK_BITS] |= l_u32OlBits << (i % ADCCLS_MASK_BITS);
+        AdcCls_ShortMaskPtr[i / ADCCLS_MASK_BITS] |= l_u32ShortBits << (i % ADCCLS_MASK_BITS);
+    }
+
+    for(; i < AdcCls_Num; i++)
+    {
+        /* a - b - 1 wraps below zero exactly when a <= b */
+        l_u32OlBits = (((uint32)AdcCls_ValPtr[i] - (uint32)AdcCls_OlThrPtr[i] - 1u) >> 31u) & 1u;
+        l_u32ShortBits = (((uint32)AdcCls_ShortThrPtr[i] - (uint32)AdcCls_ValPtr[i] - 1u) >> 31u) & 1u;
+        AdcCls_OlMaskPtr[i / ADCCLS_MASK_BITS] |= l_u32OlBits << (i % ADCCLS_MASK_BITS);
+        AdcCls_ShortMaskPtr[i / ADCCLS_MASK_BITS] |= l_u32ShortBits << (i % ADCCLS_MASK_BITS);
+    }
+}
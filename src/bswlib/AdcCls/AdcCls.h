@@ -0,0 +1,36 @@
+/*****************************************************************************************************************
+******************************************************************************************************************
+*  Copyright (C) .
+*  All rights reserved.
+******************************************************************************************************************
+*  FileName: AdcCls
+*  Content:  ADC threshold classification library header file.
+*  Category: AdcCls
+******************************************************************************************************************
+*  Revision Management
+*  yyyy.mm.dd    name              version      description
+*  ----------    --------          -------      -----------------------------------
+*  2026.01.22    clipping            v0001        Frist edit
+******************************************************************************************************************
+******************************************************************************************************************/
+/* Include Headerfiles  */
+#ifndef _ADCCLS_H_
+#define _ADCCLS_H_
+
+#include "Std_Types.h"
+
+/* STD_ON: use SSE2/NEON when the compiler provides it (host builds), otherwise SWAR on 32 bit words */
+#ifndef ADCCLS_SIMD_EN
+#define ADCCLS_SIMD_EN          STD_ON
+#endif
+
+/* bit n of the masks is channel n, 32 channels per word */
+#define ADCCLS_MASK_BITS        32u
+#define ADCCLS_MASK_WORDS(num)  (((num) + ADCCLS_MASK_BITS - 1u) / ADCCLS_MASK_BITS)
+
+/* Values and thresholds are structure of arrays with one entry per channel, all below 0x8000
+   (ADC up to 15 bit). Open load: value <= OL threshold. Short: value >= short threshold. */
+extern void AdcCls_Classify(const uint16* AdcCls_ValPtr, const uint16* AdcCls_OlThrPtr, const uint16* AdcCls_ShortThrPtr,
+                            uint16 AdcCls_Num, uint32* AdcCls_OlMaskPtr, uint32* AdcCls_ShortMaskPtr);
+
+#endif
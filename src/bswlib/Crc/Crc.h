@@ -0,0 +1,27 @@
+/*****************************************************************************************************************
+******************************************************************************************************************
+*  Copyright (C) .
+*  All rights reserved.
+******************************************************************************************************************
+*  FileName: Crc
+*  Content:  CRC library header file.
+*  Category: Crc
+******************************************************************************************************************
+*  Revision Management
+*  yyyy.mm.dd    name              version      description
+*  ----------    --------          -------      -----------------------------------
+*  2026.01.10    clipping            v0001        Frist edit
+******************************************************************************************************************
+******************************************************************************************************************/
+/* Include Headerfiles  */
+#ifndef _CRC_H_
+#define _CRC_H_
+
+#include "Std_Types.h"
+
+/* CRC-16/CCITT-FALSE: polynomial 0x1021, start value 0xFFFF, no reflection, no final xor */
+#define CRC_INITIAL_VALUE16     0xFFFFu
+
+extern uint16 Crc_CalculateCRC16(const uint8* Crc_DataPtr, uint32 Crc_Length, uint16 Crc_StartValue16, boolean Crc_IsFirstCall);
+
+#endif
@@ -96,6 +96,28 @@
 /* !LINKSTO CompilerAbstraction.ASR403.COMPILER060, 1 */
 #define LOCAL_INLINE static INLINE
 
+/*------------------[memory barrier]-----------------------------------------*/
+
+/** \brief data memory barrier
+ **
+ ** The memory accesses before the barrier are complete, for the other cores
+ ** and bus masters too, before any access after it is made. It is a compiler
+ ** barrier as well. Compiler_Cfg.h may define it for a platform not listed
+ ** here. */
+#if (!defined COMPILER_MEMORY_BARRIER)
+#if (defined __TASKING__)
+#define COMPILER_MEMORY_BARRIER() __dsync()
+#elif (defined __GNUC__) && (defined __TRICORE__)
+#define COMPILER_MEMORY_BARRIER() __asm__ volatile ("dsync" ::: "memory")
+#elif (defined __GNUC__) && (defined __ARM_ARCH)
+#define COMPILER_MEMORY_BARRIER() __asm__ volatile ("dmb sy" ::: "memory")
+#elif (defined __GNUC__)
+#define COMPILER_MEMORY_BARRIER() __sync_synchronize()
+#else
+#error COMPILER_MEMORY_BARRIER is not mapped for this compiler, define it in Compiler_Cfg.h
+#endif
+#endif
+
 /*------------------[macros for functions]-----------------------------------*/
 
 #if (defined FUNC)
@@ -0,0 +1,70 @@
+/*****************************************************************************************************************
+******************************************************************************************************************
+*  Copyright (C) .
+*  All rights reserved.
+******************************************************************************************************************
+*  FileName: IoChnReg
+*  Content:  IO channel registry variant selection
+*  Category: Vn7x Bjt Tle941xy Tle9210x Pfm
+******************************************************************************************************************
+*  Revision Management
+*  yyyy.mm.dd    name              version      description
+*  ----------    --------          -------      -----------------------------------
+*  2026.01.10    clipping            v0001        Frist edit
+******************************************************************************************************************
+******************************************************************************************************************/
+/* Include Headerfiles  */
+#include "IoChnReg.h"
+#include "Crc.h"
+#include <stddef.h>
+
+/* CRC covered part of IoChnReg_VariantType */
+#define IOCHNREG_VARIANT_CRC_OFFSET     (offsetof(IoChnReg_VariantType, u8VariantId))
+#define IOCHNREG_VARIANT_CRC_LENGTH     (offsetof(IoChnReg_VariantType, au8ChipNum) + sizeof(((IoChnReg_VariantType*)0)->au8ChipNum) \
+                                        - IOCHNREG_VARIANT_CRC_OFFSET)
+
+/* selected when the variant coding or its record is invalid: no channel is driven */
+static const IoChnReg_VariantType cIoChnReg_tNoVariant = {0};
+static const IoChnReg_VariantType* sIoChnReg_ptVariant = &cIoChnReg_tNoVariant;
+
+/****************************************************************
+ process: IoChnReg_Init
+ purpose: Select the configuration record of the coded variant and
+          check it with CRC16. Must run before the driver and Pfm
+          init, they take their active counts from the record.
+ ****************************************************************/
+Std_ReturnType IoChnReg_Init(void)
+{
+    Std_ReturnType l_u8RetVal = E_NOT_OK;
+    uint8 l_u8Variant;
+    const IoChnReg_VariantType* l_ptCfg;
+    uint16 l_u16Crc;
+
+    l_u8Variant = IOCHNREG_GET_VARIANT();
+    sIoChnReg_ptVariant = &cIoChnReg_tNoVariant;
+    if(l_u8Variant < (uint8)IOCHNREG_VARIANT_MAX)
+    {
+        l_ptCfg = &cIoChnReg_atVariant[l_u8Variant];
+        l_u16Crc = Crc_CalculateCRC16((const uint8*)l_ptCfg + IOCHNREG_VARIANT_CRC_OFFSET,
+                                      (uint32)IOCHNREG_VARIANT_CRC_LENGTH, CRC_INITIAL_VALUE16, TRUE);
+        if((l_u16Crc == l_ptCfg->u16Crc) && (l_ptCfg->u8VariantId == l_u8Variant) && (l_ptCfg->u8PidNum < (uint8)PFM_PID_SIZE))
+        {
+            sIoChnReg_ptVariant = l_ptCfg;
+            l_u8RetVal = E_OK;
+        }
+        else
+        {
+            /* nothing to do */
+        }
+    }
+    else
+    {
+        /* nothing to do */
+    }
+    return l_u8RetVal;
+}
+
+const IoChnReg_VariantType* IoChnReg_GetVariant(void)
+{
+    return sIoChnReg_ptVariant;
+}
@@ -0,0 +1,75 @@
+/*****************************************************************************************************************
+******************************************************************************************************************
+*  Copyright (C) .
+*  All rights reserved.
+******************************************************************************************************************
+*  FileName: IoChnReg
+*  Content:  IO channel registry, logical channel to driver, PID and DTC
+*  Category: Vn7x Bjt Tle941xy Tle9210x Pfm
+******************************************************************************************************************
+*  Revision Management
+*  yyyy.mm.dd    name              version      description
+*  ----------    --------          -------      -----------------------------------
+*  2026.01.09    clipping            v0001        Frist edit
+******************************************************************************************************************
+******************************************************************************************************************/
+/* Include Headerfiles  */
+#ifndef _IOCHNREG_H_
+#define _IOCHNREG_H_
+
+#include "IoChnReg_Cfg.h"
+#include "Pfm_Cfg.h"
+
+/* Variant coding callout, e.g. read from the coding block in NVM or from board strap pins */
+#define IOCHNREG_GET_VARIANT()                  ((uint8)IOCHNREG_VARIANT_HIGH)
+
+/* Post-build record of one hardware variant, see cIoChnReg_atVariant.
+   Only the channels, groups and chips counted here are handled by the drivers. */
+typedef struct
+{
+    uint16 u16Crc;
+    uint8 u8VariantId;
+    uint8 u8PidNum;
+    uint8 au8Pid[PFM_PID_SIZE];
+    uint8 au8ChnNum[IOCHNREG_DRV_MAX];      /* active channels of VN7X/BJT, 0 for the TLE drivers */
+    uint8 au8GroupNum[IOCHNREG_DRV_MAX];    /* active groups of the TLE drivers, 0 for VN7X/BJT */
+    uint8 au8ChipNum[IOCHNREG_DRV_MAX][IOCHNREG_GROUP_MAX];
+} IoChnReg_VariantType;
+
+extern const IoChnReg_VariantType cIoChnReg_atVariant[IOCHNREG_VARIANT_MAX];
+
+/* The tables are generated by script/chnreggen/csv2chnreg.py from IoChnReg.csv,
+   every lookup below is a single array index. */
+#define IoChnReg_GetCfg(chn)                    (&cIoChnReg_atChnCfg[(chn)])
+#define IoChnReg_GetDrv(chn)                    ((IoChnReg_DrvType)cIoChnReg_atChnCfg[(chn)].u8Drv)
+#define IoChnReg_GetPid(chn)                    ((PFM_PhysicalId_e)cIoChnReg_atChnCfg[(chn)].u8Pid)
+#define IoChnReg_GetDtc(chn, ddt)               (Pfm_DefectDtcId[cIoChnReg_atChnCfg[(chn)].u8Pid][(ddt)])
+#define IoChnReg_PidToChn(pid)                  ((IoChnReg_ChnIdType)cIoChnReg_au8PidToChn[(pid)])
+
+/* active counts of the selected variant, read once by the drivers at init.
+   The drivers ask for every group up to their own GROUP_MAX, groups past the records have no chip. */
+#define IoChnReg_GetChnNum(drv)                 (IoChnReg_GetVariant()->au8ChnNum[(drv)])
+#define IoChnReg_GetGroupNum(drv)               (IoChnReg_GetVariant()->au8GroupNum[(drv)])
+#define IoChnReg_GetChipNum(drv, grp)           ((uint8)(((grp) < IOCHNREG_GROUP_MAX) ? IoChnReg_GetVariant()->au8ChipNum[(drv)][(grp)] : 0u))
+
+#if(IOCHNREG_VN7X_EN == STD_ON)
+#define IoChnReg_Vn7xPid(port)                  ((PFM_PhysicalId_e)cIoChnReg_au8Vn7xPid[(port)])
+#define IoChnReg_Vn7xChn(port)                  ((IoChnReg_ChnIdType)cIoChnReg_au8Vn7xChn[(port)])
+#endif
+#if(IOCHNREG_BJT_EN == STD_ON)
+#define IoChnReg_BjtPid(port)                   ((PFM_PhysicalId_e)cIoChnReg_au8BjtPid[(port)])
+#define IoChnReg_BjtChn(port)                   ((IoChnReg_ChnIdType)cIoChnReg_au8BjtChn[(port)])
+#endif
+#if(IOCHNREG_TLE941XY_EN == STD_ON)
+#define IoChnReg_Tle941xyPid(grp, chip, chn)    ((PFM_PhysicalId_e)cIoChnReg_au8Tle941xyPid[(grp)][(chip)][(chn)])
+#define IoChnReg_Tle941xyChn(grp, chip, chn)    ((IoChnReg_ChnIdType)cIoChnReg_au8Tle941xyChn[(grp)][(chip)][(chn)])
+#endif
+#if(IOCHNREG_TLE9210X_EN == STD_ON)
+#define IoChnReg_Tle9210xPid(grp, chip, chn)    ((PFM_PhysicalId_e)cIoChnReg_au8Tle9210xPid[(grp)][(chip)][(chn)])
+#define IoChnReg_Tle9210xChn(grp, chip, chn)    ((IoChnReg_ChnIdType)cIoChnReg_au8Tle9210xChn[(grp)][(chip)][(chn)])
+#endif
+
+extern Std_ReturnType IoChnReg_Init(void);
+extern const IoChnReg_VariantType* IoChnReg_GetVariant(void);
+
+#endif
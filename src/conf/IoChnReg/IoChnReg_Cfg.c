@@ -0,0 +1,188 @@
+/*****************************************************************************************************************
+******************************************************************************************************************
+*  Copyright (C) .
+*  All rights reserved.
+******************************************************************************************************************
+*  FileName: IoChnReg_Cfg
+*  Content:  IO channel registry configuration source file.
+*  Category: generated by script/chnreggen/csv2chnreg.py from IoChnReg.csv, do not edit
+******************************************************************************************************************
+*  Revision Management
+*  yyyy.mm.dd    name              version      description
+*  ----------    --------          -------      -----------------------------------
+*  2026.01.09    clipping            v0001        Frist edit
+******************************************************************************************************************
+******************************************************************************************************************/
+/* Include Headerfiles  */
+#include "IoChnReg.h"
+
+/* Channel, group and chip numbers: VN7X/BJT active channels, TLE active groups and chips per group.
+   The CRC covers all fields from u8VariantId on. */
+const IoChnReg_VariantType cIoChnReg_atVariant[IOCHNREG_VARIANT_MAX] =
+{
+    {   /* IOCHNREG_VARIANT_HIGH */
+        .u16Crc = 0x55CCu,
+        .u8VariantId = (uint8)IOCHNREG_VARIANT_HIGH,
+        .u8PidNum = 24u,
+        .au8Pid = {(uint8)PFM_PID_HSDC_OUT0, (uint8)PFM_PID_HSDC_OUT1, (uint8)PFM_PID_HSDC_OUT2, (uint8)PFM_PID_HSDC_OUT3, (uint8)PFM_PID_HSDC_OUT4, (uint8)PFM_PID_HSDC_OUT5, (uint8)PFM_PID_HSDC_OUT6, (uint8)PFM_PID_HSDC_OUT7, (uint8)PFM_PID_OPH02, (uint8)PFM_PID_OPH01, (uint8)PFM_PID_HBD0_OUT1, (uint8)PFM_PID_HBD0_OUT2, (uint8)PFM_PID_HBD0_OUT3, (uint8)PFM_PID_HBD0_OUT4, (uint8)PFM_PID_HBD1_OUT1, (uint8)PFM_PID_HBD1_OUT2, (uint8)PFM_PID_HBD1_OUT3, (uint8)PFM_PID_HBD1_OUT4, (uint8)PFM_PID_GDU0_HB1, (uint8)PFM_PID_GDU0_HB2, (uint8)PFM_PID_GDU1_HB1, (uint8)PFM_PID_GDU1_HB2, (uint8)PFM_PID_GDU2_HB1, (uint8)PFM_PID_GDU2_HB2},
+        .au8ChnNum = {0u, 8u, 2u, 0u, 0u},
+        .au8GroupNum = {0u, 0u, 0u, 2u, 3u},
+        .au8ChipNum = {{0u, 0u, 0u}, {0u, 0u, 0u}, {0u, 0u, 0u}, {1u, 1u, 0u}, {1u, 1u, 1u}},
+    },
+    {   /* IOCHNREG_VARIANT_LOW */
+        .u16Crc = 0x6EE2u,
+        .u8VariantId = (uint8)IOCHNREG_VARIANT_LOW,
+        .u8PidNum = 20u,
+        .au8Pid = {(uint8)PFM_PID_HSDC_OUT0, (uint8)PFM_PID_HSDC_OUT1, (uint8)PFM_PID_HSDC_OUT2, (uint8)PFM_PID_HSDC_OUT3, (uint8)PFM_PID_OPH02, (uint8)PFM_PID_OPH01, (uint8)PFM_PID_HBD0_OUT1, (uint8)PFM_PID_HBD0_OUT2, (uint8)PFM_PID_HBD0_OUT3, (uint8)PFM_PID_HBD0_OUT4, (uint8)PFM_PID_HBD1_OUT1, (uint8)PFM_PID_HBD1_OUT2, (uint8)PFM_PID_HBD1_OUT3, (uint8)PFM_PID_HBD1_OUT4, (uint8)PFM_PID_GDU0_HB1, (uint8)PFM_PID_GDU0_HB2, (uint8)PFM_PID_GDU1_HB1, (uint8)PFM_PID_GDU1_HB2, (uint8)PFM_PID_GDU2_HB1, (uint8)PFM_PID_GDU2_HB2},
+        .au8ChnNum = {0u, 4u, 2u, 0u, 0u},
+        .au8GroupNum = {0u, 0u, 0u, 2u, 3u},
+        .au8ChipNum = {{0u, 0u, 0u}, {0u, 0u, 0u}, {0u, 0u, 0u}, {1u, 1u, 0u}, {1u, 1u, 1u}},
+    },
+};
+
+/* driver, group, chip, channel, pid */
+const IoChnReg_ChnCfgType cIoChnReg_atChnCfg[IOCHNREG_CHN_MAX] =
+{
+    {IOCHNREG_DRV_NONE, 0u, 0u, 0u, (uint8)PFM_PID_DUMMTY},    /* IOCHNREG_CHN_DUMMY */
+    {IOCHNREG_DRV_VN7X, 0u, 0u, 0u, (uint8)PFM_PID_HSDC_OUT0},    /* IOCHNREG_CHN_HSDC_OUT0 */
+    {IOCHNREG_DRV_VN7X, 0u, 0u, 1u, (uint8)PFM_PID_HSDC_OUT1},    /* IOCHNREG_CHN_HSDC_OUT1 */
+    {IOCHNREG_DRV_VN7X, 0u, 0u, 2u, (uint8)PFM_PID_HSDC_OUT2},    /* IOCHNREG_CHN_HSDC_OUT2 */
+    {IOCHNREG_DRV_VN7X, 0u, 0u, 3u, (uint8)PFM_PID_HSDC_OUT3},    /* IOCHNREG_CHN_HSDC_OUT3 */
+    {IOCHNREG_DRV_VN7X, 0u, 0u, 4u, (uint8)PFM_PID_HSDC_OUT4},    /* IOCHNREG_CHN_HSDC_OUT4 */
+    {IOCHNREG_DRV_VN7X, 0u, 0u, 5u, (uint8)PFM_PID_HSDC_OUT5},    /* IOCHNREG_CHN_HSDC_OUT5 */
+    {IOCHNREG_DRV_VN7X, 0u, 0u, 6u, (uint8)PFM_PID_HSDC_OUT6},    /* IOCHNREG_CHN_HSDC_OUT6 */
+    {IOCHNREG_DRV_VN7X, 0u, 0u, 7u, (uint8)PFM_PID_HSDC_OUT7},    /* IOCHNREG_CHN_HSDC_OUT7 */
+    {IOCHNREG_DRV_BJT, 0u, 0u, 0u, (uint8)PFM_PID_OPH02},    /* IOCHNREG_CHN_OPH02 */
+    {IOCHNREG_DRV_BJT, 0u, 0u, 1u, (uint8)PFM_PID_OPH01},    /* IOCHNREG_CHN_OPH01 */
+    {IOCHNREG_DRV_TLE941XY, 0u, 0u, 0u, (uint8)PFM_PID_HBD0_OUT1},    /* IOCHNREG_CHN_HBD0_OUT1 */
+    {IOCHNREG_DRV_TLE941XY, 0u, 0u, 1u, (uint8)PFM_PID_HBD0_OUT2},    /* IOCHNREG_CHN_HBD0_OUT2 */
+    {IOCHNREG_DRV_TLE941XY, 0u, 0u, 2u, (uint8)PFM_PID_HBD0_OUT3},    /* IOCHNREG_CHN_HBD0_OUT3 */
+    {IOCHNREG_DRV_TLE941XY, 0u, 0u, 3u, (uint8)PFM_PID_HBD0_OUT4},    /* IOCHNREG_CHN_HBD0_OUT4 */
+    {IOCHNREG_DRV_TLE941XY, 1u, 0u, 0u, (uint8)PFM_PID_HBD1_OUT1},    /* IOCHNREG_CHN_HBD1_OUT1 */
+    {IOCHNREG_DRV_TLE941XY, 1u, 0u, 1u, (uint8)PFM_PID_HBD1_OUT2},    /* IOCHNREG_CHN_HBD1_OUT2 */
+    {IOCHNREG_DRV_TLE941XY, 1u, 0u, 2u, (uint8)PFM_PID_HBD1_OUT3},    /* IOCHNREG_CHN_HBD1_OUT3 */
+    {IOCHNREG_DRV_TLE941XY, 1u, 0u, 3u, (uint8)PFM_PID_HBD1_OUT4},    /* IOCHNREG_CHN_HBD1_OUT4 */
+    {IOCHNREG_DRV_TLE9210X, 0u, 0u, 0u, (uint8)PFM_PID_GDU0_HB1},    /* IOCHNREG_CHN_GDU0_HB1 */
+    {IOCHNREG_DRV_TLE9210X, 0u, 0u, 1u, (uint8)PFM_PID_GDU0_HB2},    /* IOCHNREG_CHN_GDU0_HB2 */
+    {IOCHNREG_DRV_TLE9210X, 1u, 0u, 0u, (uint8)PFM_PID_GDU1_HB1},    /* IOCHNREG_CHN_GDU1_HB1 */
+    {IOCHNREG_DRV_TLE9210X, 1u, 0u, 1u, (uint8)PFM_PID_GDU1_HB2},    /* IOCHNREG_CHN_GDU1_HB2 */
+    {IOCHNREG_DRV_TLE9210X, 2u, 0u, 0u, (uint8)PFM_PID_GDU2_HB1},    /* IOCHNREG_CHN_GDU2_HB1 */
+    {IOCHNREG_DRV_TLE9210X, 2u, 0u, 1u, (uint8)PFM_PID_GDU2_HB2},    /* IOCHNREG_CHN_GDU2_HB2 */
+};
+
+const uint8 cIoChnReg_au8PidToChn[PFM_PID_SIZE] =
+{
+    [PFM_PID_DUMMTY] = IOCHNREG_CHN_DUMMY,
+    [PFM_PID_HSDC_OUT0] = IOCHNREG_CHN_HSDC_OUT0,
+    [PFM_PID_HSDC_OUT1] = IOCHNREG_CHN_HSDC_OUT1,
+    [PFM_PID_HSDC_OUT2] = IOCHNREG_CHN_HSDC_OUT2,
+    [PFM_PID_HSDC_OUT3] = IOCHNREG_CHN_HSDC_OUT3,
+    [PFM_PID_HSDC_OUT4] = IOCHNREG_CHN_HSDC_OUT4,
+    [PFM_PID_HSDC_OUT5] = IOCHNREG_CHN_HSDC_OUT5,
+    [PFM_PID_HSDC_OUT6] = IOCHNREG_CHN_HSDC_OUT6,
+    [PFM_PID_HSDC_OUT7] = IOCHNREG_CHN_HSDC_OUT7,
+    [PFM_PID_OPH02] = IOCHNREG_CHN_OPH02,
+    [PFM_PID_OPH01] = IOCHNREG_CHN_OPH01,
+    [PFM_PID_HBD0_OUT1] = IOCHNREG_CHN_HBD0_OUT1,
+    [PFM_PID_HBD0_OUT2] = IOCHNREG_CHN_HBD0_OUT2,
+    [PFM_PID_HBD0_OUT3] = IOCHNREG_CHN_HBD0_OUT3,
+    [PFM_PID_HBD0_OUT4] = IOCHNREG_CHN_HBD0_OUT4,
+    [PFM_PID_HBD1_OUT1] = IOCHNREG_CHN_HBD1_OUT1,
+    [PFM_PID_HBD1_OUT2] = IOCHNREG_CHN_HBD1_OUT2,
+    [PFM_PID_HBD1_OUT3] = IOCHNREG_CHN_HBD1_OUT3,
+    [PFM_PID_HBD1_OUT4] = IOCHNREG_CHN_HBD1_OUT4,
+    [PFM_PID_GDU0_HB1] = IOCHNREG_CHN_GDU0_HB1,
+    [PFM_PID_GDU0_HB2] = IOCHNREG_CHN_GDU0_HB2,
+    [PFM_PID_GDU1_HB1] = IOCHNREG_CHN_GDU1_HB1,
+    [PFM_PID_GDU1_HB2] = IOCHNREG_CHN_GDU1_HB2,
+    [PFM_PID_GDU2_HB1] = IOCHNREG_CHN_GDU2_HB1,
+    [PFM_PID_GDU2_HB2] = IOCHNREG_CHN_GDU2_HB2,
+};
+
+#if(IOCHNREG_VN7X_EN == STD_ON)
+const uint8 cIoChnReg_au8Vn7xChn[VN7X_ID_MAX] =
+{
+    [0u] = IOCHNREG_CHN_HSDC_OUT0,
+    [1u] = IOCHNREG_CHN_HSDC_OUT1,
+    [2u] = IOCHNREG_CHN_HSDC_OUT2,
+    [3u] = IOCHNREG_CHN_HSDC_OUT3,
+    [4u] = IOCHNREG_CHN_HSDC_OUT4,
+    [5u] = IOCHNREG_CHN_HSDC_OUT5,
+    [6u] = IOCHNREG_CHN_HSDC_OUT6,
+    [7u] = IOCHNREG_CHN_HSDC_OUT7,
+};
+
+const uint8 cIoChnReg_au8Vn7xPid[VN7X_ID_MAX] =
+{
+    [0u] = (uint8)PFM_PID_HSDC_OUT0,
+    [1u] = (uint8)PFM_PID_HSDC_OUT1,
+    [2u] = (uint8)PFM_PID_HSDC_OUT2,
+    [3u] = (uint8)PFM_PID_HSDC_OUT3,
+    [4u] = (uint8)PFM_PID_HSDC_OUT4,
+    [5u] = (uint8)PFM_PID_HSDC_OUT5,
+    [6u] = (uint8)PFM_PID_HSDC_OUT6,
+    [7u] = (uint8)PFM_PID_HSDC_OUT7,
+};
+#endif
+
+#if(IOCHNREG_BJT_EN == STD_ON)
+const uint8 cIoChnReg_au8BjtChn[BJT_ID_MAX] =
+{
+    [0u] = IOCHNREG_CHN_OPH02,
+    [1u] = IOCHNREG_CHN_OPH01,
+};
+
+const uint8 cIoChnReg_au8BjtPid[BJT_ID_MAX] =
+{
+    [0u] = (uint8)PFM_PID_OPH02,
+    [1u] = (uint8)PFM_PID_OPH01,
+};
+#endif
+
+#if(IOCHNREG_TLE941XY_EN == STD_ON)
+const uint8 cIoChnReg_au8Tle941xyChn[TLE941XY_GROUP_MAX][TLE941XY_CHIP_MAX][TLE941XY_CHANNEL_MAX] =
+{
+    [0u][0u][0u] = IOCHNREG_CHN_HBD0_OUT1,
+    [0u][0u][1u] = IOCHNREG_CHN_HBD0_OUT2,
+    [0u][0u][2u] = IOCHNREG_CHN_HBD0_OUT3,
+    [0u][0u][3u] = IOCHNREG_CHN_HBD0_OUT4,
+    [1u][0u][0u] = IOCHNREG_CHN_HBD1_OUT1,
+    [1u][0u][1u] = IOCHNREG_CHN_HBD1_OUT2,
+    [1u][0u][2u] = IOCHNREG_CHN_HBD1_OUT3,
+    [1u][0u][3u] = IOCHNREG_CHN_HBD1_OUT4,
+};
+
+const uint8 cIoChnReg_au8Tle941xyPid[TLE941XY_GROUP_MAX][TLE941XY_CHIP_MAX][TLE941XY_CHANNEL_MAX] =
+{
+    [0u][0u][0u] = (uint8)PFM_PID_HBD0_OUT1,
+    [0u][0u][1u] = (uint8)PFM_PID_HBD0_OUT2,
+    [0u][0u][2u] = (uint8)PFM_PID_HBD0_OUT3,
+    [0u][0u][3u] = (uint8)PFM_PID_HBD0_OUT4,
+    [1u][0u][0u] = (uint8)PFM_PID_HBD1_OUT1,
+    [1u][0u][1u] = (uint8)PFM_PID_HBD1_OUT2,
+    [1u][0u][2u] = (uint8)PFM_PID_HBD1_OUT3,
+    [1u][0u][3u] = (uint8)PFM_PID_HBD1_OUT4,
+};
+#endif
+
+#if(IOCHNREG_TLE9210X_EN == STD_ON)
+const uint8 cIoChnReg_au8Tle9210xChn[TLE9210X_GROUP_MAX][TLE9210X_CHIP_MAX][TLE9210X_HB_CHN_MAX] =
+{
+    [0u][0u][0u] = IOCHNREG_CHN_GDU0_HB1,
+    [0u][0u][1u] = IOCHNREG_CHN_GDU0_HB2,
+    [1u][0u][0u] = IOCHNREG_CHN_GDU1_HB1,
+    [1u][0u][1u] = IOCHNREG_CHN_GDU1_HB2,
+    [2u][0u][0u] = IOCHNREG_CHN_GDU2_HB1,
+    [2u][0u][1u] = IOCHNREG_CHN_GDU2_HB2,
+};
+
+const uint8 cIoChnReg_au8Tle9210xPid[TLE9210X_GROUP_MAX][TLE9210X_CHIP_MAX][TLE9210X_HB_CHN_MAX] =
+{
+    [0u][0u][0u] = (uint8)PFM_PID_GDU0_HB1,
+    [0u][0u][1u] = (uint8)PFM_PID_GDU0_HB2,
+    [1u][0u][0u] = (uint8)PFM_PID_GDU1_HB1,
+    [1u][0u][1u] = (uint8)PFM_PID_GDU1_HB2,
+    [2u][0u][0u] = (uint8)PFM_PID_GDU2_HB1,
+    [2u][0u][1u] = (uint8)PFM_PID_GDU2_HB2,
+};
+#endif
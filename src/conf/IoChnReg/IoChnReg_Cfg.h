@@ -0,0 +1,105 @@
+/*****************************************************************************************************************
+******************************************************************************************************************
+*  Copyright (C) .
+*  All rights reserved.
+******************************************************************************************************************
+*  FileName: IoChnReg_Cfg
+*  Content:  IO channel registry configuration header file.
+*  Category: generated by script/chnreggen/csv2chnreg.py from IoChnReg.csv, do not edit
+******************************************************************************************************************
+*  Revision Management
+*  yyyy.mm.dd    name              version      description
+*  ----------    --------          -------      -----------------------------------
+*  2026.01.09    clipping            v0001        Frist edit
+******************************************************************************************************************
+******************************************************************************************************************/
+/* Include Headerfiles  */
+#ifndef _IOCHNREG_CFG_H_
+#define _IOCHNREG_CFG_H_
+
+#include "IoChnReg_Types.h"
+#include "IoChnReg_Pid.h"
+
+#define IOCHNREG_VN7X_EN            STD_ON
+#define IOCHNREG_BJT_EN             STD_ON
+#define IOCHNREG_TLE941XY_EN        STD_ON
+#define IOCHNREG_TLE9210X_EN        STD_ON
+
+#if(IOCHNREG_VN7X_EN == STD_ON)
+#include "Vn7x_HwCfg.h"
+#endif
+#if(IOCHNREG_BJT_EN == STD_ON)
+#include "Bjt_HwCfg.h"
+#endif
+#if(IOCHNREG_TLE941XY_EN == STD_ON)
+#include "Tle941xy_HwCfg.h"
+#endif
+#if(IOCHNREG_TLE9210X_EN == STD_ON)
+#include "Tle9210x_HwCfg.h"
+#endif
+
+/* logical channel ids, 0 is reserved for unused slots of the lookup tables */
+typedef enum
+{
+    IOCHNREG_CHN_DUMMY,
+
+    IOCHNREG_CHN_HSDC_OUT0,
+    IOCHNREG_CHN_HSDC_OUT1,
+    IOCHNREG_CHN_HSDC_OUT2,
+    IOCHNREG_CHN_HSDC_OUT3,
+    IOCHNREG_CHN_HSDC_OUT4,
+    IOCHNREG_CHN_HSDC_OUT5,
+    IOCHNREG_CHN_HSDC_OUT6,
+    IOCHNREG_CHN_HSDC_OUT7,
+    IOCHNREG_CHN_OPH02,
+    IOCHNREG_CHN_OPH01,
+    IOCHNREG_CHN_HBD0_OUT1,
+    IOCHNREG_CHN_HBD0_OUT2,
+    IOCHNREG_CHN_HBD0_OUT3,
+    IOCHNREG_CHN_HBD0_OUT4,
+    IOCHNREG_CHN_HBD1_OUT1,
+    IOCHNREG_CHN_HBD1_OUT2,
+    IOCHNREG_CHN_HBD1_OUT3,
+    IOCHNREG_CHN_HBD1_OUT4,
+    IOCHNREG_CHN_GDU0_HB1,
+    IOCHNREG_CHN_GDU0_HB2,
+    IOCHNREG_CHN_GDU1_HB1,
+    IOCHNREG_CHN_GDU1_HB2,
+    IOCHNREG_CHN_GDU2_HB1,
+    IOCHNREG_CHN_GDU2_HB2,
+
+    IOCHNREG_CHN_MAX
+} IoChnReg_ChnIdType;
+
+/* TLE groups covered by the variant records */
+#define IOCHNREG_GROUP_MAX          3u
+
+/* hardware variants, the variant coding selects one of them at init */
+typedef enum
+{
+    IOCHNREG_VARIANT_HIGH,
+    IOCHNREG_VARIANT_LOW,
+
+    IOCHNREG_VARIANT_MAX
+} IoChnReg_VariantIdType;
+
+extern const IoChnReg_ChnCfgType cIoChnReg_atChnCfg[IOCHNREG_CHN_MAX];
+extern const uint8 cIoChnReg_au8PidToChn[PFM_PID_SIZE];
+#if(IOCHNREG_VN7X_EN == STD_ON)
+extern const uint8 cIoChnReg_au8Vn7xChn[VN7X_ID_MAX];
+extern const uint8 cIoChnReg_au8Vn7xPid[VN7X_ID_MAX];
+#endif
+#if(IOCHNREG_BJT_EN == STD_ON)
+extern const uint8 cIoChnReg_au8BjtChn[BJT_ID_MAX];
+extern const uint8 cIoChnReg_au8BjtPid[BJT_ID_MAX];
+#endif
+#if(IOCHNREG_TLE941XY_EN == STD_ON)
+extern const uint8 cIoChnReg_au8Tle941xyChn[TLE941XY_GROUP_MAX][TLE941XY_CHIP_MAX][TLE941XY_CHANNEL_MAX];
+extern const uint8 cIoChnReg_au8Tle941xyPid[TLE941XY_GROUP_MAX][TLE941XY_CHIP_MAX][TLE941XY_CHANNEL_MAX];
+#endif
+#if(IOCHNREG_TLE9210X_EN == STD_ON)
+extern const uint8 cIoChnReg_au8Tle9210xChn[TLE9210X_GROUP_MAX][TLE9210X_CHIP_MAX][TLE9210X_HB_CHN_MAX];
+extern const uint8 cIoChnReg_au8Tle9210xPid[TLE9210X_GROUP_MAX][TLE9210X_CHIP_MAX][TLE9210X_HB_CHN_MAX];
+#endif
+
+#endif
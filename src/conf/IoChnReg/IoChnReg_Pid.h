@@ -0,0 +1,54 @@
+/*****************************************************************************************************************
+******************************************************************************************************************
+*  Copyright (C) .
+*  All rights reserved.
+******************************************************************************************************************
+*  FileName: IoChnReg_Pid
+*  Content:  Pfm physical id list
+*  Category: generated by script/chnreggen/csv2chnreg.py from IoChnReg.csv, do not edit
+******************************************************************************************************************
+*  Revision Management
+*  yyyy.mm.dd    name              version      description
+*  ----------    --------          -------      -----------------------------------
+*  2026.01.09    clipping            v0001        Frist edit
+******************************************************************************************************************
+******************************************************************************************************************/
+/* Include Headerfiles  */
+
+#ifndef _IOCHNREG_PID_H
+#define _IOCHNREG_PID_H
+
+/*chip of group list order: from left to right, from top to dowm */
+typedef enum
+{
+    PFM_PID_DUMMTY,
+
+    PFM_PID_HSDC_OUT0,
+    PFM_PID_HSDC_OUT1,
+    PFM_PID_HSDC_OUT2,
+    PFM_PID_HSDC_OUT3,
+    PFM_PID_HSDC_OUT4,
+    PFM_PID_HSDC_OUT5,
+    PFM_PID_HSDC_OUT6,
+    PFM_PID_HSDC_OUT7,
+    PFM_PID_OPH02,
+    PFM_PID_OPH01,
+    PFM_PID_HBD0_OUT1,
+    PFM_PID_HBD0_OUT2,
+    PFM_PID_HBD0_OUT3,
+    PFM_PID_HBD0_OUT4,
+    PFM_PID_HBD1_OUT1,
+    PFM_PID_HBD1_OUT2,
+    PFM_PID_HBD1_OUT3,
+    PFM_PID_HBD1_OUT4,
+    PFM_PID_GDU0_HB1,
+    PFM_PID_GDU0_HB2,
+    PFM_PID_GDU1_HB1,
+    PFM_PID_GDU1_HB2,
+    PFM_PID_GDU2_HB1,
+    PFM_PID_GDU2_HB2,
+
+    PFM_PID_SIZE
+} PFM_PhysicalId_e;
+
+#endif // _IOCHNREG_PID_H
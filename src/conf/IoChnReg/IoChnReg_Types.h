@@ -0,0 +1,44 @@
+/*****************************************************************************************************************
+******************************************************************************************************************
+*  Copyright (C) .
+*  All rights reserved.
+******************************************************************************************************************
+*  FileName: IoChnReg_Types
+*  Content:  IO channel registry type definitions
+*  Category: Vn7x Bjt Tle941xy Tle9210x Pfm
+******************************************************************************************************************
+*  Revision Management
+*  yyyy.mm.dd    name              version      description
+*  ----------    --------          -------      -----------------------------------
+*  2026.01.09    clipping            v0001        Frist edit
+******************************************************************************************************************
+******************************************************************************************************************/
+/* Include Headerfiles  */
+#ifndef _IOCHNREG_TYPES_H_
+#define _IOCHNREG_TYPES_H_
+
+#include "Std_Types.h"
+
+/* driver owning a logical channel */
+typedef enum
+{
+    IOCHNREG_DRV_NONE,
+    IOCHNREG_DRV_VN7X,
+    IOCHNREG_DRV_BJT,
+    IOCHNREG_DRV_TLE941XY,
+    IOCHNREG_DRV_TLE9210X,
+
+    IOCHNREG_DRV_MAX
+} IoChnReg_DrvType;
+
+/* one row of the registry, group and chip are 0 for the DIO drivers */
+typedef struct
+{
+    uint8 u8Drv;
+    uint8 u8Group;
+    uint8 u8Chip;
+    uint8 u8Chn;
+    uint8 u8Pid;
+} IoChnReg_ChnCfgType;
+
+#endif
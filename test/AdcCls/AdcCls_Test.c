@@ -0,0 +1,172 @@
+/*****************************************************************************************************************
+******************************************************************************************************************
+*  Copyright (C) .
+*  All rights reserved.
+******************************************************************************************************************
+*  FileName: AdcCls_Test
+*  Content:  Host test of the ADC threshold classification against the per channel if/else compare.
+*            Built once with the vector kernel and once with ADCCLS_SIMD_EN = STD_OFF (SWAR).
+*  Category: AdcCls
+******************************************************************************************************************
+*  Revision Management
+*  yyyy.mm.dd    name              version      description
+*  ----------    --------          -------      -----------------------------------
+*  2026.01.22    clipping            v0001        Frist edit
+*  2026.10.18    clipping            v0002        pass/fail test of odd counts, SIMD and SWAR builds
+******************************************************************************************************************
+******************************************************************************************************************/
+/* Include Headerfiles  */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "AdcCls.h"
+
+#define TEST_CHN_MAX    256u
+#define TEST_SETS       16u       /* random input sets per channel count */
+#define TEST_GUARD      0xA5A5A5A5uL
+#define TEST_MASK_WORDS (ADCCLS_MASK_WORDS(TEST_CHN_MAX) + 1u)    /* one guard word behind the masks */
+
+/* value 0 is in front so a run from index 1 starts off the natural 16 byte alignment */
+static uint16 sTest_au16Val[TEST_CHN_MAX + 1u];
+static uint16 sTest_au16OlThr[TEST_CHN_MAX + 1u];
+static uint16 sTest_au16ShortThr[TEST_CHN_MAX + 1u];
+static uint32 sTest_au32Ol[TEST_MASK_WORDS];
+static uint32 sTest_au32Short[TEST_MASK_WORDS];
+static uint32 sTest_au32RefOl[TEST_MASK_WORDS];
+static uint32 sTest_au32RefShort[TEST_MASK_WORDS];
+static uint16 sTest_u16Fail;
+
+static void Test_Check(boolean bOk, const char* pcName)
+{
+    printf("%-48s %s\n", pcName, (bOk == TRUE) ? "ok" : "FAILED");
+    if(bOk != TRUE)
+    {
+        sTest_u16Fail++;
+    }
+}
+
+/* the classification as done per channel in Vn7x/Bjt_DiagHandle before */
+static void Test_Reference(const uint16* val, const uint16* olThr, const uint16* shortThr, uint16 num, uint32* ol, uint32* sh)
+{
+    uint16 i;
+
+    for(i = 0u; i < ADCCLS_MASK_WORDS(num); i++)
+    {
+        ol[i] = 0u;
+        sh[i] = 0u;
+    }
+    for(i = 0u; i < num; i++)
+    {
+        if(val[i] <= olThr[i])
+        {
+            ol[i / 32u] |= (uint32)1u << (i % 32u);
+        }
+        else if(val[i] >= shortThr[i])
+        {
+            sh[i / 32u] |= (uint32)1u << (i % 32u);
+        }
+    }
+}
+
+/* classify num channels from index first, compare against the reference, no write behind the masks */
+static boolean Test_Classify(uint16 first, uint16 num)
+{
+    uint16 i;
+    boolean l_bOk = TRUE;
+
+    for(i = 0u; i < TEST_MASK_WORDS; i++)
+    {
+        sTest_au32Ol[i] = TEST_GUARD;
+        sTest_au32Short[i] = TEST_GUARD;
+    }
+    Test_Reference(&sTest_au16Val[first], &sTest_au16OlThr[first], &sTest_au16ShortThr[first], num,
+                   sTest_au32RefOl, sTest_au32RefShort);
+    AdcCls_Classify(&sTest_au16Val[first], &sTest_au16OlThr[first], &sTest_au16ShortThr[first], num,
+                    sTest_au32Ol, sTest_au32Short);
+    for(i = 0u; i < ADCCLS_MASK_WORDS(num); i++)
+    {
+        if((sTest_au32Ol[i] != sTest_au32RefOl[i]) || (sTest_au32Short[i] != sTest_au32RefShort[i]))
+        {
+            l_bOk = FALSE;
+        }
+    }
+    if((sTest_au32Ol[ADCCLS_MASK_WORDS(num)] != TEST_GUARD) || (sTest_au32Short[ADCCLS_MASK_WORDS(num)] != TEST_GUARD))
+    {
+        l_bOk = FALSE;
+    }
+    return l_bOk;
+}
+
+static void Test_RandomSet(void)
+{
+    uint16 i;
+
+    for(i = 0u; i <= TEST_CHN_MAX; i++)
+    {
+        sTest_au16OlThr[i] = (uint16)(200u + (uint16)(rand() % 100));
+        sTest_au16ShortThr[i] = (uint16)(3500u + (uint16)(rand() % 300));
+        /* 12 bit values spread over open load, normal and short */
+        sTest_au16Val[i] = (uint16)(rand() % 4096);
+    }
+}
+
+int main(void)
+{
+    static const uint16 num[] = { 1u, 2u, 3u, 4u, 5u, 6u, 7u, 8u, 9u, 15u, 16u, 17u, 31u, 32u, 33u, 63u, 64u, 65u, 127u, 255u, 256u };
+    char l_acName[48];
+    uint16 n;
+    uint16 s;
+    uint16 i;
+    boolean l_bOk;
+
+    printf("AdcCls_Classify, ADCCLS_SIMD_EN %s\n", (ADCCLS_SIMD_EN == STD_ON) ? "STD_ON" : "STD_OFF");
+    srand(1u);
+
+    for(n = 0u; n < (uint16)(sizeof(num) / sizeof(num[0])); n++)
+    {
+        l_bOk = TRUE;
+        for(s = 0u; s < TEST_SETS; s++)
+        {
+            Test_RandomSet();
+            l_bOk = (boolean)((Test_Classify(0u, num[n]) == TRUE) && (Test_Classify(1u, num[n]) == TRUE) && (l_bOk == TRUE));
+        }
+        (void)snprintf(l_acName, sizeof(l_acName), "random values, %u channels", (unsigned int)num[n]);
+        Test_Check(l_bOk, l_acName);
+    }
+
+    /* values on and next to both thresholds, the compare has to be exact */
+    for(i = 0u; i <= TEST_CHN_MAX; i++)
+    {
+        sTest_au16OlThr[i] = 300u;
+        sTest_au16ShortThr[i] = 3600u;
+        switch(i % 6u)
+        {
+            case 0u: sTest_au16Val[i] = 299u; break;
+            case 1u: sTest_au16Val[i] = 300u; break;
+            case 2u: sTest_au16Val[i] = 301u; break;
+            case 3u: sTest_au16Val[i] = 3599u; break;
+            case 4u: sTest_au16Val[i] = 3600u; break;
+            default: sTest_au16Val[i] = 3601u; break;
+        }
+    }
+    l_bOk = TRUE;
+    for(n = 1u; n <= 40u; n++)
+    {
+        l_bOk = (boolean)((Test_Classify(0u, n) == TRUE) && (Test_Classify(1u, n) == TRUE) && (l_bOk == TRUE));
+    }
+    Test_Check(l_bOk, "values on the thresholds, 1..40 channels");
+
+    /* full 15 bit range: 0 is open load, 0x7FFF is short */
+    for(i = 0u; i <= TEST_CHN_MAX; i++)
+    {
+        sTest_au16OlThr[i] = (uint16)(rand() % 0x4000);
+        sTest_au16ShortThr[i] = (uint16)(0x4000u + (uint16)(rand() % 0x4000));
+        sTest_au16Val[i] = ((i % 3u) == 0u) ? 0u : (((i % 3u) == 1u) ? 0x7FFFu : (uint16)(rand() % 0x8000));
+    }
+    l_bOk = (boolean)((Test_Classify(0u, 9u) == TRUE) && (Test_Classify(1u, 7u) == TRUE)
+                   && (Test_Classify(0u, TEST_CHN_MAX) == TRUE));
+    Test_Check(l_bOk, "15 bit range");
+
+    printf("%u failed\n", (unsigned int)sTest_u16Fail);
+    return (sTest_u16Fail == 0u) ? 0 : 1;
+}
@@ -0,0 +1,401 @@
+/*****************************************************************************************************************
+******************************************************************************************************************
+*  Copyright (C) .
+*  All rights reserved.
+******************************************************************************************************************
+*  FileName: DrvBench
+*  Content:  Host microbenchmark of the driver kernels: frame building, diagnostic decode, Pfm debounce,
+*            sensor classification and Vn7x thresholds, swept over chips, channels and PIDs.
+*  Category: DrvBench
+******************************************************************************************************************
+*  Revision Management
+*  yyyy.mm.dd    name              version      description
+*  ----------    --------          -------      -----------------------------------
+*  2026.01.24    clipping            v0001        Frist edit
+******************************************************************************************************************
+*  Usage: DrvBench [--filter text] [--repeat n] [--json file]
+*                  [--baseline file] [--tolerance pct] [--inst-tolerance pct]
+*  Every sweep point is calibrated to at least DRVBENCH_SAMPLE_NS per sample and reported as the median
+*  of the samples. Instructions per op are counted with perf_event_open on Linux, "-" where the counter
+*  is not available (other OS, VM without PMU, perf_event_paranoid). --json writes the results, a file
+*  written this way can be given as --baseline later: a point slower than the tolerance (ns/op) or with
+*  more instructions than the instruction tolerance is flagged and the exit code is 1. The instruction
+*  count is the stable figure for a CI gate, ns/op depends on the host load.
+******************************************************************************************************************
+******************************************************************************************************************/
+/* Include Headerfiles  */
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+#include "DrvBench.h"
+
+#define DRVBENCH_RESULT_MAX     128u
+#define DRVBENCH_REPEAT_MAX     31u
+#define DRVBENCH_SAMPLE_NS      2e6       /* minimum duration of one sample */
+#define DRVBENCH_OPS_MAX        (1u << 26)
+#define DRVBENCH_NAME_LEN       40u
+#define DRVBENCH_PARAM_LEN      16u
+
+typedef struct
+{
+    char acKernel[DRVBENCH_NAME_LEN];
+    char acParam[DRVBENCH_PARAM_LEN];
+    uint32 u32N;
+    double dNsPerOp;
+    double dInstPerOp;      /* < 0: no counter */
+} DrvBench_ResultType;
+
+volatile uint32 gDrvBench_u32Sink;
+
+static DrvBench_ResultType sDrvBench_atResult[DRVBENCH_RESULT_MAX];
+static uint32 sDrvBench_u32ResultNum;
+static DrvBench_ResultType sDrvBench_atBase[DRVBENCH_RESULT_MAX];
+static uint32 sDrvBench_u32BaseNum;
+static const char* sDrvBench_pcFilter;
+static uint32 sDrvBench_u32Repeat = 9u;
+static double sDrvBench_dTolerance = 10.0;
+static double sDrvBench_dInstTolerance = 2.0;
+static uint32 sDrvBench_u32Regress;
+static uint32 sDrvBench_u32Rand = 1u;
+static int sDrvBench_iPerfFd = -1;
+
+void DrvBench_Seed(uint32 u32Seed)
+{
+    sDrvBench_u32Rand = (u32Seed != 0u) ? u32Seed : 1u;
+}
+
+/* xorshift32 */
+uint32 DrvBench_Rand(void)
+{
+    uint32 x = sDrvBench_u32Rand;
+
+    x ^= x << 13u;
+    x ^= x >> 17u;
+    x ^= x << 5u;
+    sDrvBench_u32Rand = x;
+    return x;
+}
+
+static double DrvBench_Now(void)
+{
+    struct timespec ts;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+}
+
+static void DrvBench_PerfOpen(void)
+{
+#if defined(__linux__)
+    struct perf_event_attr attr;
+
+    (void)memset(&attr, 0, sizeof(attr));
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.size = sizeof(attr);
+    attr.config = PERF_COUNT_HW_INSTRUCTIONS;
+    attr.disabled = 1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    sDrvBench_iPerfFd = (int)syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0);
+#endif
+}
+
+static void DrvBench_PerfStart(void)
+{
+#if defined(__linux__)
+    if(sDrvBench_iPerfFd >= 0)
+    {
+        (void)ioctl(sDrvBench_iPerfFd, PERF_EVENT_IOC_RESET, 0);
+        (void)ioctl(sDrvBench_iPerfFd, PERF_EVENT_IOC_ENABLE, 0);
+    }
+#endif
+}
+
+/* instructions since DrvBench_PerfStart, < 0 without counter */
+static double DrvBench_PerfStop(void)
+{
+    double dCount = -1.0;
+#if defined(__linux__)
+    unsigned long long u64Count;
+
+    if(sDrvBench_iPerfFd >= 0)
+    {
+        (void)ioctl(sDrvBench_iPerfFd, PERF_EVENT_IOC_DISABLE, 0);
+        if(read(sDrvBench_iPerfFd, &u64Count, sizeof(u64Count)) == (ssize_t)sizeof(u64Count))
+        {
+            dCount = (double)u64Count;
+        }
+    }
+#endif
+    return dCount;
+}
+
+static int DrvBench_CmpDouble(const void* pvA, const void* pvB)
+{
+    double dA = *(const double*)pvA;
+    double dB = *(const double*)pvB;
+
+    return (dA > dB) - (dA < dB);
+}
+
+static double DrvBench_Median(double* pdVal, uint32 u32Num)
+{
+    qsort(pdVal, u32Num, sizeof(double), DrvBench_CmpDouble);
+    return ((u32Num % 2u) != 0u) ? pdVal[u32Num / 2u] : 0.5 * (pdVal[u32Num / 2u - 1u] + pdVal[u32Num / 2u]);
+}
+
+static const DrvBench_ResultType* DrvBench_FindBase(const DrvBench_ResultType* ptRes)
+{
+    const DrvBench_ResultType* ptBase = NULL;
+    uint32 i;
+
+    for(i = 0u; (i < sDrvBench_u32BaseNum) && (ptBase == NULL); i++)
+    {
+        if((strcmp(sDrvBench_atBase[i].acKernel, ptRes->acKernel) == 0)
+            && (strcmp(sDrvBench_atBase[i].acParam, ptRes->acParam) == 0)
+            && (sDrvBench_atBase[i].u32N == ptRes->u32N))
+        {
+            ptBase = &sDrvBench_atBase[i];
+        }
+    }
+    return ptBase;
+}
+
+static void DrvBench_Print(const DrvBench_ResultType* ptRes)
+{
+    const DrvBench_ResultType* ptBase = DrvBench_FindBase(ptRes);
+    char acInst[16];
+    boolean bRegress = FALSE;
+
+    if(ptRes->dInstPerOp >= 0.0)
+    {
+        (void)snprintf(acInst, sizeof(acInst), "%.1f", ptRes->dInstPerOp);
+    }
+    else
+    {
+        (void)snprintf(acInst, sizeof(acInst), "-");
+    }
+    printf("%-28s %-6s %5u %10.2f %10s", ptRes->acKernel, ptRes->acParam, (unsigned)ptRes->u32N, ptRes->dNsPerOp, acInst);
+    if(ptBase != NULL)
+    {
+        if(ptRes->dNsPerOp > ptBase->dNsPerOp * (1.0 + sDrvBench_dTolerance / 100.0))
+        {
+            bRegress = TRUE;
+        }
+        if((ptRes->dInstPerOp >= 0.0) && (ptBase->dInstPerOp >= 0.0)
+            && (ptRes->dInstPerOp > ptBase->dInstPerOp * (1.0 + sDrvBench_dInstTolerance / 100.0)))
+        {
+            bRegress = TRUE;
+        }
+        printf(" %+8.1f%%%s", 100.0 * (ptRes->dNsPerOp / ptBase->dNsPerOp - 1.0), (bRegress == TRUE) ? "  REGRESSION" : "");
+        if(bRegress == TRUE)
+        {
+            sDrvBench_u32Regress++;
+        }
+    }
+    else if(sDrvBench_u32BaseNum > 0u)
+    {
+        printf(" %9s", "new");
+    }
+    printf("\n");
+}
+
+void DrvBench_Run(const char* pcKernel, const char* pcParam, uint32 u32N, DrvBench_RunType pfRun)
+{
+    DrvBench_ResultType* ptRes;
+    double adNs[DRVBENCH_REPEAT_MAX];
+    double adInst[DRVBENCH_REPEAT_MAX];
+    double dT0;
+    double dT;
+    uint32 u32Ops = 1u;
+    uint32 r;
+
+    if(((sDrvBench_pcFilter != NULL) && (strstr(pcKernel, sDrvBench_pcFilter) == NULL))
+        || (sDrvBench_u32ResultNum >= DRVBENCH_RESULT_MAX))
+    {
+        return;
+    }
+
+    /* calibrate, this also warms up caches and branch predictors */
+    for(;;)
+    {
+        dT0 = DrvBench_Now();
+        pfRun(u32Ops);
+        dT = DrvBench_Now() - dT0;
+        if((dT >= DRVBENCH_SAMPLE_NS) || (u32Ops >= DRVBENCH_OPS_MAX))
+        {
+            break;
+        }
+        u32Ops = (dT * 4.0 < DRVBENCH_SAMPLE_NS) ? (u32Ops * 4u) : (uint32)((double)u32Ops * DRVBENCH_SAMPLE_NS / dT * 1.1) + 1u;
+        if(u32Ops > DRVBENCH_OPS_MAX)
+        {
+            u32Ops = DRVBENCH_OPS_MAX;
+        }
+    }
+
+    for(r = 0u; r < sDrvBench_u32Repeat; r++)
+    {
+        DrvBench_PerfStart();
+        dT0 = DrvBench_Now();
+        pfRun(u32Ops);
+        dT = DrvBench_Now() - dT0;
+        adInst[r] = DrvBench_PerfStop();
+        adNs[r] = dT / (double)u32Ops;
+        adInst[r] = (adInst[r] >= 0.0) ? (adInst[r] / (double)u32Ops) : -1.0;
+    }
+
+    ptRes = &sDrvBench_atResult[sDrvBench_u32ResultNum];
+    sDrvBench_u32ResultNum++;
+    (void)snprintf(ptRes->acKernel, sizeof(ptRes->acKernel), "%s", pcKernel);
+    (void)snprintf(ptRes->acParam, sizeof(ptRes->acParam), "%s", pcParam);
+    ptRes->u32N = u32N;
+    ptRes->dNsPerOp = DrvBench_Median(adNs, sDrvBench_u32Repeat);
+    ptRes->dInstPerOp = DrvBench_Median(adInst, sDrvBench_u32Repeat);
+    DrvBench_Print(ptRes);
+}
+
+/* one result per line, as written by DrvBench_WriteJson */
+static int DrvBench_ReadBaseline(const char* pcFile)
+{
+    FILE* fp = fopen(pcFile, "r");
+    char acLine[256];
+    const char* pcInst;
+    DrvBench_ResultType* ptBase;
+    unsigned uN;
+
+    if(fp == NULL)
+    {
+        return -1;
+    }
+    while((fgets(acLine, sizeof(acLine), fp) != NULL) && (sDrvBench_u32BaseNum < DRVBENCH_RESULT_MAX))
+    {
+        ptBase = &sDrvBench_atBase[sDrvBench_u32BaseNum];
+        if(sscanf(acLine, " {\"kernel\": \"%39[^\"]\", \"param\": \"%15[^\"]\", \"n\": %u, \"ns_per_op\": %lf",
+                  ptBase->acKernel, ptBase->acParam, &uN, &ptBase->dNsPerOp) == 4)
+        {
+            ptBase->u32N = (uint32)uN;
+            pcInst = strstr(acLine, "\"inst_per_op\": ");
+            if((pcInst == NULL) || (sscanf(pcInst, "\"inst_per_op\": %lf", &ptBase->dInstPerOp) != 1))
+            {
+                ptBase->dInstPerOp = -1.0;
+            }
+            sDrvBench_u32BaseNum++;
+        }
+    }
+    (void)fclose(fp);
+    return 0;
+}
+
+static int DrvBench_WriteJson(const char* pcFile)
+{
+    FILE* fp = fopen(pcFile, "w");
+    const DrvBench_ResultType* ptRes;
+    uint32 i;
+
+    if(fp == NULL)
+    {
+        return -1;
+    }
+    fprintf(fp, "{\n  \"bench\": \"DrvBench\",\n  \"repeat\": %u,\n  \"perf\": %s,\n  \"results\": [\n",
+            (unsigned)sDrvBench_u32Repeat, (sDrvBench_iPerfFd >= 0) ? "true" : "false");
+    for(i = 0u; i < sDrvBench_u32ResultNum; i++)
+    {
+        ptRes = &sDrvBench_atResult[i];
+        fprintf(fp, "    {\"kernel\": \"%s\", \"param\": \"%s\", \"n\": %u, \"ns_per_op\": %.3f, ",
+                ptRes->acKernel, ptRes->acParam, (unsigned)ptRes->u32N, ptRes->dNsPerOp);
+        if(ptRes->dInstPerOp >= 0.0)
+        {
+            fprintf(fp, "\"inst_per_op\": %.2f}", ptRes->dInstPerOp);
+        }
+        else
+        {
+            fprintf(fp, "\"inst_per_op\": null}");
+        }
+        fprintf(fp, "%s\n", (i + 1u < sDrvBench_u32ResultNum) ? "," : "");
+    }
+    fprintf(fp, "  ]\n}\n");
+    return (fclose(fp) == 0) ? 0 : -1;
+}
+
+static void DrvBench_Usage(void)
+{
+    printf("usage: DrvBench [--filter text] [--repeat n] [--json file]\n"
+           "                [--baseline file] [--tolerance pct] [--inst-tolerance pct]\n");
+}
+
+int main(int argc, char* argv[])
+{
+    const char* pcJson = NULL;
+    const char* pcBase = NULL;
+    int i;
+
+    for(i = 1; i < argc; i++)
+    {
+        if((strcmp(argv[i], "--filter") == 0) && (i + 1 < argc))
+        {
+            sDrvBench_pcFilter = argv[++i];
+        }
+        else if((strcmp(argv[i], "--repeat") == 0) && (i + 1 < argc))
+        {
+            sDrvBench_u32Repeat = (uint32)strtoul(argv[++i], NULL, 10);
+        }
+        else if((strcmp(argv[i], "--json") == 0) && (i + 1 < argc))
+        {
+            pcJson = argv[++i];
+        }
+        else if((strcmp(argv[i], "--baseline") == 0) && (i + 1 < argc))
+        {
+            pcBase = argv[++i];
+        }
+        else if((strcmp(argv[i], "--tolerance") == 0) && (i + 1 < argc))
+        {
+            sDrvBench_dTolerance = strtod(argv[++i], NULL);
+        }
+        else if((strcmp(argv[i], "--inst-tolerance") == 0) && (i + 1 < argc))
+        {
+            sDrvBench_dInstTolerance = strtod(argv[++i], NULL);
+        }
+        else
+        {
+            DrvBench_Usage();
+            return 2;
+        }
+    }
+    if((sDrvBench_u32Repeat == 0u) || (sDrvBench_u32Repeat > DRVBENCH_REPEAT_MAX))
+    {
+        printf("--repeat must be 1..%u\n", (unsigned)DRVBENCH_REPEAT_MAX);
+        return 2;
+    }
+    if((pcBase != NULL) && (DrvBench_ReadBaseline(pcBase) != 0))
+    {
+        printf("cannot read baseline %s\n", pcBase);
+        return 2;
+    }
+
+    DrvBench_PerfOpen();
+    printf("%-28s %-6s %5s %10s %10s%s\n", "kernel", "param", "n", "ns/op", "inst/op", (pcBase != NULL) ? "   vs base" : "");
+    DrvBench_Tle941xy();
+    DrvBench_Tle9210x();
+    DrvBench_Vn7x();
+    DrvBench_Pfm();
+    DrvBench_Sensor();
+
+    if((pcJson != NULL) && (DrvBench_WriteJson(pcJson) != 0))
+    {
+        printf("cannot write %s\n", pcJson);
+        return 2;
+    }
+    if(pcBase != NULL)
+    {
+        printf("%u regression(s) against %s\n", (unsigned)sDrvBench_u32Regress, pcBase);
+    }
+    return (sDrvBench_u32Regress == 0u) ? 0 : 1;
+}
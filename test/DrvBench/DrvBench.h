@@ -0,0 +1,44 @@
+/*****************************************************************************************************************
+******************************************************************************************************************
+*  Copyright (C) .
+*  All rights reserved.
+******************************************************************************************************************
+*  FileName: DrvBench
+*  Content:  Host microbenchmark of the driver kernels, harness interface.
+*  Category: DrvBench
+******************************************************************************************************************
+*  Revision Management
+*  yyyy.mm.dd    name              version      description
+*  ----------    --------          -------      -----------------------------------
+*  2026.01.24    clipping            v0001        Frist edit
+******************************************************************************************************************
+******************************************************************************************************************/
+/* Include Headerfiles  */
+#ifndef _DRVBENCH_H_
+#define _DRVBENCH_H_
+
+#include "Std_Types.h"
+
+/* runs the kernel u32Ops times, one op is one call of the measured function */
+typedef void (*DrvBench_RunType)(uint32 u32Ops);
+
+/* measure one sweep point: u32N is the value of the swept parameter pcParam */
+extern void DrvBench_Run(const char* pcKernel, const char* pcParam, uint32 u32N, DrvBench_RunType pfRun);
+/* reproducible input data, every suite seeds before it fills its inputs */
+extern void DrvBench_Seed(uint32 u32Seed);
+extern uint32 DrvBench_Rand(void);
+/* results are folded in here so the compiler keeps the measured work */
+extern volatile uint32 gDrvBench_u32Sink;
+
+/* kernel suites, each sweeps its own dimension */
+extern void DrvBench_Tle941xy(void);
+extern void DrvBench_Tle9210x(void);
+extern void DrvBench_Vn7x(void);
+extern void DrvBench_Pfm(void);
+extern void DrvBench_Sensor(void);
+
+/* host SPI fake: received frames are taken from a random pool, the bits in u8ErrMask are
+   cleared so the status bytes never flag a frame error and every frame is accepted */
+extern void DrvBench_SpiInit(uint8 u8ErrMask);
+
+#endif
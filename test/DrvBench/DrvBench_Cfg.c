@@ -0,0 +1,47 @@
+/*****************************************************************************************************************
+******************************************************************************************************************
+*  Copyright (C) .
+*  All rights reserved.
+******************************************************************************************************************
+*  FileName: DrvBench_Cfg
+*  Content:  Host configuration of the benchmarked drivers.
+*  Category: DrvBench
+******************************************************************************************************************
+*  Revision Management
+*  yyyy.mm.dd    name              version      description
+*  ----------    --------          -------      -----------------------------------
+*  2026.01.24    clipping            v0001        Frist edit
+******************************************************************************************************************
+******************************************************************************************************************/
+/* Include Headerfiles  */
+#include "Tle941xy_HwCfg.h"
+#include "Tle9210x_HwCfg.h"
+#include "Vn7x_HwCfg.h"
+
+/* The target *_HwCfg.c name the MCAL SPI/DIO/ADC channels of the board, the host fakes
+   ignore them. The tables are zero (all channels OFF/default) unless a kernel depends on
+   a value, and sized by the enlarged enums of the scaled copy. */
+
+const Tle941xy_GroupType cTle941xy_atGroupCfg[TLE941XY_GROUP_MAX];
+const Tle941xy_ChipType cTle941xy_atChipCfg[TLE941XY_GROUP_MAX][TLE941XY_CHIP_MAX];
+const uint8 cTle941xy_au8ChnModeCfg[TLE941XY_GROUP_MAX][TLE941XY_CHIP_MAX][TLE941XY_CHANNEL_MAX];
+const Tle941xy_PwmType cTle941xy_atChipFmPwmFreqCfg[TLE941XY_GROUP_MAX][TLE941XY_CHIP_MAX];
+const boolean cTle941xy_abChipFreeWheelingCfg[TLE941XY_GROUP_MAX][TLE941XY_CHIP_MAX][TLE941XY_CHANNEL_MAX];
+const boolean cTle941xy_abChipHS1And2LedModeCfg[TLE941XY_GROUP_MAX][TLE941XY_CHIP_MAX][2];
+#if(TLE941XY_DERATE_EN == STD_ON)
+const uint8 cTle941xy_au8DerateDutyCfg[TLE941XY_DERATE_LVL_MAX] =
+{
+    100u, 75u, 50u
+};
+const uint8 cTle941xy_au8ChnPrioCfg[TLE941XY_GROUP_MAX][TLE941XY_CHIP_MAX][TLE941XY_CHANNEL_MAX];
+#endif
+
+const Tle9210x_GroupType cTle9210x_atGroupCfg[TLE9210X_GROUP_MAX];
+const Tle9210x_ChipType cTle9210x_atChipCfg[TLE9210X_GROUP_MAX][TLE9210X_CHIP_MAX];
+const Tle9210x_PwmChnType cTle9210x_atPwmChnCfg[TLE9210X_GROUP_MAX][TLE9210X_CHIP_MAX][TLE9210X_PWM_CHN_MAX];
+const Tle9210x_HbChnType cTle9210x_atHbChnCfg[TLE9210X_GROUP_MAX][TLE9210X_CHIP_MAX][TLE9210X_HB_CHN_MAX];
+#if(TLE9210X_RIPPLE_EN == STD_ON)
+const Tle9210x_RippleMotorType cTle9210x_atRippleCfg[TLE9210X_RIPPLE_MOTOR_MAX];
+#endif
+
+const Vn7x_ChnCfgType cVn7x_atChannelInputCfg[VN7X_ID_MAX];
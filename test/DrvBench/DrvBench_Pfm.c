@@ -0,0 +1,65 @@
+/*****************************************************************************************************************
+******************************************************************************************************************
+*  Copyright (C) .
+*  All rights reserved.
+******************************************************************************************************************
+*  FileName: DrvBench_Pfm
+*  Content:  Pfm debounce cycle over the active PID count.
+*  Category: DrvBench
+******************************************************************************************************************
+*  Revision Management
+*  yyyy.mm.dd    name              version      description
+*  ----------    --------          -------      -----------------------------------
+*  2026.01.24    clipping            v0001        Frist edit
+******************************************************************************************************************
+******************************************************************************************************************/
+/* Include Headerfiles  */
+/* the active PID list is static, Pfm is compiled into this unit */
+#include "Pfm.c"
+#include "DrvBench.h"
+
+static uint8 sDrvBench_au8Pid[PFM_PID_SIZE];
+
+static void DrvBench_Pfm10ms(uint32 u32Ops)
+{
+    uint32 i;
+
+    for(i = 0u; i < u32Ops; i++)
+    {
+        Pfm_10ms();
+    }
+}
+
+/* active PIDs: the debounce loop runs over them, snapshot and NV packing over PFM_PID_SIZE.
+   PIDs past the generated ones have zero filter times and confirm in every cycle. */
+void DrvBench_Pfm(void)
+{
+    static const uint8 cau8Pids[] = { 16u, 32u, 64u, 128u, 240u };
+    static const PFM_DefectDetectState_e caeState[] = { PFM_DDS_POS, PFM_DDS_NEG, PFM_DDS_ING };
+    uint16 u16Pid;
+    uint8 i;
+
+    Pfm_Init();
+    DrvBench_Seed(0x9F30u);
+    for(u16Pid = 1u; u16Pid < (uint16)PFM_PID_SIZE; u16Pid++)
+    {
+        sDrvBench_au8Pid[u16Pid - 1u] = (uint8)u16Pid;
+        Pfm_DefectReport((PFM_PhysicalId_e)u16Pid, caeState[DrvBench_Rand() % 3u],
+                         caeState[DrvBench_Rand() % 3u], caeState[DrvBench_Rand() % 3u]);
+    }
+    /* run out the settle time of the enable conditions */
+    Pfm_ActivePidNum = 0u;
+    for(i = 0u; i <= PFM_ENC_SETTLE_TIME; i++)
+    {
+        Pfm_10ms();
+    }
+    Pfm_ActivePid = sDrvBench_au8Pid;
+    for(i = 0u; i < (uint8)sizeof(cau8Pids); i++)
+    {
+        if(cau8Pids[i] < (uint8)PFM_PID_SIZE)
+        {
+            Pfm_ActivePidNum = cau8Pids[i];
+            DrvBench_Run("Pfm_10ms", "pids", cau8Pids[i], DrvBench_Pfm10ms);
+        }
+    }
+}
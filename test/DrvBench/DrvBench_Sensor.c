@@ -0,0 +1,78 @@
+/*****************************************************************************************************************
+******************************************************************************************************************
+*  Copyright (C) .
+*  All rights reserved.
+******************************************************************************************************************
+*  FileName: DrvBench_Sensor
+*  Content:  IoWrp ADC sensor classification over the range table length.
+*  Category: DrvBench
+******************************************************************************************************************
+*  Revision Management
+*  yyyy.mm.dd    name              version      description
+*  ----------    --------          -------      -----------------------------------
+*  2026.01.24    clipping            v0001        Frist edit
+******************************************************************************************************************
+******************************************************************************************************************/
+/* Include Headerfiles  */
+#include "IoWrp_Sensor.h"
+#include "DrvBench.h"
+
+#define DRVBENCH_SENSOR_RANGE_MAX   64u
+#define DRVBENCH_SENSOR_SAMPLES     256u      /* cycled by the uint8 index */
+
+static AdcRange sDrvBench_atRange[DRVBENCH_SENSOR_RANGE_MAX];
+static uint16 sDrvBench_au16Sample[DRVBENCH_SENSOR_SAMPLES];
+static uint8 sDrvBench_u8Sample;
+static SensorAdc sDrvBench_tSensor;
+
+static Std_ReturnType DrvBench_SensorRead(void* pvValue)
+{
+    *(uint16*)pvValue = sDrvBench_au16Sample[sDrvBench_u8Sample];
+    sDrvBench_u8Sample++;
+    return E_OK;
+}
+
+static Std_ReturnType DrvBench_SensorWrite(uint8 u8Value)
+{
+    gDrvBench_u32Sink += u8Value;
+    return E_OK;
+}
+
+static void DrvBench_SensorAdcTransfor(uint32 u32Ops)
+{
+    uint32 i;
+
+    for(i = 0u; i < u32Ops; i++)
+    {
+        Sensor_AdcTransfor(&sDrvBench_tSensor);
+    }
+}
+
+/* ranges: the classification walks the sorted range table up to the sample */
+void DrvBench_Sensor(void)
+{
+    static const uint8 cau8Ranges[] = { 2u, 4u, 8u, 16u, 32u, 64u };
+    uint16 i;
+    uint8 n;
+
+    DrvBench_Seed(0x5E45u);
+    for(i = 0u; i < DRVBENCH_SENSOR_SAMPLES; i++)
+    {
+        sDrvBench_au16Sample[i] = (uint16)(DrvBench_Rand() % 4096u);
+    }
+    sDrvBench_tSensor.SensorType = U8;
+    sDrvBench_tSensor.ReadAdcValue = DrvBench_SensorRead;
+    sDrvBench_tSensor.AdcRanges = sDrvBench_atRange;
+    sDrvBench_tSensor.SensorUnion.Write8BitValue = DrvBench_SensorWrite;
+    for(n = 0u; n < (uint8)sizeof(cau8Ranges); n++)
+    {
+        /* upper bounds spread evenly over the 12 bit range, the last one catches all */
+        for(i = 0u; i < cau8Ranges[n]; i++)
+        {
+            sDrvBench_atRange[i].AdcValue = (uint16)(4096u * (i + 1u) / cau8Ranges[n]);
+            sDrvBench_atRange[i].Range = (uint8)i;
+        }
+        sDrvBench_tSensor.RangeLenth = cau8Ranges[n];
+        DrvBench_Run("Sensor_AdcTransfor", "ranges", cau8Ranges[n], DrvBench_SensorAdcTransfor);
+    }
+}
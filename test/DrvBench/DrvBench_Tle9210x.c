@@ -0,0 +1,68 @@
+/*****************************************************************************************************************
+******************************************************************************************************************
+*  Copyright (C) .
+*  All rights reserved.
+******************************************************************************************************************
+*  FileName: DrvBench_Tle9210x
+*  Content:  Frame building and overvoltage decode of Tle9210x over the chips per chain.
+*  Category: DrvBench
+******************************************************************************************************************
+*  Revision Management
+*  yyyy.mm.dd    name              version      description
+*  ----------    --------          -------      -----------------------------------
+*  2026.01.24    clipping            v0001        Frist edit
+******************************************************************************************************************
+******************************************************************************************************************/
+/* Include Headerfiles  */
+/* the kernels are static, the driver is compiled into this unit */
+#include "Tle9210x.c"
+#include "DrvBench.h"
+
+static uint8 sDrvBench_au8Reg[TLE9210X_CHIP_MAX];
+static uint16 sDrvBench_au16Data[TLE9210X_CHIP_MAX];
+
+static void DrvBench_Tle9210xWriteReg(uint32 u32Ops)
+{
+    uint32 i;
+
+    for(i = 0u; i < u32Ops; i++)
+    {
+        sDrvBench_au16Data[0] = (uint16)i;
+        Tle9210x_WriteReg(TLE9210X_GROUP_0, sDrvBench_au8Reg, sDrvBench_au16Data);
+    }
+}
+
+static void DrvBench_Tle9210xOVDiag(uint32 u32Ops)
+{
+    uint32 i;
+
+    for(i = 0u; i < u32Ops; i++)
+    {
+        Tle9210x_OVDiagnostic(TLE9210X_GROUP_0);
+    }
+}
+
+/* chips per daisy chain: one frame carries an address byte and 16 bit data per chip */
+void DrvBench_Tle9210x(void)
+{
+    static const uint8 cau8Chips[] = { 1u, 2u, 4u, 8u };
+    uint8 i;
+    uint8 j;
+
+    DrvBench_SpiInit(TLE9210X_GSB_SPI_ERR);
+    for(j = 0u; j < TLE9210X_CHIP_MAX; j++)
+    {
+        sDrvBench_au8Reg[j] = TLE9210X_HBMODE;
+        sDrvBench_au16Data[j] = 0x5555u;
+    }
+    for(i = 0u; i < (uint8)sizeof(cau8Chips); i++)
+    {
+        if(cau8Chips[i] <= TLE9210X_CHIP_MAX)
+        {
+            sTle9210x_au8ChipNum[TLE9210X_GROUP_0] = cau8Chips[i];
+            sTle9210x_abFrameLost[TLE9210X_GROUP_0] = FALSE;
+            DrvBench_Run("Tle9210x_WriteReg", "chips", cau8Chips[i], DrvBench_Tle9210xWriteReg);
+            DrvBench_Run("Tle9210x_OVDiagnostic", "chips", cau8Chips[i], DrvBench_Tle9210xOVDiag);
+        }
+    }
+}
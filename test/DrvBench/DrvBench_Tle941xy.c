@@ -0,0 +1,84 @@
+/*****************************************************************************************************************
+******************************************************************************************************************
+*  Copyright (C) .
+*  All rights reserved.
+******************************************************************************************************************
+*  FileName: DrvBench_Tle941xy
+*  Content:  Frame building and diagnostic decode of Tle941xy over the chips per chain.
+*  Category: DrvBench
+******************************************************************************************************************
+*  Revision Management
+*  yyyy.mm.dd    name              version      description
+*  ----------    --------          -------      -----------------------------------
+*  2026.01.24    clipping            v0001        Frist edit
+******************************************************************************************************************
+******************************************************************************************************************/
+/* Include Headerfiles  */
+/* the kernels are static, the driver is compiled into this unit */
+#include "Tle941xy.c"
+#include "DrvBench.h"
+
+static uint8 sDrvBench_au8Reg[TLE941XY_CHIP_MAX];
+static uint8 sDrvBench_au8Data[TLE941XY_CHIP_MAX];
+
+static void DrvBench_Tle941xyWriteReg(uint32 u32Ops)
+{
+    uint32 i;
+
+    for(i = 0u; i < u32Ops; i++)
+    {
+        sDrvBench_au8Data[0] = (uint8)i;
+        Tle941xy_WriteReg(TLE941XY_GROUP_0, sDrvBench_au8Reg, sDrvBench_au8Data);
+    }
+}
+
+static void DrvBench_Tle941xyShortDiag(uint32 u32Ops)
+{
+    uint32 i;
+
+    for(i = 0u; i < u32Ops; i++)
+    {
+        Tle941xy_ShortDiagnostic(TLE941XY_GROUP_0);
+    }
+}
+
+static void DrvBench_Tle941xyOLDiag(uint32 u32Ops)
+{
+    uint32 i;
+
+    for(i = 0u; i < u32Ops; i++)
+    {
+        Tle941xy_OLDiagnostic(TLE941XY_GROUP_0);
+    }
+}
+
+/* chips per daisy chain: one frame carries one byte pair per chip */
+void DrvBench_Tle941xy(void)
+{
+    static const uint8 cau8Chips[] = { 1u, 2u, 4u, 8u };
+    uint8 i;
+    uint8 j;
+    uint8 k;
+
+    DrvBench_SpiInit(TLE941XY_GSB_SPI_ERR);
+    for(j = 0u; j < TLE941XY_CHIP_MAX; j++)
+    {
+        sDrvBench_au8Reg[j] = TLE941XY_HB_ACT_1_CTRL;
+        sDrvBench_au8Data[j] = 0x55u;
+        for(k = 0u; k < TLE941XY_CHANNEL_MAX; k++)
+        {
+            sTle941xy_u8HbOutSts[TLE941XY_GROUP_0][j][k] = (uint8)(DrvBench_Rand() % 3u);
+        }
+    }
+    for(i = 0u; i < (uint8)sizeof(cau8Chips); i++)
+    {
+        if(cau8Chips[i] <= TLE941XY_CHIP_MAX)
+        {
+            sTle941xy_au8ChipNum[TLE941XY_GROUP_0] = cau8Chips[i];
+            sTle941xy_abFrameLost[TLE941XY_GROUP_0] = FALSE;
+            DrvBench_Run("Tle941xy_WriteReg", "chips", cau8Chips[i], DrvBench_Tle941xyWriteReg);
+            DrvBench_Run("Tle941xy_ShortDiagnostic", "chips", cau8Chips[i], DrvBench_Tle941xyShortDiag);
+            DrvBench_Run("Tle941xy_OLDiagnostic", "chips", cau8Chips[i], DrvBench_Tle941xyOLDiag);
+        }
+    }
+}
@@ -0,0 +1,55 @@
+/*****************************************************************************************************************
+******************************************************************************************************************
+*  Copyright (C) .
+*  All rights reserved.
+******************************************************************************************************************
+*  FileName: DrvBench_Vn7x
+*  Content:  Vn7x threshold diagnostic over the channel count.
+*  Category: DrvBench
+******************************************************************************************************************
+*  Revision Management
+*  yyyy.mm.dd    name              version      description
+*  ----------    --------          -------      -----------------------------------
+*  2026.01.24    clipping            v0001        Frist edit
+******************************************************************************************************************
+******************************************************************************************************************/
+/* Include Headerfiles  */
+/* the kernels are static, the driver is compiled into this unit */
+#include "Vn7x.c"
+#include "DrvBench.h"
+
+static void DrvBench_Vn7xDiagHandle(uint32 u32Ops)
+{
+    uint32 i;
+
+    for(i = 0u; i < u32Ops; i++)
+    {
+        Vn7x_DiagHandle();
+    }
+}
+
+/* channels: one threshold pair, one ADC value and one Pfm report per channel */
+void DrvBench_Vn7x(void)
+{
+    static const uint8 cau8Chn[] = { 4u, 8u, 16u, 32u };
+    uint8 i;
+
+    DrvBench_Seed(0x7E01u);
+    for(i = 0u; i < VN7X_ID_MAX; i++)
+    {
+        sVn7x_au16OlThr[i] = (uint16)(200u + DrvBench_Rand() % 100u);
+        sVn7x_au16ShortThr[i] = (uint16)(3500u + DrvBench_Rand() % 300u);
+        /* 12 bit values spread over open load, normal and short */
+        gVn7x_au16DiagAdcV[i] = (Adc_ValueGroupType)(DrvBench_Rand() % 4096u);
+    }
+    sVn7x_u32ChnSts = DrvBench_Rand();
+    sVn7x_u8ChnSel = VN7X_DAIG_SEL_CHN_ZERO;
+    for(i = 0u; i < (uint8)sizeof(cau8Chn); i++)
+    {
+        if(cau8Chn[i] <= VN7X_ID_MAX)
+        {
+            sVn7x_u8ChnNum = cau8Chn[i];
+            DrvBench_Run("Vn7x_DiagHandle", "chn", cau8Chn[i], DrvBench_Vn7xDiagHandle);
+        }
+    }
+}
@@ -0,0 +1,34 @@
+/*****************************************************************************************************************
+******************************************************************************************************************
+*  Copyright (C) .
+*  All rights reserved.
+******************************************************************************************************************
+*  FileName: Adc
+*  Content:  Host fake of the ADC driver, see DrvBench_Mcal.c.
+*  Category: DrvBench
+******************************************************************************************************************
+*  Revision Management
+*  yyyy.mm.dd    name              version      description
+*  ----------    --------          -------      -----------------------------------
+*  2026.01.24    clipping            v0001        Frist edit
+******************************************************************************************************************
+******************************************************************************************************************/
+#ifndef _ADC_H_
+#define _ADC_H_
+
+#include "Std_Types.h"
+
+typedef uint16 Adc_ValueGroupType;
+typedef uint8 Adc_GroupType;
+typedef uint8 Adc_StreamNumSampleType;
+
+/* groups named by the driver configuration headers */
+#define AdcConf_AdcGroup_AdcGroup_Vn7xDiag  0u
+#define AdcConf_AdcGroup_AdcGroup_BjtDiag   1u
+
+extern Std_ReturnType Adc_SetupResultBuffer(Adc_GroupType Group, Adc_ValueGroupType* DataBufferPtr);
+extern Std_ReturnType Adc_ReadGroup(Adc_GroupType Group, Adc_ValueGroupType* DataBufferPtr);
+extern void Adc_EnableHardwareTrigger(Adc_GroupType Group);
+extern Adc_StreamNumSampleType Adc_GetStreamLastPointer(Adc_GroupType Group, Adc_ValueGroupType** PtrToSamplePtr);
+
+#endif
@@ -0,0 +1,22 @@
+/*****************************************************************************************************************
+******************************************************************************************************************
+*  Copyright (C) .
+*  All rights reserved.
+******************************************************************************************************************
+*  FileName: Compiler_Cfg
+*  Content:  Host build: no module specific memory or pointer classes, gcc alignment.
+*  Category: DrvBench
+******************************************************************************************************************
+*  Revision Management
+*  yyyy.mm.dd    name              version      description
+*  ----------    --------          -------      -----------------------------------
+*  2026.01.24    clipping            v0001        Frist edit
+******************************************************************************************************************
+******************************************************************************************************************/
+#ifndef _COMPILER_CFG_H_
+#define _COMPILER_CFG_H_
+
+/* IoWrp sensor image: start of a data cache line */
+#define IOWRP_ALIGN(size) __attribute__((aligned(size)))
+
+#endif
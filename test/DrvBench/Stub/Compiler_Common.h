@@ -0,0 +1,21 @@
+/*****************************************************************************************************************
+******************************************************************************************************************
+*  Copyright (C) .
+*  All rights reserved.
+******************************************************************************************************************
+*  FileName: Compiler_Common
+*  Content:  Host build: common compiler abstraction symbols.
+*  Category: DrvBench
+******************************************************************************************************************
+*  Revision Management
+*  yyyy.mm.dd    name              version      description
+*  ----------    --------          -------      -----------------------------------
+*  2026.01.24    clipping            v0001        Frist edit
+******************************************************************************************************************
+******************************************************************************************************************/
+#ifndef _COMPILER_COMMON_H_
+#define _COMPILER_COMMON_H_
+
+#define NULL_PTR ((void *)0)
+
+#endif
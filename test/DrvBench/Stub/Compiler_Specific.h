@@ -0,0 +1,21 @@
+/*****************************************************************************************************************
+******************************************************************************************************************
+*  Copyright (C) .
+*  All rights reserved.
+******************************************************************************************************************
+*  FileName: Compiler_Specific
+*  Content:  Host build: gcc/clang specific compiler abstraction symbols.
+*  Category: DrvBench
+******************************************************************************************************************
+*  Revision Management
+*  yyyy.mm.dd    name              version      description
+*  ----------    --------          -------      -----------------------------------
+*  2026.01.24    clipping            v0001        Frist edit
+******************************************************************************************************************
+******************************************************************************************************************/
+#ifndef _COMPILER_SPECIFIC_H_
+#define _COMPILER_SPECIFIC_H_
+
+#define COMPILER_SPECIFIC_INLINE inline
+
+#endif
@@ -0,0 +1,26 @@
+/*****************************************************************************************************************
+******************************************************************************************************************
+*  Copyright (C) .
+*  All rights reserved.
+******************************************************************************************************************
+*  FileName: Dio
+*  Content:  Host fake of the DIO driver, see DrvBench_Mcal.c.
+*  Category: DrvBench
+******************************************************************************************************************
+*  Revision Management
+*  yyyy.mm.dd    name              version      description
+*  ----------    --------          -------      -----------------------------------
+*  2026.01.24    clipping            v0001        Frist edit
+******************************************************************************************************************
+******************************************************************************************************************/
+#ifndef _DIO_H_
+#define _DIO_H_
+
+#include "Std_Types.h"
+
+typedef uint8 Dio_ChannelType;
+typedef uint8 Dio_LevelType;
+
+extern void Dio_WriteChannel(Dio_ChannelType ChannelId, Dio_LevelType Level);
+
+#endif
@@ -0,0 +1,131 @@
+/*****************************************************************************************************************
+******************************************************************************************************************
+*  Copyright (C) .
+*  All rights reserved.
+******************************************************************************************************************
+*  FileName: DrvBench_Mcal
+*  Content:  Host fakes of the MCAL drivers and DEM called by the benchmarked kernels.
+*  Category: DrvBench
+******************************************************************************************************************
+*  Revision Management
+*  yyyy.mm.dd    name              version      description
+*  ----------    --------          -------      -----------------------------------
+*  2026.01.24    clipping            v0001        Frist edit
+******************************************************************************************************************
+******************************************************************************************************************/
+/* Include Headerfiles  */
+#include <string.h>
+#include "Spi.h"
+#include "Dio.h"
+#include "Pwm.h"
+#include "Adc.h"
+#include "dem.h"
+#include "NvM.h"
+#include "DrvBench.h"
+
+#define DRVBENCH_SPI_POOL       256u      /* power of 2, frames start at a rotating offset */
+#define DRVBENCH_SPI_FRAME_MAX  64u
+#define DRVBENCH_SPI_STEP       13u
+
+static uint8 sDrvBench_au8SpiPool[DRVBENCH_SPI_POOL + DRVBENCH_SPI_FRAME_MAX];
+static uint16 sDrvBench_u16SpiPos;
+static Spi_DataBufferType* sDrvBench_pu8SpiRx;
+static Spi_NumberOfDataType sDrvBench_u16SpiLen;
+
+void DrvBench_SpiInit(uint8 u8ErrMask)
+{
+    uint16 i;
+
+    DrvBench_Seed(0x5A17u);
+    for(i = 0u; i < (uint16)sizeof(sDrvBench_au8SpiPool); i++)
+    {
+        sDrvBench_au8SpiPool[i] = (uint8)(DrvBench_Rand() & (uint8)~u8ErrMask);
+    }
+    sDrvBench_u16SpiPos = 0u;
+}
+
+Std_ReturnType Spi_SetupEB(Spi_ChannelType Channel, const Spi_DataBufferType* SrcDataBufferPtr,
+                           Spi_DataBufferType* DesDataBufferPtr, Spi_NumberOfDataType Length)
+{
+    Std_ReturnType l_u8RetVal = E_NOT_OK;
+
+    (void)Channel;
+    (void)SrcDataBufferPtr;
+    if(Length <= DRVBENCH_SPI_FRAME_MAX)
+    {
+        sDrvBench_pu8SpiRx = DesDataBufferPtr;
+        sDrvBench_u16SpiLen = Length;
+        l_u8RetVal = E_OK;
+    }
+    return l_u8RetVal;
+}
+
+Std_ReturnType Spi_SyncTransmit(Spi_SequenceType Sequence)
+{
+    (void)Sequence;
+    (void)memcpy(sDrvBench_pu8SpiRx, &sDrvBench_au8SpiPool[sDrvBench_u16SpiPos], sDrvBench_u16SpiLen);
+    sDrvBench_u16SpiPos = (uint16)((sDrvBench_u16SpiPos + DRVBENCH_SPI_STEP) & (DRVBENCH_SPI_POOL - 1u));
+    return E_OK;
+}
+
+void Dio_WriteChannel(Dio_ChannelType ChannelId, Dio_LevelType Level)
+{
+    gDrvBench_u32Sink += (uint32)ChannelId ^ (uint32)Level;
+}
+
+void Pwm_SetDutyCycle(Pwm_ChannelType ChannelNumber, uint16 DutyCycle)
+{
+    gDrvBench_u32Sink += (uint32)ChannelNumber ^ (uint32)DutyCycle;
+}
+
+Std_ReturnType Adc_SetupResultBuffer(Adc_GroupType Group, Adc_ValueGroupType* DataBufferPtr)
+{
+    (void)Group;
+    (void)DataBufferPtr;
+    return E_OK;
+}
+
+Std_ReturnType Adc_ReadGroup(Adc_GroupType Group, Adc_ValueGroupType* DataBufferPtr)
+{
+    (void)Group;
+    (void)DataBufferPtr;
+    return E_OK;
+}
+
+void Adc_EnableHardwareTrigger(Adc_GroupType Group)
+{
+    (void)Group;
+}
+
+Adc_StreamNumSampleType Adc_GetStreamLastPointer(Adc_GroupType Group, Adc_ValueGroupType** PtrToSamplePtr)
+{
+    (void)Group;
+    (void)PtrToSamplePtr;
+    return 0u;
+}
+
+Std_ReturnType Dem_SetEventStatus(Dem_EventIdType EventId, Dem_EventStatusType EventStatus)
+{
+    gDrvBench_u32Sink += (uint32)EventId ^ (uint32)EventStatus;
+    return E_OK;
+}
+
+Std_ReturnType NvM_GetErrorStatus(NvM_BlockIdType BlockId, NvM_RequestResultType* RequestResultPtr)
+{
+    (void)BlockId;
+    *RequestResultPtr = NVM_REQ_NV_INVALIDATED;
+    return E_OK;
+}
+
+Std_ReturnType NvM_SetRamBlockStatus(NvM_BlockIdType BlockId, boolean BlockChanged)
+{
+    gDrvBench_u32Sink += (uint32)BlockId ^ (uint32)BlockChanged;
+    return E_OK;
+}
+
+Std_ReturnType NvM_WriteBlock(NvM_BlockIdType BlockId, const void* NvM_SrcPtr)
+{
+    (void)NvM_SrcPtr;
+    gDrvBench_u32Sink += (uint32)BlockId;
+    return E_OK;
+}
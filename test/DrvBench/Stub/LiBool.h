@@ -0,0 +1,24 @@
+/*****************************************************************************************************************
+******************************************************************************************************************
+*  Copyright (C) .
+*  All rights reserved.
+******************************************************************************************************************
+*  FileName: LiBool
+*  Content:  Host build: bit access macros used by the drivers.
+*  Category: DrvBench
+******************************************************************************************************************
+*  Revision Management
+*  yyyy.mm.dd    name              version      description
+*  ----------    --------          -------      -----------------------------------
+*  2026.01.24    clipping            v0001        Frist edit
+******************************************************************************************************************
+******************************************************************************************************************/
+#ifndef _LIBOOL_H_
+#define _LIBOOL_H_
+
+#define SETBIT_U16(val, bit)    ((val) |= (uint16)((uint16)1u << (bit)))
+#define CLRBIT_U16(val, bit)    ((val) &= (uint16)~(uint16)((uint16)1u << (bit)))
+#define GETBIT_U16(val, bit)    ((((uint16)(val) >> (bit)) & 1u) != 0u)
+#define GETBIT_U32(val, bit)    ((((uint32)(val) >> (bit)) & 1u) != 0u)
+
+#endif
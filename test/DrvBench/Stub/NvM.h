@@ -0,0 +1,35 @@
+/*****************************************************************************************************************
+******************************************************************************************************************
+*  Copyright (C) .
+*  All rights reserved.
+******************************************************************************************************************
+*  FileName: NvM
+*  Content:  Host fake of the NvM, see DrvBench_Mcal.c. No block is ever read, writes are dropped.
+*  Category: DrvBench
+******************************************************************************************************************
+*  Revision Management
+*  yyyy.mm.dd    name              version      description
+*  ----------    --------          -------      -----------------------------------
+*  2026.01.24    clipping            v0001        Frist edit
+******************************************************************************************************************
+******************************************************************************************************************/
+#ifndef _NVM_H_
+#define _NVM_H_
+
+#include "Std_Types.h"
+
+typedef uint16 NvM_BlockIdType;
+typedef uint8 NvM_RequestResultType;
+
+#define NVM_REQ_OK              0u
+#define NVM_REQ_NOT_OK          1u
+#define NVM_REQ_PENDING         2u
+#define NVM_REQ_NV_INVALIDATED  5u
+
+#define NvMConf_NvMBlockDescriptor_NvMBlock_Pfm     2u
+
+extern Std_ReturnType NvM_GetErrorStatus(NvM_BlockIdType BlockId, NvM_RequestResultType* RequestResultPtr);
+extern Std_ReturnType NvM_SetRamBlockStatus(NvM_BlockIdType BlockId, boolean BlockChanged);
+extern Std_ReturnType NvM_WriteBlock(NvM_BlockIdType BlockId, const void* NvM_SrcPtr);
+
+#endif
@@ -0,0 +1,25 @@
+/*****************************************************************************************************************
+******************************************************************************************************************
+*  Copyright (C) .
+*  All rights reserved.
+******************************************************************************************************************
+*  FileName: Pwm
+*  Content:  Host fake of the PWM driver, see DrvBench_Mcal.c.
+*  Category: DrvBench
+******************************************************************************************************************
+*  Revision Management
+*  yyyy.mm.dd    name              version      description
+*  ----------    --------          -------      -----------------------------------
+*  2026.01.24    clipping            v0001        Frist edit
+******************************************************************************************************************
+******************************************************************************************************************/
+#ifndef _PWM_H_
+#define _PWM_H_
+
+#include "Std_Types.h"
+
+typedef uint8 Pwm_ChannelType;
+
+extern void Pwm_SetDutyCycle(Pwm_ChannelType ChannelNumber, uint16 DutyCycle);
+
+#endif
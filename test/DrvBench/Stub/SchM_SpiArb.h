@@ -0,0 +1,22 @@
+/*****************************************************************************************************************
+******************************************************************************************************************
+*  Copyright (C) .
+*  All rights reserved.
+******************************************************************************************************************
+*  FileName: SchM_SpiArb
+*  Content:  Host fake of the SpiArb exclusive area, the bench runs in one context.
+*  Category: DrvBench
+******************************************************************************************************************
+*  Revision Management
+*  yyyy.mm.dd    name              version      description
+*  ----------    --------          -------      -----------------------------------
+*  2026.01.24    clipping            v0001        Frist edit
+******************************************************************************************************************
+******************************************************************************************************************/
+#ifndef _SCHM_SPIARB_H_
+#define _SCHM_SPIARB_H_
+
+#define SchM_Enter_SpiArb_SPIARB_EXCLUSIVE_AREA_0()
+#define SchM_Exit_SpiArb_SPIARB_EXCLUSIVE_AREA_0()
+
+#endif
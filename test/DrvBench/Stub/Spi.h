@@ -0,0 +1,30 @@
+/*****************************************************************************************************************
+******************************************************************************************************************
+*  Copyright (C) .
+*  All rights reserved.
+******************************************************************************************************************
+*  FileName: Spi
+*  Content:  Host fake of the SPI driver, see DrvBench_Mcal.c.
+*  Category: DrvBench
+******************************************************************************************************************
+*  Revision Management
+*  yyyy.mm.dd    name              version      description
+*  ----------    --------          -------      -----------------------------------
+*  2026.01.24    clipping            v0001        Frist edit
+******************************************************************************************************************
+******************************************************************************************************************/
+#ifndef _SPI_H_
+#define _SPI_H_
+
+#include "Std_Types.h"
+
+typedef uint8 Spi_ChannelType;
+typedef uint8 Spi_SequenceType;
+typedef uint8 Spi_DataBufferType;
+typedef uint16 Spi_NumberOfDataType;
+
+extern Std_ReturnType Spi_SetupEB(Spi_ChannelType Channel, const Spi_DataBufferType* SrcDataBufferPtr,
+                                  Spi_DataBufferType* DesDataBufferPtr, Spi_NumberOfDataType Length);
+extern Std_ReturnType Spi_SyncTransmit(Spi_SequenceType Sequence);
+
+#endif
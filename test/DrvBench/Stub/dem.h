@@ -0,0 +1,29 @@
+/*****************************************************************************************************************
+******************************************************************************************************************
+*  Copyright (C) .
+*  All rights reserved.
+******************************************************************************************************************
+*  FileName: dem
+*  Content:  Host fake of the DEM interface used by Pfm, see DrvBench_Mcal.c.
+*  Category: DrvBench
+******************************************************************************************************************
+*  Revision Management
+*  yyyy.mm.dd    name              version      description
+*  ----------    --------          -------      -----------------------------------
+*  2026.01.24    clipping            v0001        Frist edit
+******************************************************************************************************************
+******************************************************************************************************************/
+#ifndef _DEM_H_
+#define _DEM_H_
+
+#include "Std_Types.h"
+
+typedef uint16 Dem_EventIdType;
+typedef uint8 Dem_EventStatusType;
+
+#define DEM_EVENT_STATUS_PASSED     0x00u
+#define DEM_EVENT_STATUS_FAILED     0x01u
+
+extern Std_ReturnType Dem_SetEventStatus(Dem_EventIdType EventId, Dem_EventStatusType EventStatus);
+
+#endif
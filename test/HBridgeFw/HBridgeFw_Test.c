@@ -0,0 +1,255 @@
+/*****************************************************************************************************************
+******************************************************************************************************************
+*  Copyright (C) .
+*  All rights reserved.
+******************************************************************************************************************
+*  FileName: HBridgeFw_Test
+*  Content:  Host test of the freewheeling selection of HBridge: the selected freewheeling has to be
+*            written to the FW bits of Tle941xy and the AFW bits of Tle9210x.
+*  Category: HBridge
+******************************************************************************************************************
+*  Revision Management
+*  yyyy.mm.dd    name              version      description
+*  ----------    --------          -------      -----------------------------------
+*  2026.10.18    clipping            v0001        Frist edit
+******************************************************************************************************************
+******************************************************************************************************************/
+/* Include Headerfiles  */
+#include <stdio.h>
+#include <string.h>
+#include "HBridge.h"
+#include "Tle941xy.h"
+#include "Tle941xy_Types.h"
+#include "Tle9210x.h"
+#include "SpiArb.h"
+#include "IoChnReg.h"
+#include "Pfm.h"
+#include "Spi.h"
+#include "Dio.h"
+#include "Pwm.h"
+#include "Adc.h"
+
+#define TEST_FRAME_MAX      512u
+#define TEST_FRAME_LEN      8u
+#define TEST_INIT_CYCLES    200u
+
+/* SPI channels of the board: one per group */
+#define TEST_SPI_TLE941XY_0 0u
+#define TEST_SPI_TLE941XY_1 1u
+#define TEST_SPI_TLE9210X_0 2u
+#define TEST_SPI_TLE9210X_1 3u
+#define TEST_SPI_TLE9210X_2 4u
+
+/* write frames of a single chip group, see Tle941xy_WriteReg and Tle9210x_WriteReg */
+#define TEST_TLE941XY_WR(reg)   ((uint8)(TLE941XY_BASE_ADDR | (TLE941XY_LABT_ON << 1u) | ((reg) << 2u) | (TLE941XY_WRITE << 7u)))
+#define TEST_TLE9210X_WR(reg)   ((uint8)(TLE9210X_BASE_ADDR | (TLE9210X_LABT_ON << 7u) | ((reg) << 1u) | TLE9210X_OP_RW_OR_R1C))
+
+typedef struct
+{
+    Spi_ChannelType u8Chn;
+    uint8 au8Tx[TEST_FRAME_LEN];
+}Test_FrameType;
+
+static Test_FrameType sTest_atFrame[TEST_FRAME_MAX];
+static uint16 sTest_u16FrameNum;
+static Spi_ChannelType sTest_u8SpiChn;
+static const Spi_DataBufferType* sTest_pu8SpiTx;
+static Spi_DataBufferType* sTest_pu8SpiRx;
+static Spi_NumberOfDataType sTest_u16SpiLen;
+static uint16 sTest_u16Fail;
+
+/* board: Tle941xy group 0 drives the seat with PWM1 on HB0, HB0 may freewheel actively but
+   HB1 may not, so the bridge has to freewheel passively and the FW bit of HB0 is cleared.
+   Tle9210x group 0 drives the window lift with PWM channel 0 on HB1. */
+static uint8 sTest_u8ChipNum = 1u;
+
+const Tle941xy_GroupType cTle941xy_atGroupCfg[TLE941XY_GROUP_MAX] =
+{
+    { TEST_SPI_TLE941XY_0, TEST_SPI_TLE941XY_0, TLE941XY_DAISY_CHAIN_NO_USER, &sTest_u8ChipNum, SPIARB_BUS_0 },
+    { TEST_SPI_TLE941XY_1, TEST_SPI_TLE941XY_1, TLE941XY_DAISY_CHAIN_NO_USER, &sTest_u8ChipNum, SPIARB_BUS_0 },
+};
+const Tle941xy_ChipType cTle941xy_atChipCfg[TLE941XY_GROUP_MAX][TLE941XY_CHIP_MAX];
+const uint8 cTle941xy_au8ChnModeCfg[TLE941XY_GROUP_MAX][TLE941XY_CHIP_MAX][TLE941XY_CHANNEL_MAX] =
+{
+    { { TLE941XY_CHN_CTRL_PWM1 } },
+};
+const Tle941xy_PwmType cTle941xy_atChipFmPwmFreqCfg[TLE941XY_GROUP_MAX][TLE941XY_CHIP_MAX];
+const boolean cTle941xy_abChipFreeWheelingCfg[TLE941XY_GROUP_MAX][TLE941XY_CHIP_MAX][TLE941XY_CHANNEL_MAX] =
+{
+    { { TLE941XY_CHN_FW_ON, TLE941XY_CHN_FW_OFF } },
+};
+const boolean cTle941xy_abChipHS1And2LedModeCfg[TLE941XY_GROUP_MAX][TLE941XY_CHIP_MAX][2];
+#if(TLE941XY_DERATE_EN == STD_ON)
+const uint8 cTle941xy_au8DerateDutyCfg[TLE941XY_DERATE_LVL_MAX] =
+{
+    100u, 75u, 50u
+};
+const uint8 cTle941xy_au8ChnPrioCfg[TLE941XY_GROUP_MAX][TLE941XY_CHIP_MAX][TLE941XY_CHANNEL_MAX];
+#endif
+
+const Tle9210x_GroupType cTle9210x_atGroupCfg[TLE9210X_GROUP_MAX] =
+{
+    { TEST_SPI_TLE9210X_0, TEST_SPI_TLE9210X_0, TLE9210X_DAISY_CHAIN_NO_USER, &sTest_u8ChipNum, SPIARB_BUS_1 },
+    { TEST_SPI_TLE9210X_1, TEST_SPI_TLE9210X_1, TLE9210X_DAISY_CHAIN_NO_USER, &sTest_u8ChipNum, SPIARB_BUS_1 },
+    { TEST_SPI_TLE9210X_2, TEST_SPI_TLE9210X_2, TLE9210X_DAISY_CHAIN_NO_USER, &sTest_u8ChipNum, SPIARB_BUS_1 },
+};
+const Tle9210x_ChipType cTle9210x_atChipCfg[TLE9210X_GROUP_MAX][TLE9210X_CHIP_MAX] =
+{
+    { { TLE9210X_TLE92108, 0u, TLE9210X_REG_BANK_OFF, TLE9210X_WD_200_MS, TLE9210X_WD_DIS, 0u, 0u } },
+    { { TLE9210X_TLE92108, 0u, TLE9210X_REG_BANK_OFF, TLE9210X_WD_200_MS, TLE9210X_WD_DIS, 0u, 0u } },
+    { { TLE9210X_TLE92108, 0u, TLE9210X_REG_BANK_OFF, TLE9210X_WD_200_MS, TLE9210X_WD_DIS, 0u, 0u } },
+};
+const Tle9210x_PwmChnType cTle9210x_atPwmChnCfg[TLE9210X_GROUP_MAX][TLE9210X_CHIP_MAX][TLE9210X_PWM_CHN_MAX] =
+{
+    { { { 0u, TLE9210X_PWM_ENABLE, TLE9210X_HB1, 0u, 0u, 0u, 0u } } },
+};
+const Tle9210x_HbChnType cTle9210x_atHbChnCfg[TLE9210X_GROUP_MAX][TLE9210X_CHIP_MAX][TLE9210X_HB_CHN_MAX];
+#if(TLE9210X_RIPPLE_EN == STD_ON)
+const Tle9210x_RippleMotorType cTle9210x_atRippleCfg[TLE9210X_RIPPLE_MOTOR_MAX];
+#endif
+
+const HBridge_CfgType cHBridge_atCfg[HBRIDGE_ID_MAX] =
+{
+    /* HBRIDGE_ID_WINDOW_LIFT */
+    { HBRIDGE_DEV_TLE9210X, TLE9210X_GROUP_0, TLE9210X_CHIP_0, TLE9210X_HB1, TLE9210X_HB2, 0u, HBRIDGE_NO_RIPPLE },
+    /* HBRIDGE_ID_SEAT */
+    { HBRIDGE_DEV_TLE941XY, TLE941XY_GROUP_0, TLE941XY_CHIP_0, 0u, 1u, 0u, HBRIDGE_NO_RIPPLE },
+};
+
+/* MCAL and Pfm fakes: every frame is logged, the devices answer all zero (no fault) */
+Std_ReturnType Spi_SetupEB(Spi_ChannelType Channel, const Spi_DataBufferType* SrcDataBufferPtr,
+                           Spi_DataBufferType* DesDataBufferPtr, Spi_NumberOfDataType Length)
+{
+    sTest_u8SpiChn = Channel;
+    sTest_pu8SpiTx = SrcDataBufferPtr;
+    sTest_pu8SpiRx = DesDataBufferPtr;
+    sTest_u16SpiLen = Length;
+    return E_OK;
+}
+
+Std_ReturnType Spi_SyncTransmit(Spi_SequenceType Sequence)
+{
+    (void)Sequence;
+    if(sTest_u16FrameNum < TEST_FRAME_MAX)
+    {
+        sTest_atFrame[sTest_u16FrameNum].u8Chn = sTest_u8SpiChn;
+        (void)memcpy(sTest_atFrame[sTest_u16FrameNum].au8Tx, sTest_pu8SpiTx,
+                     (sTest_u16SpiLen < TEST_FRAME_LEN) ? sTest_u16SpiLen : TEST_FRAME_LEN);
+        sTest_u16FrameNum++;
+    }
+    (void)memset(sTest_pu8SpiRx, 0, sTest_u16SpiLen);
+    return E_OK;
+}
+
+void Dio_WriteChannel(Dio_ChannelType ChannelId, Dio_LevelType Level)
+{
+    (void)ChannelId;
+    (void)Level;
+}
+
+void Pwm_SetDutyCycle(Pwm_ChannelType ChannelNumber, uint16 DutyCycle)
+{
+    (void)ChannelNumber;
+    (void)DutyCycle;
+}
+
+Std_ReturnType Adc_SetupResultBuffer(Adc_GroupType Group, Adc_ValueGroupType* DataBufferPtr)
+{
+    (void)Group;
+    (void)DataBufferPtr;
+    return E_OK;
+}
+
+void Adc_EnableHardwareTrigger(Adc_GroupType Group)
+{
+    (void)Group;
+}
+
+Adc_StreamNumSampleType Adc_GetStreamLastPointer(Adc_GroupType Group, Adc_ValueGroupType** PtrToSamplePtr)
+{
+    (void)Group;
+    (void)PtrToSamplePtr;
+    return 0u;
+}
+
+void Pfm_DefectReport(PFM_PhysicalId_e Pid, PFM_DefectDetectState_e OpenLoad,
+                      PFM_DefectDetectState_e Short2Vcc, PFM_DefectDetectState_e Short2Gnd)
+{
+    (void)Pid;
+    (void)OpenLoad;
+    (void)Short2Vcc;
+    (void)Short2Gnd;
+}
+
+static void Test_Check(boolean bOk, const char* pcName)
+{
+    printf("%-56s %s\n", pcName, (bOk == TRUE) ? "ok" : "FAILED");
+    if(bOk != TRUE)
+    {
+        sTest_u16Fail++;
+    }
+}
+
+/* data byte(s) of the last logged write of the command byte on the channel, FALSE: not written */
+static boolean Test_LastWrite(Spi_ChannelType u8Chn, uint8 u8Cmd, uint8 u8Len, uint16* pu16Data)
+{
+    uint16 i;
+    boolean l_bFound = FALSE;
+
+    for(i = 0u;i < sTest_u16FrameNum;i++)
+    {
+        if((sTest_atFrame[i].u8Chn == u8Chn) && (sTest_atFrame[i].au8Tx[0] == u8Cmd))
+        {
+            *pu16Data = (u8Len == 2u) ? (uint16)(sTest_atFrame[i].au8Tx[1] | ((uint16)sTest_atFrame[i].au8Tx[2] << 8u))
+                                      : (uint16)sTest_atFrame[i].au8Tx[1];
+            l_bFound = TRUE;
+        }
+    }
+    return l_bFound;
+}
+
+int main(void)
+{
+    uint16 i;
+    uint16 l_u16Data = 0u;
+    boolean l_bWritten;
+
+    (void)IoChnReg_Init();
+    SpiArb_Init();
+    Tle941xy_Init();
+    Tle9210x_Init();
+    HBridge_Init();
+    for(i = 0u;(i < TEST_INIT_CYCLES)
+            && ((Tle941xy_IsGroupReady(TLE941XY_GROUP_0) != TRUE) || (Tle9210x_IsGroupReady(TLE9210X_GROUP_0) != TRUE));i++)
+    {
+        Tle941xy_InitMainFunction();
+        Tle9210x_InitMainFunction();
+        SpiArb_MainFunction();
+    }
+    /* output jobs queued by the init writes */
+    SpiArb_MainFunction();
+    SpiArb_MainFunction();
+    Test_Check((boolean)((Tle941xy_IsGroupReady(TLE941XY_GROUP_0) == TRUE) && (Tle9210x_IsGroupReady(TLE9210X_GROUP_0) == TRUE)),
+               "groups ready");
+
+    Test_Check((boolean)(HBridge_IsActiveFw(HBRIDGE_ID_WINDOW_LIFT) == TRUE), "window lift freewheels actively");
+    l_bWritten = Test_LastWrite(TEST_SPI_TLE9210X_0, TEST_TLE9210X_WR(TLE9210X_PWMSET), 2u, &l_u16Data);
+    Test_Check((boolean)((l_bWritten == TRUE) && ((l_u16Data & (1u << TLE9210X_PWMSET_AFW_BIT)) != 0u)),
+               "Tle9210x PWMSET written with AFW of PWM channel 0");
+
+    Test_Check((boolean)(HBridge_IsActiveFw(HBRIDGE_ID_SEAT) == FALSE), "seat freewheels passively");
+    l_bWritten = Test_LastWrite(TEST_SPI_TLE941XY_0, TEST_TLE941XY_WR(TLE941XY_FW_OL_CTRL), 1u, &l_u16Data);
+    Test_Check((boolean)((l_bWritten == TRUE) && ((l_u16Data & (1u << 2u)) == 0u)),
+               "Tle941xy FW_OL_CTRL written with FW of HB0 cleared");
+
+    /* a later selection goes out with the next output job */
+    sTest_u16FrameNum = 0u;
+    Tle941xy_WriteFwChn(TLE941XY_GROUP_0, TLE941XY_CHIP_0, 2u, TRUE);
+    SpiArb_MainFunction();
+    l_bWritten = Test_LastWrite(TEST_SPI_TLE941XY_0, TEST_TLE941XY_WR(TLE941XY_FW_OL_CTRL), 1u, &l_u16Data);
+    Test_Check((boolean)((l_bWritten == TRUE) && ((l_u16Data & (1u << 4u)) != 0u) && ((l_u16Data & (1u << 2u)) == 0u)),
+               "Tle941xy_WriteFwChn sets FW of HB2 in FW_OL_CTRL");
+
+    printf("%u failed\n", (unsigned int)sTest_u16Fail);
+    return (sTest_u16Fail == 0u) ? 0 : 1;
+}
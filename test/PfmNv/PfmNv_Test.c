@@ -0,0 +1,120 @@
+/*****************************************************************************************************************
+******************************************************************************************************************
+*  Copyright (C) .
+*  All rights reserved.
+******************************************************************************************************************
+*  FileName: PfmNv_Test
+*  Content:  Host test of the Pfm persistent block with the file backend (PFM_NV_HOST_FILE).
+*  Category: Pfm
+******************************************************************************************************************
+*  Revision Management
+*  yyyy.mm.dd    name              version      description
+*  ----------    --------          -------      -----------------------------------
+*  2026.01.26    clipping            v0001        Frist edit
+******************************************************************************************************************
+******************************************************************************************************************/
+/* Include Headerfiles  */
+#include <stdio.h>
+#include <string.h>
+#include "Pfm_Nv.h"
+
+static uint32 sTest_au32PayloadA[PFM_NV_PAYLOAD_SIZE];
+static uint32 sTest_au32PayloadB[PFM_NV_PAYLOAD_SIZE];
+static uint32 sTest_au32Read[PFM_NV_PAYLOAD_SIZE];
+static uint16 sTest_u16Fail;
+
+static void Test_Check(boolean bOk, const char* pcName)
+{
+    printf("%-48s %s\n", pcName, (bOk == TRUE) ? "ok" : "FAILED");
+    if(bOk != TRUE)
+    {
+        sTest_u16Fail++;
+    }
+}
+
+static boolean Test_RestoreEquals(const uint32* pu32Exp)
+{
+    boolean l_bOk = FALSE;
+
+    (void)memset(sTest_au32Read, 0, sizeof(sTest_au32Read));
+    if((Pfm_NvRestore(sTest_au32Read) == E_OK)
+    && (memcmp(sTest_au32Read, pu32Exp, sizeof(sTest_au32Read)) == 0))
+    {
+        l_bOk = TRUE;
+    }
+    return l_bOk;
+}
+
+/* payload as stored in the file, without going through Pfm_NvRestore and its state reset */
+static boolean Test_FileEquals(const uint32* pu32Exp)
+{
+    boolean l_bOk = FALSE;
+    FILE* fp = fopen(PFM_NV_HOST_FILE, "rb");
+
+    (void)memset(sTest_au32Read, 0, sizeof(sTest_au32Read));
+    if(fp != NULL)
+    {
+        if((fseek(fp, (long)PFM_NV_HEADER_SIZE * (long)sizeof(uint32), SEEK_SET) == 0)
+        && (fread(sTest_au32Read, sizeof(uint32), PFM_NV_PAYLOAD_SIZE, fp) == (size_t)PFM_NV_PAYLOAD_SIZE)
+        && (memcmp(sTest_au32Read, pu32Exp, sizeof(sTest_au32Read)) == 0))
+        {
+            l_bOk = TRUE;
+        }
+        (void)fclose(fp);
+    }
+    return l_bOk;
+}
+
+/* flip one payload bit in the file, as a write torn by a reset would leave it */
+static void Test_CorruptPayload(void)
+{
+    FILE* fp = fopen(PFM_NV_HOST_FILE, "r+b");
+    uint32 l_u32Word = 0u;
+
+    if(fp != NULL)
+    {
+        (void)fseek(fp, (long)PFM_NV_HEADER_SIZE * (long)sizeof(uint32), SEEK_SET);
+        (void)fread(&l_u32Word, sizeof(uint32), 1u, fp);
+        l_u32Word ^= 0x1u;
+        (void)fseek(fp, (long)PFM_NV_HEADER_SIZE * (long)sizeof(uint32), SEEK_SET);
+        (void)fwrite(&l_u32Word, sizeof(uint32), 1u, fp);
+        (void)fclose(fp);
+    }
+}
+
+int main(void)
+{
+    uint16 i;
+
+    for(i = 0u; i < (uint16)PFM_NV_PAYLOAD_SIZE; i++)
+    {
+        sTest_au32PayloadA[i] = 0x12345678uL + i;
+        sTest_au32PayloadB[i] = 0x87654321uL - i;
+    }
+    (void)remove(PFM_NV_HOST_FILE);
+
+    Test_Check((boolean)(Pfm_NvRestore(sTest_au32Read) == E_NOT_OK), "missing block is not restored");
+
+    Pfm_NvFlush(sTest_au32PayloadA);
+    Test_Check(Test_RestoreEquals(sTest_au32PayloadA), "flushed record round-trips");
+
+    /* Pfm_NvRestore cleared the rate limit: the first update writes, the next ones wait */
+    Pfm_NvUpdate(sTest_au32PayloadB);
+    Test_Check(Test_FileEquals(sTest_au32PayloadB), "first update is written at once");
+    for(i = 0u; i < (uint16)PFM_NV_WRITE_INTERVAL; i++)
+    {
+        Pfm_NvUpdate(sTest_au32PayloadA);
+    }
+    Test_Check(Test_FileEquals(sTest_au32PayloadB), "next update is held back for the interval");
+    Pfm_NvUpdate(sTest_au32PayloadA);
+    Test_Check(Test_FileEquals(sTest_au32PayloadA), "held back update is written after the interval");
+    Test_Check(Test_RestoreEquals(sTest_au32PayloadA), "updated record round-trips");
+
+    Test_CorruptPayload();
+    Test_Check((boolean)(Pfm_NvRestore(sTest_au32Read) == E_NOT_OK), "block failing the checksum is not restored");
+    Pfm_NvFlush(sTest_au32PayloadA);
+    Test_Check(Test_RestoreEquals(sTest_au32PayloadA), "invalid block is rewritten completely");
+
+    (void)remove(PFM_NV_HOST_FILE);
+    return (sTest_u16Fail == 0u) ? 0 : 1;
+}